@@ -0,0 +1,34 @@
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stdio.h>
+#include <unistd.h>
+#include <SDL2/SDL.h>
+
+/*
+ * Helpers shared by the benchmarks.
+ */
+
+static inline Uint64 startTimer(void) {
+    return SDL_GetPerformanceCounter();
+}
+
+static inline double getElapsedSeconds(Uint64 start) {
+    return (double) (SDL_GetPerformanceCounter() - start) / (double) SDL_GetPerformanceFrequency();
+}
+
+/*
+ * Get the resident memory of the process in KiB, or -1 if it is unknown.
+ */
+static inline long getResidentMemory(void) {
+    long pages, residentPages = -1;
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (file == NULL) return -1;
+    if (fscanf(file, "%ld %ld", &pages, &residentPages) != 2) {
+        residentPages = -1;
+    }
+    fclose(file);
+    return residentPages < 0 ? -1 : residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+#endif /* _BENCH_H_ */
@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <X11/Xlib.h>
+#include "bench.h"
+
+/*
+ * Creates 10k small bitmaps and draws each of them twice with XCopyPlane, the first time
+ * expands the bits into a texture, the second uses the cached texture.
+ * Reports the time per bitmap and the growth of the resident memory.
+ */
+
+#define NUM_BITMAPS 10000
+#define BITMAP_SIZE 16
+#define TARGET_SIZE 256
+
+static void drawBitmaps(Display* display, Pixmap* bitmaps, Pixmap target, GC gc, const char* pass) {
+    Uint64 start = startTimer();
+    int i;
+    for (i = 0; i < NUM_BITMAPS; i++) {
+        int position = i * BITMAP_SIZE;
+        XCopyPlane(display, bitmaps[i], target, gc, 0, 0, BITMAP_SIZE, BITMAP_SIZE,
+                   position % TARGET_SIZE, position / TARGET_SIZE * BITMAP_SIZE % TARGET_SIZE, 1);
+    }
+    XSync(display, False);
+    double seconds = getElapsedSeconds(start);
+    printf("Drew %d bitmaps (%s) in %.1f ms, %.2f us per bitmap\n", NUM_BITMAPS, pass, seconds * 1e3,
+           seconds * 1e6 / NUM_BITMAPS);
+}
+
+int main(int argc, char* argv[]) {
+    (void) argc;
+    (void) argv;
+    Display* display = XOpenDisplay(NULL);
+    if (display == NULL) {
+        fprintf(stderr, "Failed to open the display\n");
+        return EXIT_FAILURE;
+    }
+    Window root = DefaultRootWindow(display);
+    Pixmap* bitmaps = malloc(sizeof(Pixmap) * NUM_BITMAPS);
+    char data[BITMAP_SIZE * BITMAP_SIZE / 8];
+    int i;
+    if (bitmaps == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        XCloseDisplay(display);
+        return EXIT_FAILURE;
+    }
+    for (i = 0; i < (int) sizeof(data); i++) {
+        data[i] = (char) (i * 37);
+    }
+
+    long memoryBefore = getResidentMemory();
+    Uint64 start = startTimer();
+    for (i = 0; i < NUM_BITMAPS; i++) {
+        bitmaps[i] = XCreateBitmapFromData(display, root, data, BITMAP_SIZE, BITMAP_SIZE);
+    }
+    XSync(display, False);
+    double seconds = getElapsedSeconds(start);
+    long memoryAfter = getResidentMemory();
+    printf("Created %d %dx%d bitmaps in %.1f ms, %.2f us per bitmap\n", NUM_BITMAPS, BITMAP_SIZE,
+           BITMAP_SIZE, seconds * 1e3, seconds * 1e6 / NUM_BITMAPS);
+    if (memoryBefore >= 0 && memoryAfter >= 0) {
+        printf("Resident memory grew by %ld KiB, %.0f bytes per bitmap\n", memoryAfter - memoryBefore,
+               (memoryAfter - memoryBefore) * 1024.0 / NUM_BITMAPS);
+    }
+
+    int screen = DefaultScreen(display);
+    Pixmap target = XCreatePixmap(display, root, TARGET_SIZE, TARGET_SIZE, (unsigned int) DefaultDepth(display, screen));
+    XGCValues values;
+    values.foreground = BlackPixel(display, screen);
+    values.background = WhitePixel(display, screen);
+    GC gc = XCreateGC(display, target, GCForeground | GCBackground, &values);
+    drawBitmaps(display, bitmaps, target, gc, "expanding");
+    drawBitmaps(display, bitmaps, target, gc, "cached");
+    printf("Resident memory after drawing: %ld KiB more than before creating the bitmaps\n",
+           getResidentMemory() - memoryBefore);
+
+    start = startTimer();
+    for (i = 0; i < NUM_BITMAPS; i++) {
+        XFreePixmap(display, bitmaps[i]);
+    }
+    XSync(display, False);
+    seconds = getElapsedSeconds(start);
+    printf("Freed %d bitmaps in %.1f ms\n", NUM_BITMAPS, seconds * 1e3);
+    free(bitmaps);
+    XFreeGC(display, gc);
+    XFreePixmap(display, target);
+    XCloseDisplay(display);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <SDL2/SDL.h>
+#include "pixelConversion.h"
+
+/*
+ * Checks every specialized pixel conversion kernel against the scalar kernels, and the scalar
+ * kernels against a per pixel reference, on odd widths, odd pitches and unaligned rows.
+ * Then the kernels of every supported instruction set are timed on a full HD image.
+ * With --check only the correctness is checked, which is what the test runs.
+ */
+
+#define MAX_WIDTH 67
+#define ROWS 3
+#define BENCH_WIDTH 1920
+#define BENCH_HEIGHT 1080
+#define BENCH_ITERATIONS 20
+
+static const char* INSTRUCTION_SET_NAMES[] = {"scalar", "SSE2", "AVX2", "NEON"};
+
+static const PixelLayout LAYOUTS[] = {
+    {32, LSBFirst, 0xFF0000, 0xFF00, 0xFF, 0xFF000000},
+    {32, MSBFirst, 0xFF0000, 0xFF00, 0xFF, 0},
+    {32, LSBFirst, 0xFF, 0xFF00, 0xFF0000, 0},
+    {32, MSBFirst, 0x3FF00000, 0xFFC00, 0x3FF, 0},
+    {32, MSBFirst, 0xFF000000, 0xFF0000, 0xFF00, 0xFF},
+    {24, LSBFirst, 0xFF0000, 0xFF00, 0xFF, 0},
+    {24, MSBFirst, 0xFF0000, 0xFF00, 0xFF, 0},
+    {16, LSBFirst, 0xF800, 0x7E0, 0x1F, 0},
+    {16, MSBFirst, 0xF800, 0x7E0, 0x1F, 0},
+    {16, LSBFirst, 0x7C00, 0x3E0, 0x1F, 0x8000},
+    {16, MSBFirst, 0xF00, 0xF0, 0xF, 0xF000},
+    {8, LSBFirst, 0xE0, 0x1C, 0x3, 0},
+};
+#define NUM_LAYOUTS ((int) (sizeof(LAYOUTS) / sizeof(LAYOUTS[0])))
+
+static Uint32 readPixel(const Uint8* pointer, int bytes, int byteOrder) {
+    Uint32 value = 0;
+    int i;
+    for (i = 0; i < bytes; i++) {
+        value |= (Uint32) pointer[i] << (byteOrder == LSBFirst ? i * 8 : (bytes - 1 - i) * 8);
+    }
+    return value;
+}
+
+static void getMaskRange(Uint32 mask, int* shift, int* width) {
+    *shift = *width = 0;
+    if (mask == 0) return;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        (*shift)++;
+    }
+    while (mask & 1) {
+        mask >>= 1;
+        (*width)++;
+    }
+}
+
+/*
+ * Scale a channel of the pixel to the destination mask by repeating its bits.
+ */
+static Uint32 convertChannel(Uint32 pixel, Uint32 srcMask, Uint32 destMask, Bool isAlpha) {
+    int srcShift, srcWidth, destShift, destWidth, position;
+    getMaskRange(srcMask, &srcShift, &srcWidth);
+    getMaskRange(destMask, &destShift, &destWidth);
+    if (destWidth == 0) return 0;
+    if (srcWidth == 0) return isAlpha ? destMask : 0;
+    Uint32 value = (pixel & srcMask) >> srcShift, result = 0;
+    for (position = destWidth - srcWidth; position > -srcWidth; position -= srcWidth) {
+        result |= position >= 0 ? value << position : value >> -position;
+    }
+    return (result << destShift) & destMask;
+}
+
+static Uint32 convertReferencePixel(Uint32 pixel, const PixelLayout* src, const PixelLayout* dest) {
+    if (memcmp(src, dest, sizeof(PixelLayout)) == 0) return pixel;
+    return convertChannel(pixel, src->redMask, dest->redMask, False)
+           | convertChannel(pixel, src->greenMask, dest->greenMask, False)
+           | convertChannel(pixel, src->blueMask, dest->blueMask, False)
+           | convertChannel(pixel, src->alphaMask, dest->alphaMask, True);
+}
+
+/*
+ * Convert ROWS rows of the given width with odd pitches and unaligned row starts.
+ */
+static Bool convertRows(InstructionSet set, const PixelLayout* src, const PixelLayout* dest, const Uint8* srcPixels,
+                        int srcPitch, Uint8* destPixels, int destPitch, int width) {
+    PixelConversion conversion;
+    if (!usePixelConversionKernels(set) || !initPixelConversion(&conversion, src, dest)) return False;
+    memset(destPixels, 0xA5, (size_t) destPitch * ROWS + 1);
+    convertPixels(&conversion, srcPixels + 1, srcPitch, destPixels + 1, destPitch, width, ROWS);
+    return True;
+}
+
+static int checkKernels(void) {
+    static Uint8 srcPixels[(MAX_WIDTH * 4 + 3) * ROWS + 1];
+    static Uint8 expected[(MAX_WIDTH * 4 + 3) * ROWS + 1];
+    static Uint8 actual[(MAX_WIDTH * 4 + 3) * ROWS + 1];
+    int srcIndex, destIndex, width, set, x, y, failures = 0;
+    size_t i;
+    for (i = 0; i < sizeof(srcPixels); i++) {
+        srcPixels[i] = (Uint8) rand();
+    }
+    for (srcIndex = 0; srcIndex < NUM_LAYOUTS; srcIndex++) {
+        for (destIndex = 0; destIndex < NUM_LAYOUTS; destIndex++) {
+            const PixelLayout* src = &LAYOUTS[srcIndex];
+            const PixelLayout* dest = &LAYOUTS[destIndex];
+            int srcBytes = src->bitsPerPixel / 8, destBytes = dest->bitsPerPixel / 8;
+            for (width = 1; width <= MAX_WIDTH; width += 2) {
+                // Odd pitches with padding, so no row starts aligned.
+                int srcPitch = width * srcBytes + 3, destPitch = width * destBytes + 3;
+                if (!convertRows(SCALAR, src, dest, srcPixels, srcPitch, expected, destPitch, width)) {
+                    printf("Failed to prepare the conversion %d -> %d\n", srcIndex, destIndex);
+                    failures++;
+                    break;
+                }
+                for (y = 0; y < ROWS; y++) {
+                    for (x = 0; x < width; x++) {
+                        Uint32 srcPixel = readPixel(srcPixels + 1 + y * srcPitch + x * srcBytes, srcBytes,
+                                                    src->byteOrder);
+                        Uint32 destPixel = readPixel(expected + 1 + y * destPitch + x * destBytes, destBytes,
+                                                     dest->byteOrder);
+                        Uint32 reference = convertReferencePixel(srcPixel, src, dest);
+                        if (destPixel != reference) {
+                            printf("scalar %d -> %d, width %d, pixel (%d, %d): 0x%x became 0x%x instead of 0x%x\n",
+                                   srcIndex, destIndex, width, x, y, srcPixel, destPixel, reference);
+                            failures++;
+                            x = width;
+                            y = ROWS;
+                        }
+                    }
+                }
+                for (set = SSE2; set <= NEON; set++) {
+                    if (!convertRows((InstructionSet) set, src, dest, srcPixels, srcPitch, actual, destPitch, width)) {
+                        continue;
+                    }
+                    if (memcmp(expected, actual, (size_t) destPitch * ROWS + 1) != 0) {
+                        printf("%s %d -> %d, width %d: differs from the scalar kernel\n",
+                               INSTRUCTION_SET_NAMES[set], srcIndex, destIndex, width);
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+    usePixelConversionKernels(SCALAR);
+    return failures;
+}
+
+static void benchKernels(void) {
+    // 32 bit native to 32 bit swapped, 24 bit and 16 bit, and 16 bit to 32 bit.
+    static const int PAIRS[][2] = {{0, 2}, {0, 1}, {0, 5}, {0, 7}, {7, 0}};
+    Uint8* srcPixels = malloc((size_t) BENCH_WIDTH * BENCH_HEIGHT * 4);
+    Uint8* destPixels = malloc((size_t) BENCH_WIDTH * BENCH_HEIGHT * 4);
+    size_t i;
+    int set, iteration;
+    if (srcPixels == NULL || destPixels == NULL) {
+        printf("Out of memory\n");
+        free(srcPixels);
+        free(destPixels);
+        return;
+    }
+    for (i = 0; i < (size_t) BENCH_WIDTH * BENCH_HEIGHT * 4; i++) {
+        srcPixels[i] = (Uint8) rand();
+    }
+    for (i = 0; i < sizeof(PAIRS) / sizeof(PAIRS[0]); i++) {
+        const PixelLayout* src = &LAYOUTS[PAIRS[i][0]];
+        const PixelLayout* dest = &LAYOUTS[PAIRS[i][1]];
+        printf("%d bpp -> %d bpp (%d -> %d):", src->bitsPerPixel, dest->bitsPerPixel, PAIRS[i][0], PAIRS[i][1]);
+        for (set = SCALAR; set <= NEON; set++) {
+            PixelConversion conversion;
+            if (!usePixelConversionKernels((InstructionSet) set) || !initPixelConversion(&conversion, src, dest)) {
+                continue;
+            }
+            Uint64 start = SDL_GetPerformanceCounter();
+            for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++) {
+                convertPixels(&conversion, srcPixels, BENCH_WIDTH * src->bitsPerPixel / 8,
+                              destPixels, BENCH_WIDTH * dest->bitsPerPixel / 8, BENCH_WIDTH, BENCH_HEIGHT);
+            }
+            double seconds = (double) (SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+            printf(" %s %.0f Mpixel/s", INSTRUCTION_SET_NAMES[set],
+                   BENCH_ITERATIONS * (double) BENCH_WIDTH * BENCH_HEIGHT / seconds / 1e6);
+        }
+        printf("\n");
+    }
+    usePixelConversionKernels(SCALAR);
+    free(srcPixels);
+    free(destPixels);
+}
+
+int main(int argc, char* argv[]) {
+    int failures = checkKernels();
+    printf("%d conversion failures\n", failures);
+    if (failures == 0 && (argc < 2 || strcmp(argv[1], "--check") != 0)) {
+        benchKernels();
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include "bench.h"
+
+/*
+ * Measures the XPutImage throughput in MB/s of image data for each supported image format,
+ * once for uploads of the whole image and once for small sub-rectangles of it.
+ * The target is a pixmap of the default depth, so presenting doesn't affect the result.
+ */
+
+#define IMAGE_SIZE 512
+#define FULL_ITERATIONS 50
+#define TILE_SIZE 64
+#define TILE_ITERATIONS 2000
+
+typedef struct {
+    const char* name;
+    int format;
+    unsigned int depth;
+    int bitsPerPixel;
+    int byteOrder;
+    unsigned long redMask, greenMask, blueMask;
+} ImageFormat;
+
+static const ImageFormat FORMATS[] = {
+    {"ZPixmap 32 bpp RGB LSBFirst", ZPixmap, 24, 32, LSBFirst, 0xFF0000, 0xFF00, 0xFF},
+    {"ZPixmap 32 bpp RGB MSBFirst", ZPixmap, 24, 32, MSBFirst, 0xFF0000, 0xFF00, 0xFF},
+    {"ZPixmap 32 bpp BGR LSBFirst", ZPixmap, 24, 32, LSBFirst, 0xFF, 0xFF00, 0xFF0000},
+    {"ZPixmap 24 bpp RGB", ZPixmap, 24, 24, LSBFirst, 0xFF0000, 0xFF00, 0xFF},
+    {"ZPixmap 16 bpp RGB565", ZPixmap, 16, 16, LSBFirst, 0xF800, 0x7E0, 0x1F},
+    {"ZPixmap 16 bpp RGB565 MSBFirst", ZPixmap, 16, 16, MSBFirst, 0xF800, 0x7E0, 0x1F},
+    {"ZPixmap 15 bpp RGB555", ZPixmap, 15, 16, LSBFirst, 0x7C00, 0x3E0, 0x1F},
+    {"ZPixmap 8 bpp RGB332", ZPixmap, 8, 8, LSBFirst, 0xE0, 0x1C, 0x3},
+    {"XYPixmap depth 8", XYPixmap, 8, 1, LSBFirst, 0xE0, 0x1C, 0x3},
+    {"XYBitmap", XYBitmap, 1, 1, LSBFirst, 0, 0, 0},
+};
+
+static XImage* createImage(Display* display, const ImageFormat* format) {
+    Visual* visual = DefaultVisual(display, DefaultScreen(display));
+    XImage* image = XCreateImage(display, visual, format->depth, format->format, 0, NULL,
+                                 IMAGE_SIZE, IMAGE_SIZE, 32, 0);
+    if (image == NULL) return NULL;
+    image->bits_per_pixel = format->bitsPerPixel;
+    image->byte_order = format->byteOrder;
+    image->red_mask = format->redMask;
+    image->green_mask = format->greenMask;
+    image->blue_mask = format->blueMask;
+    image->bytes_per_line = format->format == ZPixmap ? (IMAGE_SIZE * format->bitsPerPixel + 31) / 32 * 4
+                                                      : (IMAGE_SIZE + 31) / 32 * 4;
+    size_t size = (size_t) image->bytes_per_line * IMAGE_SIZE * (format->format == XYPixmap ? format->depth : 1);
+    image->data = malloc(size);
+    if (image->data == NULL || !XInitImage(image)) {
+        free(image->data);
+        free(image);
+        return NULL;
+    }
+    size_t i;
+    for (i = 0; i < size; i++) {
+        image->data[i] = (char) rand();
+    }
+    return image;
+}
+
+/*
+ * Get the number of bytes of image data that are uploaded for an area of the image.
+ */
+static double getAreaBytes(const XImage* image, int width, int height) {
+    int planes = image->format == XYPixmap ? image->depth : 1;
+    return (double) width * height * image->bits_per_pixel * planes / 8;
+}
+
+int main(int argc, char* argv[]) {
+    (void) argc;
+    (void) argv;
+    Display* display = XOpenDisplay(NULL);
+    if (display == NULL) {
+        fprintf(stderr, "Failed to open the display\n");
+        return EXIT_FAILURE;
+    }
+    int screen = DefaultScreen(display);
+    Window root = DefaultRootWindow(display);
+    Pixmap target = XCreatePixmap(display, root, IMAGE_SIZE, IMAGE_SIZE, (unsigned int) DefaultDepth(display, screen));
+    XGCValues values;
+    values.foreground = BlackPixel(display, screen);
+    values.background = WhitePixel(display, screen);
+    GC gc = XCreateGC(display, target, GCForeground | GCBackground, &values);
+    size_t i;
+    int iteration;
+    printf("%-32s %12s %12s\n", "Format", "Full MB/s", "64x64 MB/s");
+    for (i = 0; i < sizeof(FORMATS) / sizeof(FORMATS[0]); i++) {
+        XImage* image = createImage(display, &FORMATS[i]);
+        if (image == NULL) {
+            printf("%-32s failed to create the image\n", FORMATS[i].name);
+            continue;
+        }
+        Uint64 start = startTimer();
+        for (iteration = 0; iteration < FULL_ITERATIONS; iteration++) {
+            XPutImage(display, target, gc, image, 0, 0, 0, 0, IMAGE_SIZE, IMAGE_SIZE);
+        }
+        XSync(display, False);
+        double fullRate = getAreaBytes(image, IMAGE_SIZE, IMAGE_SIZE) * FULL_ITERATIONS
+                          / getElapsedSeconds(start) / 1e6;
+        start = startTimer();
+        for (iteration = 0; iteration < TILE_ITERATIONS; iteration++) {
+            // Odd offsets, so the rows of the sub-rectangles are not aligned.
+            int x = (iteration * 71) % (IMAGE_SIZE - TILE_SIZE);
+            int y = (iteration * 37) % (IMAGE_SIZE - TILE_SIZE);
+            XPutImage(display, target, gc, image, x, y, x, y, TILE_SIZE, TILE_SIZE);
+        }
+        XSync(display, False);
+        double tileRate = getAreaBytes(image, TILE_SIZE, TILE_SIZE) * TILE_ITERATIONS
+                          / getElapsedSeconds(start) / 1e6;
+        printf("%-32s %12.1f %12.1f\n", FORMATS[i].name, fullRate, tileRate);
+        XDestroyImage(image);
+    }
+    XFreeGC(display, gc);
+    XFreePixmap(display, target);
+    XCloseDisplay(display);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <X11/Xlib.h>
+#include "bench.h"
+
+/*
+ * Measures the XTextWidth throughput in calls per second for the kinds of strings a table
+ * widget measures: a few strings repeated over and over, many distinct short cells,
+ * strings with non ASCII characters and strings too long for the width cache.
+ * Usage: textWidthBench [font directory] [font name]
+ */
+
+#define NUM_STRINGS 10000
+#define MAX_STRING_LENGTH 160
+#define ITERATIONS 10
+
+typedef struct {
+    const char* name;
+    int count;
+    int length;
+    Bool nonAscii;
+} Workload;
+
+static const Workload WORKLOADS[] = {
+    {"16 repeated cells", 16, 12, False},
+    {"10k distinct cells", NUM_STRINGS, 12, False},
+    {"10k distinct cells, Latin-1", NUM_STRINGS, 12, True},
+    {"10k distinct long rows", NUM_STRINGS, 120, False},
+};
+
+static void fillString(char* string, int index, int length, Bool nonAscii) {
+    int i;
+    int prefix = snprintf(string, (size_t) length + 1, "%d ", index);
+    for (i = prefix; i < length; i++) {
+        string[i] = (char) ('a' + (index + i * 7) % 26);
+    }
+    if (nonAscii) {
+        // Latin-1 umlauts, which need the text to be decoded before measuring.
+        string[length - 1] = (char) 0xE4;
+        string[length / 2] = (char) 0xFC;
+    }
+    string[length] = '\0';
+}
+
+int main(int argc, char* argv[]) {
+    Display* display = XOpenDisplay(NULL);
+    if (display == NULL) {
+        fprintf(stderr, "Failed to open the display\n");
+        return EXIT_FAILURE;
+    }
+    if (argc > 1) {
+        XSetFontPath(display, &argv[1], 1);
+    }
+    const char* fontName = argc > 2 ? argv[2] : "fixed";
+    XFontStruct* font = XLoadQueryFont(display, fontName);
+    if (font == NULL) {
+        fprintf(stderr, "Failed to load the font %s\n", fontName);
+        XCloseDisplay(display);
+        return EXIT_FAILURE;
+    }
+    char (*strings)[MAX_STRING_LENGTH + 1] = malloc(sizeof(*strings) * NUM_STRINGS);
+    if (strings == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        XFreeFont(display, font);
+        XCloseDisplay(display);
+        return EXIT_FAILURE;
+    }
+    size_t i;
+    int index, iteration;
+    for (i = 0; i < sizeof(WORKLOADS) / sizeof(WORKLOADS[0]); i++) {
+        const Workload* workload = &WORKLOADS[i];
+        for (index = 0; index < workload->count; index++) {
+            fillString(strings[index], index, workload->length, workload->nonAscii);
+        }
+        long totalWidth = 0;
+        Uint64 start = startTimer();
+        for (iteration = 0; iteration < ITERATIONS; iteration++) {
+            for (index = 0; index < NUM_STRINGS; index++) {
+                totalWidth += XTextWidth(font, strings[index % workload->count], workload->length);
+            }
+        }
+        double seconds = getElapsedSeconds(start);
+        printf("%-30s %12.0f calls/s (total width %ld)\n", workload->name,
+               ITERATIONS * (double) NUM_STRINGS / seconds, totalWidth);
+    }
+    free(strings);
+    XFreeFont(display, font);
+    XCloseDisplay(display);
+    return EXIT_SUCCESS;
+}
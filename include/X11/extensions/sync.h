@@ -0,0 +1,177 @@
+/*
+
+Copyright 1991, 1993, 1994, 1998  The Open Group
+
+Permission to use, copy, modify, distribute, and sell this software and its
+documentation for any purpose is hereby granted without fee, provided that
+the above copyright notice appear in all copies and that both that
+copyright notice and this permission notice appear in supporting
+documentation.
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+OPEN GROUP BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+Except as contained in this notice, the name of The Open Group shall not be
+used in advertising or otherwise to promote the sale, use or other dealings
+in this Software without prior written authorization from The Open Group.
+
+*/
+
+#ifndef _SYNC_H_
+#define _SYNC_H_
+
+#include <X11/Xfuncproto.h>
+#include <X11/extensions/syncconst.h>
+
+_XFUNCPROTOBEGIN
+/*  The functions are only defined for the corresponding macros in syncconst.h */
+
+extern void XSyncIntToValue(
+    XSyncValue* /*pv*/,
+    int /*i*/
+);
+
+extern void XSyncIntsToValue(
+    XSyncValue* /*pv*/,
+    unsigned int /*l*/,
+    int /*h*/
+);
+
+extern Bool XSyncValueGreaterThan(
+    XSyncValue /*a*/,
+    XSyncValue /*b*/
+);
+
+extern Bool XSyncValueLessThan(
+    XSyncValue /*a*/,
+    XSyncValue /*b*/
+);
+
+extern Bool XSyncValueGreaterOrEqual(
+    XSyncValue /*a*/,
+    XSyncValue /*b*/
+);
+
+extern Bool XSyncValueLessOrEqual(
+    XSyncValue /*a*/,
+    XSyncValue /*b*/
+);
+
+extern Bool XSyncValueEqual(
+    XSyncValue /*a*/,
+    XSyncValue /*b*/
+);
+
+extern Bool XSyncValueIsNegative(
+    XSyncValue /*v*/
+);
+
+extern Bool XSyncValueIsZero(
+    XSyncValue /*a*/
+);
+
+extern Bool XSyncValueIsPositive(
+    XSyncValue /*v*/
+);
+
+extern unsigned int XSyncValueLow32(
+    XSyncValue /*v*/
+);
+
+extern int XSyncValueHigh32(
+    XSyncValue /*v*/
+);
+
+extern void XSyncValueAdd(
+    XSyncValue* /*presult*/,
+    XSyncValue /*a*/,
+    XSyncValue /*b*/,
+    int* /*poverflow*/
+);
+
+extern void XSyncValueSubtract(
+    XSyncValue* /*presult*/,
+    XSyncValue /*a*/,
+    XSyncValue /*b*/,
+    int* /*poverflow*/
+);
+
+extern void XSyncMaxValue(
+    XSyncValue* /*pv*/
+);
+
+extern void XSyncMinValue(
+    XSyncValue* /*pv*/
+);
+
+_XFUNCPROTOEND
+
+
+typedef struct _XSyncSystemCounter {
+    char *name;			/* null-terminated name of system counter */
+    XSyncCounter counter;	/* counter id of this system counter */
+    XSyncValue resolution;	/* resolution of this system counter */
+} XSyncSystemCounter;
+
+
+_XFUNCPROTOBEGIN
+
+extern Status XSyncQueryExtension(
+    Display* /*dpy*/,
+    int* /*event_base_return*/,
+    int* /*error_base_return*/
+);
+
+extern Status XSyncInitialize(
+    Display* /*dpy*/,
+    int* /*major_version_return*/,
+    int* /*minor_version_return*/
+);
+
+extern XSyncSystemCounter *XSyncListSystemCounters(
+    Display* /*dpy*/,
+    int* /*n_counters_return*/
+);
+
+extern void XSyncFreeSystemCounterList(
+    XSyncSystemCounter* /*list*/
+);
+
+extern XSyncCounter XSyncCreateCounter(
+    Display* /*dpy*/,
+    XSyncValue /*initial_value*/
+);
+
+extern Status XSyncSetCounter(
+    Display* /*dpy*/,
+    XSyncCounter /*counter*/,
+    XSyncValue /*value*/
+);
+
+extern Status XSyncChangeCounter(
+    Display* /*dpy*/,
+    XSyncCounter /*counter*/,
+    XSyncValue /*value*/
+);
+
+extern Status XSyncDestroyCounter(
+    Display* /*dpy*/,
+    XSyncCounter /*counter*/
+);
+
+extern Status XSyncQueryCounter(
+    Display* /*dpy*/,
+    XSyncCounter /*counter*/,
+    XSyncValue* /*value_return*/
+);
+
+_XFUNCPROTOEND
+
+#endif /* _SYNC_H_ */
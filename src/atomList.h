@@ -133,6 +133,8 @@ static const struct {
     ATOM_LIST_ENTRY(_NET_WM_USER_TIME),
     ATOM_LIST_ENTRY(_NET_WM_USER_TIME_WINDOW),
     ATOM_LIST_ENTRY(_NET_FRAME_EXTENTS),
+    ATOM_LIST_ENTRY(_NET_WM_SYNC_REQUEST),
+    ATOM_LIST_ENTRY(_NET_WM_SYNC_REQUEST_COUNTER),
 };
 
 #define PREDEFINED_ATOM_LIST_SIZE (sizeof(PredefinedAtomList) / sizeof(PredefinedAtomList[0]))
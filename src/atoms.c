@@ -124,7 +124,7 @@ Atom XInternAtom(Display* display, _Xconst char* atom_name, Bool only_if_exists)
                 preExistingIndex = i;
                 break;
             }
-        } while (PredefinedAtomList[i++].atom != _NET_FRAME_EXTENTS);
+        } while (PredefinedAtomList[i++].atom != _NET_LAST_PREDEFINED);
     }
     if (preExistingIndex >= 0) {
         return PredefinedAtomList[preExistingIndex].atom;
@@ -0,0 +1,166 @@
+#include <stdlib.h>
+#include "backingStore.h"
+#include "window.h"
+#include "windowClip.h"
+#include "drawing.h"
+#include "events.h"
+#include "present.h"
+#include "texturePool.h"
+#include "util.h"
+
+static size_t backingStoreLimit = (size_t) DEFAULT_BACKING_STORE_LIMIT * 1024 * 1024;
+static size_t backingStoreSize = 0;
+// Windows with saved content, the least recently saved first.
+static Array savedWindows = {NULL, 0, 0};
+
+void initBackingStoreConfig() {
+    char* limit = getenv(BACKING_STORE_LIMIT_ENV);
+    if (limit != NULL) {
+        long megabytes = strtol(limit, NULL, 10);
+        backingStoreLimit = megabytes > 0 ? (size_t) megabytes * 1024 * 1024 : 0;
+    }
+    LOG("Using a backing store limit of %lu bytes\n", (unsigned long) backingStoreLimit);
+}
+
+/*
+ * Drop the saved content of the window, if any.
+ */
+void freeBackingStore(Window window) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    BackingStore* store = windowStruct->savedContent;
+    if (store == NULL) return;
+    ssize_t index = findInArray(&savedWindows, (void*) window);
+    if (index != -1) {
+        removeArray(&savedWindows, (size_t) index, True);
+    }
+    backingStoreSize -= store->size;
+    SDL_FreeSurface(store->surface);
+    pixman_region_fini(&store->validRegion);
+    free(store);
+    windowStruct->savedContent = NULL;
+    if (savedWindows.length == 0) {
+        freeArray(&savedWindows);
+    }
+}
+
+/*
+ * Save the current content of the window, if it has backing store. Must be called before the
+ * window is changed, since the visible part of the window is the part that can be restored.
+ * Returns False if nothing was saved, e.g. because the content is larger than the limit.
+ */
+Bool saveBackingStore(Window window) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    freeBackingStore(window);
+    if (!HAS_BACKING_STORE(window) || IS_INPUT_ONLY(window) || backingStoreLimit == 0) {
+        return False;
+    }
+    pixman_region16_t* visibleRegion = getWindowClipRegion(window, True);
+    if (!pixman_region_not_empty(visibleRegion)) {
+        return False;
+    }
+    SDL_Renderer* renderer = getWindowRenderer(window);
+    if (renderer == NULL) {
+        return False;
+    }
+    SDL_Surface* surface = getRenderSurface(renderer);
+    if (surface == NULL) {
+        return False;
+    }
+    size_t size = (size_t) surface->h * (size_t) surface->pitch;
+    if (size > backingStoreLimit) {
+        LOG("The content of window %lu is too large for the backing store limit\n", window);
+        SDL_FreeSurface(surface);
+        return False;
+    }
+    while (backingStoreSize + size > backingStoreLimit && savedWindows.length > 0) {
+        freeBackingStore((Window) savedWindows.array[0]);
+    }
+    BackingStore* store = malloc(sizeof(BackingStore));
+    if (store == NULL || !insertArray(&savedWindows, (void*) window)) {
+        LOG("Out of memory: Failed to save the content of window %lu\n", window);
+        free(store);
+        SDL_FreeSurface(surface);
+        return False;
+    }
+    store->surface = surface;
+    store->size = size;
+    pixman_region_init(&store->validRegion);
+    pixman_region_copy(&store->validRegion, visibleRegion);
+    windowStruct->savedContent = store;
+    backingStoreSize += size;
+    return True;
+}
+
+/*
+ * Restore the saved content of the window into its visible part and drop it. Expose events are
+ * sent for the parts of the window that are visible now but could not be restored.
+ * Does nothing if the window has no saved content.
+ */
+void restoreBackingStore(Display* display, Window window) {
+    BackingStore* store = GET_WINDOW_STRUCT(window)->savedContent;
+    if (store == NULL) return;
+    pixman_region16_t* visibleRegion = getWindowClipRegion(window, True);
+    pixman_region16_t restoredRegion, exposedRegion;
+    pixman_region_init(&restoredRegion);
+    pixman_region_init(&exposedRegion);
+    pixman_region_intersect(&restoredRegion, &store->validRegion, visibleRegion);
+    int numBoxes, i;
+    pixman_box16_t* boxes = pixman_region_rectangles(&restoredRegion, &numBoxes);
+    if (numBoxes > 0) {
+        SDL_Renderer* renderer = getWindowRenderer(window);
+        SDL_Texture* texture = renderer != NULL ? acquireSurfaceTexture(renderer, store->surface) : NULL;
+        if (texture == NULL) {
+            LOG("Failed to restore the content of window %lu: %s\n", window, SDL_GetError());
+            pixman_region_clear(&restoredRegion);
+        } else {
+            SDL_Rect srcRect = {0, 0, store->surface->w, store->surface->h};
+            SDL_Rect destRect = {0, 0, TO_LOGICAL(store->surface->w), TO_LOGICAL(store->surface->h)};
+            SDL_Rect clipRect;
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+            for (i = 0; i < numBoxes; i++) {
+                clipRect.x = boxes[i].x1;
+                clipRect.y = boxes[i].y1;
+                clipRect.w = boxes[i].x2 - boxes[i].x1;
+                clipRect.h = boxes[i].y2 - boxes[i].y1;
+                SDL_RenderSetClipRect(renderer, &clipRect);
+                SDL_RenderCopy(renderer, texture, &srcRect, &destRect);
+            }
+            SDL_RenderSetClipRect(renderer, NULL);
+            releaseTexture(renderer, texture);
+            markWindowContentChanged(window);
+        }
+    }
+    freeBackingStore(window);
+    pixman_region_subtract(&exposedRegion, visibleRegion, &restoredRegion);
+    boxes = pixman_region_rectangles(&exposedRegion, &numBoxes);
+    SDL_Rect* exposedRects = numBoxes > 0 ? malloc(sizeof(SDL_Rect) * numBoxes) : NULL;
+    if (exposedRects != NULL) {
+        for (i = 0; i < numBoxes; i++) {
+            exposedRects[i].x = boxes[i].x1;
+            exposedRects[i].y = boxes[i].y1;
+            exposedRects[i].w = boxes[i].x2 - boxes[i].x1;
+            exposedRects[i].h = boxes[i].y2 - boxes[i].y1;
+        }
+        postExposeEvent(display, window, exposedRects, (size_t) numBoxes);
+        free(exposedRects);
+    } else if (numBoxes > 0) {
+        SDL_Rect windowRect = {0, 0, 0, 0};
+        GET_WINDOW_DIMS(window, windowRect.w, windowRect.h);
+        postExposeEvent(display, window, &windowRect, 1);
+    }
+    markWindowExposed(window);
+    pixman_region_fini(&restoredRegion);
+    pixman_region_fini(&exposedRegion);
+}
+
+/*
+ * Check if the content of the window is kept while it is not visible, because the
+ * window that owns its render target has backing store.
+ */
+Bool isContentPreserved(Window window) {
+    while (GET_PARENT(window) != None && GET_WINDOW_STRUCT(window)->sdlWindow == NULL
+           && GET_WINDOW_STRUCT(window)->mapState != UnMapped) {
+        window = GET_PARENT(window);
+    }
+    return window != SCREEN_WINDOW && HAS_BACKING_STORE(window);
+}
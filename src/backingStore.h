@@ -0,0 +1,39 @@
+#ifndef _BACKING_STORE_H_
+#define _BACKING_STORE_H_
+
+#include <SDL2/SDL.h>
+#include <pixman.h>
+#include <X11/Xlib.h>
+
+/*
+ * Backing store for windows with a backing_store attribute of WhenMapped or Always:
+ * Their content (including the content of their inferiors) is saved before they are moved,
+ * resized or unmapped and restored afterwards, instead of exposing them. Only the parts that
+ * were visible when the content was saved can be restored, the rest is still exposed.
+ * Top level windows with backing store are also drawn into while they are minimized,
+ * so they don't need to be exposed once they are restored.
+ * The saved content is accounted against a memory limit,
+ * the least recently saved content is dropped when the limit is reached.
+ */
+
+/* Environment variable with the memory limit for saved window content in MiB, 0 disables backing store. */
+#define BACKING_STORE_LIMIT_ENV "SDL2X11_BACKING_STORE_LIMIT"
+#define DEFAULT_BACKING_STORE_LIMIT 64
+
+typedef struct {
+    /* The content of the window in device pixels. */
+    SDL_Surface* surface;
+    /* The part of the content that was visible when it was saved, in window coordinates. */
+    pixman_region16_t validRegion;
+    size_t size;
+} BackingStore;
+
+#define HAS_BACKING_STORE(window) (GET_WINDOW_STRUCT(window)->backingStore != NotUseful)
+
+void initBackingStoreConfig(void);
+Bool saveBackingStore(Window window);
+void restoreBackingStore(Display* display, Window window);
+void freeBackingStore(Window window);
+Bool isContentPreserved(Window window);
+
+#endif /* _BACKING_STORE_H_ */
@@ -0,0 +1,335 @@
+#include <math.h>
+#include "bitmap.h"
+#include "drawing.h"
+#include "damage.h"
+#include "util.h"
+
+#define SET_BITMAP_BIT(pixmapStruct, x, y, value) \
+if (value) {\
+    (pixmapStruct)->bits[(y) * (pixmapStruct)->bitsPitch + ((x) >> 3)] |= (Uint8) (1 << ((x) & 7));\
+} else {\
+    (pixmapStruct)->bits[(y) * (pixmapStruct)->bitsPitch + ((x) >> 3)] &= (Uint8) ~(1 << ((x) & 7));\
+}
+
+/* A cached texture of a bitmap, see getBitmapTexture. */
+typedef struct BitmapTexture {
+    PixmapStruct* bitmap;
+    SDL_Renderer* renderer;
+    SDL_Texture* texture;
+    /* The bitsVersion of the bitmap the texture was last updated to. */
+    Uint32 version;
+    struct BitmapTexture* nextOfBitmap;
+    /* All cached textures of all bitmaps, so they can be freed per renderer. */
+    struct BitmapTexture* previous;
+    struct BitmapTexture* next;
+} BitmapTexture;
+
+static BitmapTexture* cachedTextures = NULL;
+
+static void freeCachedTexture(BitmapTexture* cachedTexture) {
+    BitmapTexture** link = &cachedTexture->bitmap->bitsTextures;
+    while (*link != cachedTexture) {
+        link = &(*link)->nextOfBitmap;
+    }
+    *link = cachedTexture->nextOfBitmap;
+    if (cachedTexture->previous != NULL) {
+        cachedTexture->previous->next = cachedTexture->next;
+    } else {
+        cachedTextures = cachedTexture->next;
+    }
+    if (cachedTexture->next != NULL) {
+        cachedTexture->next->previous = cachedTexture->previous;
+    }
+    SDL_DestroyTexture(cachedTexture->texture);
+    free(cachedTexture);
+}
+
+Bool initBitmapStorage(PixmapStruct* pixmapStruct) {
+    pixmapStruct->bitsPitch = (int) (pixmapStruct->width + 7) / 8;
+    pixmapStruct->bits = calloc((size_t) pixmapStruct->bitsPitch * pixmapStruct->height, sizeof(Uint8));
+    pixmapStruct->bitsTextures = NULL;
+    pixmapStruct->bitsVersion = 0;
+    return pixmapStruct->bits != NULL;
+}
+
+void freeBitmapStorage(PixmapStruct* pixmapStruct) {
+    while (pixmapStruct->bitsTextures != NULL) {
+        freeCachedTexture(pixmapStruct->bitsTextures);
+    }
+    free(pixmapStruct->bits);
+    pixmapStruct->bits = NULL;
+}
+
+static Bool clipToBitmap(PixmapStruct* pixmapStruct, const SDL_Rect* rect, SDL_Rect* result) {
+    SDL_Rect bitmapRect = {0, 0, (int) pixmapStruct->width, (int) pixmapStruct->height};
+    return SDL_IntersectRect(rect, &bitmapRect, result);
+}
+
+static void initBitmapRasterFrame(RasterFrame* frame, PixmapStruct* pixmapStruct) {
+    initRasterFrame(frame, pixmapStruct->bits, pixmapStruct->bitsPitch, (int) pixmapStruct->width,
+                    (int) pixmapStruct->height, True);
+}
+
+void fillBitmapRectangles(Pixmap bitmap, const SDL_Rect* rectangles, int numRectangles, int value) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    RasterFrame frame;
+    initBitmapRasterFrame(&frame, pixmapStruct);
+    if (!rasterFillRectangles(&frame, rectangles, numRectangles, (Uint32) value) || !flushRasterFrame(&frame)) {
+        LOG("Failed to fill the rectangles of bitmap %lu in %s\n", bitmap, __func__);
+    }
+    freeRasterFrame(&frame);
+    pixmapStruct->bitsVersion++;
+    int i;
+    for (i = 0; i < numRectangles; i++) {
+        reportDamage(bitmap, &rectangles[i]);
+    }
+}
+
+void fillBitmapPolygon(Pixmap bitmap, const RasterPoint* points, int numPoints, int fillRule, int value) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    RasterFrame frame;
+    initBitmapRasterFrame(&frame, pixmapStruct);
+    if (!rasterFillPolygon(&frame, points, numPoints, fillRule, (Uint32) value) || !flushRasterFrame(&frame)) {
+        LOG("Failed to fill a polygon into bitmap %lu in %s\n", bitmap, __func__);
+    }
+    freeRasterFrame(&frame);
+    pixmapStruct->bitsVersion++;
+    if (numPoints > 0) {
+        float minX = points[0].x, minY = points[0].y, maxX = points[0].x, maxY = points[0].y;
+        int i;
+        for (i = 1; i < numPoints; i++) {
+            minX = MIN(minX, points[i].x);
+            minY = MIN(minY, points[i].y);
+            maxX = MAX(maxX, points[i].x);
+            maxY = MAX(maxY, points[i].y);
+        }
+        SDL_Rect bounds = {(int) floorf(minX), (int) floorf(minY), 0, 0};
+        bounds.w = (int) ceilf(maxX) - bounds.x;
+        bounds.h = (int) ceilf(maxY) - bounds.y;
+        reportDamage(bitmap, &bounds);
+    }
+}
+
+void drawBitmapLines(Pixmap bitmap, const SDL_Point* points, int numPoints, int value) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    int i;
+    for (i = 1; i < numPoints; i++) {
+        // Bresenham, clipping every single point.
+        int x = points[i - 1].x, y = points[i - 1].y;
+        int dx = abs(points[i].x - x), dy = -abs(points[i].y - y);
+        int stepX = x < points[i].x ? 1 : -1, stepY = y < points[i].y ? 1 : -1;
+        int error = dx + dy, error2;
+        while (True) {
+            if (x >= 0 && y >= 0 && x < (int) pixmapStruct->width && y < (int) pixmapStruct->height) {
+                SET_BITMAP_BIT(pixmapStruct, x, y, value);
+            }
+            if (x == points[i].x && y == points[i].y) break;
+            error2 = 2 * error;
+            if (error2 >= dy) {
+                error += dy;
+                x += stepX;
+            }
+            if (error2 <= dx) {
+                error += dx;
+                y += stepY;
+            }
+        }
+        SDL_Rect lineBounds = {MIN(points[i - 1].x, points[i].x), MIN(points[i - 1].y, points[i].y), 0, 0};
+        lineBounds.w = abs(points[i].x - points[i - 1].x) + 1;
+        lineBounds.h = abs(points[i].y - points[i - 1].y) + 1;
+        reportDamage(bitmap, &lineBounds);
+    }
+    pixmapStruct->bitsVersion++;
+}
+
+/*
+ * Draw every pixel of the surface which is at least half opaque into the bitmap.
+ */
+void drawBitmapSurface(Pixmap bitmap, SDL_Surface* surface, int x, int y, int value) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    RasterFrame frame;
+    initBitmapRasterFrame(&frame, pixmapStruct);
+    SDL_LockSurface(surface);
+    if (!rasterCompositeSurface(&frame, surface, x, y, (Uint32) value) || !flushRasterFrame(&frame)) {
+        LOG("Failed to draw a surface into bitmap %lu in %s\n", bitmap, __func__);
+    }
+    SDL_UnlockSurface(surface);
+    freeRasterFrame(&frame);
+    pixmapStruct->bitsVersion++;
+    SDL_Rect bounds = {x, y, surface->w, surface->h};
+    reportDamage(bitmap, &bounds);
+}
+
+void copyBitmapArea(Pixmap src, Pixmap dest, const SDL_Rect* srcRect, int destX, int destY) {
+    PixmapStruct* srcStruct = GET_PIXMAP_STRUCT(src);
+    PixmapStruct* destStruct = GET_PIXMAP_STRUCT(dest);
+    SDL_Rect rect, destRect;
+    int x, y, i, originX, originY;
+    if (!clipToBitmap(srcStruct, srcRect, &rect)) return;
+    originX = destRect.x = destX + rect.x - srcRect->x;
+    originY = destRect.y = destY + rect.y - srcRect->y;
+    destRect.w = rect.w;
+    destRect.h = rect.h;
+    if (!clipToBitmap(destStruct, &destRect, &destRect)) return;
+    rect.x += destRect.x - originX;
+    rect.y += destRect.y - originY;
+    Uint8 rowBits[destRect.w];
+    // Copying within the same bitmap downwards must start at the bottom.
+    Bool bottomUp = src == dest && destRect.y > rect.y;
+    for (i = 0; i < destRect.h; i++) {
+        y = bottomUp ? destRect.h - 1 - i : i;
+        for (x = 0; x < destRect.w; x++) {
+            rowBits[x] = GET_BITMAP_BIT(srcStruct, rect.x + x, rect.y + y);
+        }
+        for (x = 0; x < destRect.w; x++) {
+            SET_BITMAP_BIT(destStruct, destRect.x + x, destRect.y + y, rowBits[x]);
+        }
+    }
+    destStruct->bitsVersion++;
+    reportDamage(dest, &destRect);
+}
+
+#define GET_IMAGE_BIT(data, bytesPerLine, msbFirst, x, y) \
+    (((data)[(y) * (bytesPerLine) + ((x) >> 3)] >> ((msbFirst) ? 7 - ((x) & 7) : ((x) & 7))) & 1)
+
+/*
+ * Copy an area of packed client bits (with bytesPerLine bytes per row, in the given bit order)
+ * into the bitmap at the destination position.
+ */
+void putBitmapBits(Pixmap bitmap, const Uint8* data, int bytesPerLine, Bool msbFirst,
+                   const SDL_Rect* srcRect, int destX, int destY) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    SDL_Rect destRect = {destX, destY, srcRect->w, srcRect->h};
+    int x, y;
+    if (!clipToBitmap(pixmapStruct, &destRect, &destRect)) return;
+    int srcX = srcRect->x + destRect.x - destX;
+    int srcY = srcRect->y + destRect.y - destY;
+    for (y = 0; y < destRect.h; y++) {
+        for (x = 0; x < destRect.w; x++) {
+            SET_BITMAP_BIT(pixmapStruct, destRect.x + x, destRect.y + y,
+                           GET_IMAGE_BIT(data, bytesPerLine, msbFirst, srcX + x, srcY + y));
+        }
+    }
+    pixmapStruct->bitsVersion++;
+    reportDamage(bitmap, &destRect);
+}
+
+/*
+ * Copy an area of the bitmap into packed client bits with bytesPerLine bytes per row,
+ * in the given bit order. The area must be inside of the bitmap.
+ */
+void getBitmapBits(Pixmap bitmap, const SDL_Rect* area, Uint8* data, int bytesPerLine, Bool msbFirst) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    int x, y;
+    for (y = 0; y < area->h; y++) {
+        Uint8* row = data + y * bytesPerLine;
+        memset(row, 0, (size_t) (area->w + 7) / 8);
+        for (x = 0; x < area->w; x++) {
+            if (GET_BITMAP_BIT(pixmapStruct, area->x + x, area->y + y)) {
+                row[x >> 3] |= (Uint8) (1 << (msbFirst ? 7 - (x & 7) : (x & 7)));
+            }
+        }
+    }
+}
+
+static void expandBitmapBits(PixmapStruct* pixmapStruct, const SDL_Rect* area, Uint32* pixels, int pitch) {
+    int x, y;
+    for (y = 0; y < area->h; y++) {
+        Uint32* row = (Uint32*) ((Uint8*) pixels + y * pitch);
+        for (x = 0; x < area->w; x++) {
+            row[x] = GET_BITMAP_BIT(pixmapStruct, area->x + x, area->y + y) ? 0xFFFFFFFF : 0;
+        }
+    }
+}
+
+/*
+ * Get the given area of the bitmap as a surface in the native format,
+ * with set bits as opaque white and cleared bits as transparent black.
+ */
+SDL_Surface* getBitmapSurface(Pixmap bitmap, const SDL_Rect* area) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    SDL_Rect rect = {0, 0, (int) pixmapStruct->width, (int) pixmapStruct->height};
+    if (area != NULL && !clipToBitmap(pixmapStruct, area, &rect)) {
+        return NULL;
+    }
+    SDL_Surface* surface = SDL_CreateRGBSurface(0, rect.w, rect.h, SDL_SURFACE_DEPTH,
+                                                DEFAULT_RED_MASK, DEFAULT_GREEN_MASK,
+                                                DEFAULT_BLUE_MASK, DEFAULT_ALPHA_MASK);
+    if (surface == NULL) {
+        LOG("SDL_CreateRGBSurface failed in %s: %s\n", __func__, SDL_GetError());
+        return NULL;
+    }
+    SDL_LockSurface(surface);
+    expandBitmapBits(pixmapStruct, &rect, surface->pixels, surface->pitch);
+    SDL_UnlockSurface(surface);
+    return surface;
+}
+
+/*
+ * Get a texture of the bitmap for the renderer. Set bits are opaque white and cleared bits are
+ * transparent, so the texture can be colored with SDL_SetTextureColorMod and used as a mask.
+ * The texture is cached per renderer and only updated if the bitmap was drawn onto since the
+ * last call. It stays valid until the bitmap is freed or freeBitmapTextures is called for the renderer.
+ */
+SDL_Texture* getBitmapTexture(Pixmap bitmap, SDL_Renderer* renderer) {
+    PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+    BitmapTexture* cachedTexture = pixmapStruct->bitsTextures;
+    while (cachedTexture != NULL && cachedTexture->renderer != renderer) {
+        cachedTexture = cachedTexture->nextOfBitmap;
+    }
+    if (cachedTexture == NULL) {
+        cachedTexture = malloc(sizeof(BitmapTexture));
+        if (cachedTexture == NULL) {
+            LOG("Out of memory: Failed to allocate the cached texture in %s\n", __func__);
+            return NULL;
+        }
+        // Opaque white is all bits set in every 32 bit format, as long as it has an alpha channel.
+        Uint32 format = DEFAULT_ALPHA_MASK != 0 ? DEFAULT_TEXTURE_FORMAT : SDL_PIXELFORMAT_ARGB8888;
+        cachedTexture->texture = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_STREAMING,
+                                                   (int) pixmapStruct->width, (int) pixmapStruct->height);
+        if (cachedTexture->texture == NULL) {
+            LOG("SDL_CreateTexture failed in %s: %s\n", __func__, SDL_GetError());
+            free(cachedTexture);
+            return NULL;
+        }
+        SDL_SetTextureBlendMode(cachedTexture->texture, SDL_BLENDMODE_BLEND);
+        cachedTexture->bitmap = pixmapStruct;
+        cachedTexture->renderer = renderer;
+        cachedTexture->version = pixmapStruct->bitsVersion - 1;
+        cachedTexture->nextOfBitmap = pixmapStruct->bitsTextures;
+        pixmapStruct->bitsTextures = cachedTexture;
+        cachedTexture->previous = NULL;
+        cachedTexture->next = cachedTextures;
+        if (cachedTextures != NULL) {
+            cachedTextures->previous = cachedTexture;
+        }
+        cachedTextures = cachedTexture;
+    }
+    if (cachedTexture->version != pixmapStruct->bitsVersion) {
+        void* pixels;
+        int pitch;
+        SDL_Rect rect = {0, 0, (int) pixmapStruct->width, (int) pixmapStruct->height};
+        if (SDL_LockTexture(cachedTexture->texture, NULL, &pixels, &pitch) != 0) {
+            LOG("SDL_LockTexture failed in %s: %s\n", __func__, SDL_GetError());
+            return NULL;
+        }
+        expandBitmapBits(pixmapStruct, &rect, pixels, pitch);
+        SDL_UnlockTexture(cachedTexture->texture);
+        cachedTexture->version = pixmapStruct->bitsVersion;
+    }
+    return cachedTexture->texture;
+}
+
+/*
+ * Destroy the cached textures of all bitmaps for the renderer.
+ */
+void freeBitmapTextures(SDL_Renderer* renderer) {
+    BitmapTexture* cachedTexture = cachedTextures;
+    while (cachedTexture != NULL) {
+        BitmapTexture* next = cachedTexture->next;
+        if (cachedTexture->renderer == renderer) {
+            freeCachedTexture(cachedTexture);
+        }
+        cachedTexture = next;
+    }
+}
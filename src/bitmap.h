@@ -0,0 +1,33 @@
+#ifndef _BITMAP_H_
+#define _BITMAP_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+#include "pixmap.h"
+#include "raster.h"
+
+/*
+ * Depth 1 pixmaps (bitmaps) are stored as packed bits in system memory, eight pixels per byte
+ * with the least significant bit first (the same layout as XBM data). Textures of them are
+ * only created when they are needed for rendering and are cached per renderer until the bits change.
+ */
+
+#define IS_BITMAP(pixmap) (IS_TYPE(pixmap, PIXMAP) && GET_PIXMAP_STRUCT(pixmap)->depth == 1)
+#define GET_BITMAP_BIT(pixmapStruct, x, y) \
+    (((pixmapStruct)->bits[(y) * (pixmapStruct)->bitsPitch + ((x) >> 3)] >> ((x) & 7)) & 1)
+
+Bool initBitmapStorage(PixmapStruct* pixmapStruct);
+void freeBitmapStorage(PixmapStruct* pixmapStruct);
+void fillBitmapRectangles(Pixmap bitmap, const SDL_Rect* rectangles, int numRectangles, int value);
+void fillBitmapPolygon(Pixmap bitmap, const RasterPoint* points, int numPoints, int fillRule, int value);
+void drawBitmapLines(Pixmap bitmap, const SDL_Point* points, int numPoints, int value);
+void drawBitmapSurface(Pixmap bitmap, SDL_Surface* surface, int x, int y, int value);
+void copyBitmapArea(Pixmap src, Pixmap dest, const SDL_Rect* srcRect, int destX, int destY);
+void putBitmapBits(Pixmap bitmap, const Uint8* data, int bytesPerLine, Bool msbFirst,
+                   const SDL_Rect* srcRect, int destX, int destY);
+void getBitmapBits(Pixmap bitmap, const SDL_Rect* area, Uint8* data, int bytesPerLine, Bool msbFirst);
+SDL_Surface* getBitmapSurface(Pixmap bitmap, const SDL_Rect* area);
+SDL_Texture* getBitmapTexture(Pixmap bitmap, SDL_Renderer* renderer);
+void freeBitmapTextures(SDL_Renderer* renderer);
+
+#endif /* _BITMAP_H_ */
@@ -0,0 +1,299 @@
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <X11/Xutil.h>
+#include "bitmapFile.h"
+#include "stdBitmaps.h"
+#include "errors.h"
+
+/* The directory the standard bitmaps are installed in, below the installation prefix. */
+#define STANDARD_BITMAP_DIRECTORY "include/X11/bitmaps"
+
+typedef struct {
+    /* The path of the file, NULL marks an unused entry. */
+    char* path;
+    /* The modification time and size of the file when it was parsed. */
+    time_t modificationTime;
+    off_t size;
+    BitmapData bitmap;
+    Uint8* bits;
+} CachedBitmap;
+
+static CachedBitmap bitmapCache[BITMAP_CACHE_SIZE];
+static int nextCacheEntry = 0;
+
+static int compareStandardBitmap(const void* name, const void* entry) {
+    return strcmp((const char*) name, ((const StdBitmapEntry*) entry)->name);
+}
+
+/*
+ * Get the compiled-in standard bitmap with the name, which is the name of its file in include/X11/bitmaps.
+ */
+Bool getStandardBitmap(const char* name, BitmapData* bitmap) {
+    const StdBitmapEntry* entry = bsearch(name, STANDARD_BITMAPS, NUM_STANDARD_BITMAPS,
+                                          sizeof(STANDARD_BITMAPS[0]), compareStandardBitmap);
+    if (entry == NULL) {
+        return False;
+    }
+    bitmap->width = entry->width;
+    bitmap->height = entry->height;
+    bitmap->xHot = entry->xHot;
+    bitmap->yHot = entry->yHot;
+    bitmap->bits = STANDARD_BITMAP_BITS + entry->offset;
+    return True;
+}
+
+static int getHexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static Bool isWordCharacter(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static Bool hasSuffix(const char* word, size_t length, const char* suffix) {
+    size_t suffixLength = strlen(suffix);
+    return length >= suffixLength && memcmp(word + length - suffixLength, suffix, suffixLength) == 0;
+}
+
+/*
+ * Parse a decimal or hexadecimal number and advance the position behind it.
+ */
+static Bool parseNumber(const char** position, const char* end, long* value) {
+    const char* p = *position;
+    Bool negative = False;
+    int base = 10, digit, digits = 0;
+    if (p < end && *p == '-') {
+        negative = True;
+        p++;
+    }
+    if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        base = 16;
+        p += 2;
+    }
+    *value = 0;
+    for (; p < end && (digit = getHexValue(*p)) >= 0 && digit < base && *value < 0x1000000; p++, digits++) {
+        *value = *value * base + digit;
+    }
+    if (negative) *value = -*value;
+    *position = p;
+    return digits > 0;
+}
+
+/*
+ * Parse the text of an XBM file (or of an X10 bitmap file, which consists of 16 bit values).
+ * On success, the bits of the bitmap are allocated with malloc and are returned in bits.
+ */
+int parseBitmapData(const char* text, size_t length, BitmapData* bitmap, Uint8** bits) {
+    const char* p = text;
+    const char* end = text + length;
+    long width = 0, height = 0, xHot = -1, yHot = -1, value;
+    Bool x10Format = False;
+    // The header consists of the defines for the size and the hot spot and the declaration of the array.
+    while (p < end && *p != '{') {
+        if (*p == '/' && end - p > 1 && p[1] == '*') {
+            for (p += 2; p < end && !(*p == '*' && end - p > 1 && p[1] == '/'); p++);
+            p = p < end ? p + 2 : end;
+        } else if (*p == '#' && end - p > 7 && memcmp(p, "#define", 7) == 0) {
+            const char* name;
+            for (p += 7; p < end && (*p == ' ' || *p == '\t'); p++);
+            for (name = p; p < end && isWordCharacter(*p); p++);
+            size_t nameLength = (size_t) (p - name);
+            for (; p < end && (*p == ' ' || *p == '\t'); p++);
+            if (!parseNumber(&p, end, &value)) continue;
+            if (hasSuffix(name, nameLength, "_width")) {
+                width = value;
+            } else if (hasSuffix(name, nameLength, "_height")) {
+                height = value;
+            } else if (hasSuffix(name, nameLength, "_x_hot")) {
+                xHot = value;
+            } else if (hasSuffix(name, nameLength, "_y_hot")) {
+                yHot = value;
+            }
+        } else if (isWordCharacter(*p)) {
+            const char* word = p;
+            for (; p < end && isWordCharacter(*p); p++);
+            if (p - word == 5 && memcmp(word, "short", 5) == 0) {
+                x10Format = True;
+            }
+        } else {
+            p++;
+        }
+    }
+    if (p >= end || width <= 0 || height <= 0) {
+        return BitmapFileInvalid;
+    }
+    size_t bytesPerLine = ((size_t) width + 7) / 8;
+    // Rows of X10 bitmaps are padded to 16 bits, the padding byte is dropped.
+    size_t valuesPerLine = x10Format ? ((size_t) width + 15) / 16 : bytesPerLine;
+    size_t numValues = valuesPerLine * (size_t) height, i;
+    Uint8* data = malloc(bytesPerLine * (size_t) height);
+    if (data == NULL) {
+        return BitmapNoMemory;
+    }
+    for (i = 0; i < numValues; i++) {
+        for (; p < end && !(*p == '0' && end - p > 1 && (p[1] == 'x' || p[1] == 'X')); p++) {
+            if (*p == '}') break;
+        }
+        if (p >= end || *p == '}' || !parseNumber(&p, end, &value)) {
+            free(data);
+            return BitmapFileInvalid;
+        }
+        if (x10Format) {
+            size_t offset = i / valuesPerLine * bytesPerLine + i % valuesPerLine * 2;
+            data[offset] = (Uint8) value;
+            if (i % valuesPerLine * 2 + 1 < bytesPerLine) {
+                data[offset + 1] = (Uint8) (value >> 8);
+            }
+        } else {
+            data[i] = (Uint8) value;
+        }
+    }
+    bitmap->width = (unsigned int) width;
+    bitmap->height = (unsigned int) height;
+    bitmap->xHot = (int) xHot;
+    bitmap->yHot = (int) yHot;
+    bitmap->bits = data;
+    *bits = data;
+    return BitmapSuccess;
+}
+
+/*
+ * Get the name of the file if the path ends in the directory followed by the name,
+ * where the directory is either the start of the path or follows a '/'.
+ */
+static const char* getNameInDirectory(const char* filename, const char* directory) {
+    const char* name = strrchr(filename, '/');
+    size_t length = strlen(directory);
+    if (name == NULL || (size_t) (name - filename) < length || strncmp(name - length, directory, length) != 0
+        || ((size_t) (name - filename) > length && *(name - length - 1) != '/')) {
+        return NULL;
+    }
+    return name + 1;
+}
+
+/*
+ * Get the standard bitmap for a file in a bitmaps directory which can't be opened,
+ * e.g. because the application refers to the standard bitmaps of a system without X11.
+ */
+static int getMissingBitmapFile(const char* filename, BitmapData* bitmap) {
+    const char* name = getNameInDirectory(filename, "bitmaps");
+    if (name != NULL && getStandardBitmap(name, bitmap)) {
+        return BitmapSuccess;
+    }
+    LOG("Failed to open bitmap file %s in %s\n", filename, __func__);
+    return BitmapOpenFailed;
+}
+
+static CachedBitmap* findCachedBitmap(const char* filename) {
+    int i;
+    for (i = 0; i < BITMAP_CACHE_SIZE; i++) {
+        if (bitmapCache[i].path != NULL && strcmp(bitmapCache[i].path, filename) == 0) {
+            return &bitmapCache[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Load the bitmap from the XBM file. The bits of the bitmap stay valid until the next call.
+ * Returns one of the result codes of XReadBitmapFile.
+ */
+int loadBitmapFile(const char* filename, BitmapData* bitmap) {
+    const char* name = getNameInDirectory(filename, STANDARD_BITMAP_DIRECTORY);
+    if (name != NULL && getStandardBitmap(name, bitmap)) {
+        return BitmapSuccess;
+    }
+    struct stat fileStatus;
+    if (stat(filename, &fileStatus) != 0) {
+        return getMissingBitmapFile(filename, bitmap);
+    }
+    CachedBitmap* entry = findCachedBitmap(filename);
+    if (entry != NULL && entry->modificationTime == fileStatus.st_mtime && entry->size == fileStatus.st_size) {
+        *bitmap = entry->bitmap;
+        return BitmapSuccess;
+    }
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL) {
+        return getMissingBitmapFile(filename, bitmap);
+    }
+    char* text = NULL;
+    size_t length = 0, capacity = 0, count;
+    do {
+        if (length == capacity) {
+            capacity = capacity == 0 ? 4096 : capacity * 2;
+            char* newText = realloc(text, capacity);
+            if (newText == NULL) {
+                free(text);
+                fclose(file);
+                return BitmapNoMemory;
+            }
+            text = newText;
+        }
+        count = fread(text + length, 1, capacity - length, file);
+        length += count;
+    } while (count > 0);
+    fclose(file);
+    Uint8* bits;
+    int result = parseBitmapData(text, length, bitmap, &bits);
+    free(text);
+    if (result != BitmapSuccess) {
+        LOG("Failed to parse bitmap file %s in %s\n", filename, __func__);
+        return result;
+    }
+    if (entry == NULL) {
+        entry = &bitmapCache[nextCacheEntry];
+        nextCacheEntry = (nextCacheEntry + 1) % BITMAP_CACHE_SIZE;
+        free(entry->path);
+        entry->path = strdup(filename);
+    }
+    free(entry->bits);
+    entry->modificationTime = fileStatus.st_mtime;
+    entry->size = fileStatus.st_size;
+    entry->bitmap = *bitmap;
+    entry->bits = bits;
+    return BitmapSuccess;
+}
+
+int XReadBitmapFileData(_Xconst char* filename, unsigned int* width_return, unsigned int* height_return,
+                        unsigned char** data_return, int* x_hot_return, int* y_hot_return) {
+    // https://tronche.com/gui/x/xlib/utilities/XReadBitmapFileData.html
+    BitmapData bitmap;
+    int result = loadBitmapFile(filename, &bitmap);
+    if (result != BitmapSuccess) {
+        return result;
+    }
+    size_t size = (bitmap.width + 7) / 8 * (size_t) bitmap.height;
+    *data_return = malloc(size);
+    if (*data_return == NULL) {
+        return BitmapNoMemory;
+    }
+    memcpy(*data_return, bitmap.bits, size);
+    *width_return = bitmap.width;
+    *height_return = bitmap.height;
+    if (x_hot_return != NULL) *x_hot_return = bitmap.xHot;
+    if (y_hot_return != NULL) *y_hot_return = bitmap.yHot;
+    return BitmapSuccess;
+}
+
+int XReadBitmapFile(Display* display, Drawable d, _Xconst char* filename, unsigned int* width_return,
+                    unsigned int* height_return, Pixmap* bitmap_return, int* x_hot_return, int* y_hot_return) {
+    // https://tronche.com/gui/x/xlib/utilities/XReadBitmapFile.html
+    BitmapData bitmap;
+    int result = loadBitmapFile(filename, &bitmap);
+    if (result != BitmapSuccess) {
+        return result;
+    }
+    *bitmap_return = XCreateBitmapFromData(display, d, (_Xconst char*) bitmap.bits, bitmap.width, bitmap.height);
+    if (*bitmap_return == None) {
+        return BitmapNoMemory;
+    }
+    *width_return = bitmap.width;
+    *height_return = bitmap.height;
+    if (x_hot_return != NULL) *x_hot_return = bitmap.xHot;
+    if (y_hot_return != NULL) *y_hot_return = bitmap.yHot;
+    return BitmapSuccess;
+}
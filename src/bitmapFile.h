@@ -0,0 +1,31 @@
+#ifndef _BITMAP_FILE_H_
+#define _BITMAP_FILE_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+
+/*
+ * Loading of bitmaps in the XBM format. The bitmaps in include/X11/bitmaps are compiled in
+ * (see stdBitmaps.h) and are used for any path that ends in include/X11/bitmaps/<name>,
+ * without touching the file system. Other paths that end in bitmaps/<name> only get
+ * the compiled-in bitmap if the file can't be opened. Other files are parsed in a single pass,
+ * and the result is cached by path, modification time and size,
+ * so loading the same bitmap again only costs a stat.
+ */
+
+/* The maximum number of parsed bitmap files which are kept. */
+#define BITMAP_CACHE_SIZE 32
+
+typedef struct {
+    unsigned int width, height;
+    /* The hot spot, -1 if the bitmap has none. */
+    int xHot, yHot;
+    /* The bits in the XBM layout, which is also the layout of the bits of a bitmap (see bitmap.h). */
+    const Uint8* bits;
+} BitmapData;
+
+Bool getStandardBitmap(const char* name, BitmapData* bitmap);
+int parseBitmapData(const char* text, size_t length, BitmapData* bitmap, Uint8** bits);
+int loadBitmapFile(const char* filename, BitmapData* bitmap);
+
+#endif /* _BITMAP_FILE_H_ */
@@ -0,0 +1,166 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "capture.h"
+#include "drawing.h"
+#include "renderThread.h"
+#include "resourceTypes.h"
+#include "window.h"
+#include "util.h"
+
+typedef struct {
+    Drawable drawable;
+    Bool frame;
+    Bool hasArea;
+    SDL_Rect area;
+    Uint32 format;
+    SDL_Surface** surfaceReturn;
+} CaptureRequest;
+
+static char* captureDir = NULL;
+static Bool captureAsBMP = False;
+static Uint32 capturedFrames = 0;
+
+void initCaptureConfig() {
+    captureDir = getenv(CAPTURE_DIR_ENV);
+    if (captureDir != NULL && captureDir[0] == '\0') {
+        captureDir = NULL;
+    }
+    char* format = getenv(CAPTURE_FORMAT_ENV);
+    captureAsBMP = format != NULL && strcmp(format, "bmp") == 0;
+    if (captureDir != NULL) {
+        LOG("Dumping presented frames as %s into %s\n", captureAsBMP ? "bmp" : "ppm", captureDir);
+    }
+}
+
+/*
+ * Get the top level window whose frame contains the window, or None if it has no real window.
+ */
+static Window getFrameWindow(Window window) {
+    while (window != SCREEN_WINDOW && !IS_TOP_LEVEL(window)) {
+        window = GET_PARENT(window);
+    }
+    if (window == SCREEN_WINDOW || GET_WINDOW_STRUCT(window)->sdlWindow == NULL) {
+        return None;
+    }
+    return window;
+}
+
+static void captureNow(void* data) {
+    CaptureRequest* request = data;
+    Drawable drawable = request->frame ? getFrameWindow(request->drawable) : request->drawable;
+    *request->surfaceReturn = drawable == None ? NULL :
+        getDrawableSurfaceArea(drawable, request->hasArea ? &request->area : NULL, request->format);
+    free(request);
+}
+
+static Uint32 queueCapture(Drawable drawable, Bool frame, const SDL_Rect* area, Uint32 format,
+                           SDL_Surface** surfaceReturn) {
+    *surfaceReturn = NULL;
+    if (!IS_TYPE(drawable, frame ? WINDOW : DRAWABLE)) {
+        LOG("Got an invalid drawable %lu in %s\n", drawable, __func__);
+        return 0;
+    }
+    CaptureRequest* request = malloc(sizeof(CaptureRequest));
+    if (request == NULL) {
+        LOG("Out of memory: Failed to allocate the capture request in %s\n", __func__);
+        return 0;
+    }
+    request->drawable = drawable;
+    request->frame = frame;
+    request->hasArea = area != NULL;
+    if (area != NULL) {
+        request->area = *area;
+    }
+    request->format = format;
+    request->surfaceReturn = surfaceReturn;
+    enqueueRenderCommand(captureNow, request);
+    return insertRenderFence();
+}
+
+/*
+ * Capture the area of the drawable (or all of it, if area is NULL) into a new surface with the format
+ * (the default format if it is SDL_PIXELFORMAT_UNKNOWN). Waits for all queued drawing.
+ * Returns NULL on failure or if the area is outside of the drawable.
+ */
+SDL_Surface* captureDrawable(Drawable drawable, const SDL_Rect* area, Uint32 format) {
+    SDL_Surface* surface;
+    waitForRenderFence(queueCapture(drawable, False, area, format, &surface));
+    return surface;
+}
+
+/*
+ * Capture the area of the frame of the top level window that contains the window, like captureDrawable.
+ * The area is in the coordinates of the top level window.
+ */
+SDL_Surface* captureFrame(Window window, const SDL_Rect* area, Uint32 format) {
+    SDL_Surface* surface;
+    waitForRenderFence(queueCapture(window, True, area, format, &surface));
+    return surface;
+}
+
+/*
+ * Queue a capture like captureDrawable after all queued drawing. The surface is stored in surfaceReturn
+ * once the returned fence was passed, see waitForRenderFence and isRenderFenceCompleted.
+ * surfaceReturn and the drawable must stay valid until then.
+ */
+Uint32 captureDrawableAsync(Drawable drawable, const SDL_Rect* area, Uint32 format,
+                            SDL_Surface** surfaceReturn) {
+    return queueCapture(drawable, False, area, format, surfaceReturn);
+}
+
+/*
+ * Queue a capture like captureFrame, see captureDrawableAsync.
+ */
+Uint32 captureFrameAsync(Window window, const SDL_Rect* area, Uint32 format, SDL_Surface** surfaceReturn) {
+    return queueCapture(window, True, area, format, surfaceReturn);
+}
+
+/*
+ * Write the surface as a binary PPM file to the path.
+ */
+Bool saveSurfacePPM(SDL_Surface* surface, const char* path) {
+    SDL_Surface* rgbSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGB24, 0);
+    if (rgbSurface == NULL) {
+        LOG("SDL_ConvertSurfaceFormat failed in %s: %s\n", __func__, SDL_GetError());
+        return False;
+    }
+    FILE* file = fopen(path, "wb");
+    Bool success = file != NULL;
+    if (success) {
+        int y;
+        success = fprintf(file, "P6\n%d %d\n255\n", rgbSurface->w, rgbSurface->h) > 0;
+        for (y = 0; success && y < rgbSurface->h; y++) {
+            success = fwrite((Uint8*) rgbSurface->pixels + y * rgbSurface->pitch, 3,
+                             (size_t) rgbSurface->w, file) == (size_t) rgbSurface->w;
+        }
+        success = fclose(file) == 0 && success;
+    }
+    if (!success) {
+        LOG("Failed to write %s in %s\n", path, __func__);
+    }
+    SDL_FreeSurface(rgbSurface);
+    return success;
+}
+
+/*
+ * Dump the frame of the top level window which is about to be presented, if dumping is enabled.
+ * The file name contains the frame number, the window and the present time in milliseconds.
+ * Must be called on the render thread before the frame is presented.
+ */
+void dumpPresentedFrame(Window window) {
+    if (captureDir == NULL) return;
+    SDL_Surface* surface = getDrawableSurfaceArea(window, NULL, SDL_PIXELFORMAT_UNKNOWN);
+    if (surface == NULL) return;
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/frame-%06u-window-%lx-%ums.%s", captureDir, capturedFrames++, window,
+             SDL_GetTicks(), captureAsBMP ? "bmp" : "ppm");
+    if (captureAsBMP) {
+        if (SDL_SaveBMP(surface, path) != 0) {
+            LOG("SDL_SaveBMP failed in %s: %s\n", __func__, SDL_GetError());
+        }
+    } else {
+        saveSurfacePPM(surface, path);
+    }
+    SDL_FreeSurface(surface);
+}
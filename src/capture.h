@@ -0,0 +1,31 @@
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+
+/*
+ * Capturing the content of drawables for tests and monitoring. The frame of a top level window is
+ * its composited content as it is presented, including all of its child windows. Captures are in
+ * device pixels (see scale.h) and are converted into the requested SDL pixel format.
+ * The synchronous functions wait for all queued drawing; the asynchronous variant reads the pixels
+ * on the render thread after the drawing that was queued before it and returns a render fence,
+ * so the caller does not stall the render pipeline (see renderThread.h).
+ * If CAPTURE_DIR_ENV is set, every presented frame is also dumped into that directory.
+ */
+
+/* Environment variable with the directory that presented frames are dumped into. */
+#define CAPTURE_DIR_ENV "SDL2X11_CAPTURE_DIR"
+/* Environment variable with the format of dumped frames, "ppm" (the default) or "bmp". */
+#define CAPTURE_FORMAT_ENV "SDL2X11_CAPTURE_FORMAT"
+
+void initCaptureConfig(void);
+SDL_Surface* captureDrawable(Drawable drawable, const SDL_Rect* area, Uint32 format);
+SDL_Surface* captureFrame(Window window, const SDL_Rect* area, Uint32 format);
+Uint32 captureDrawableAsync(Drawable drawable, const SDL_Rect* area, Uint32 format,
+                            SDL_Surface** surfaceReturn);
+Uint32 captureFrameAsync(Window window, const SDL_Rect* area, Uint32 format, SDL_Surface** surfaceReturn);
+Bool saveSurfacePPM(SDL_Surface* surface, const char* path);
+void dumpPresentedFrame(Window window);
+
+#endif /* _CAPTURE_H_ */
@@ -6,6 +6,122 @@
 #include "display.h"
 #include "util.h"
 
+NativePixelFormat NATIVE_PIXEL_FORMAT = {
+    SDL_PIXELFORMAT_RGBA8888, 0xFF000000, 0x00FF0000, 0x0000FF00, 0x000000FF, 24, 16, 8, 0
+};
+
+static Uint8 getMaskShift(Uint32 mask) {
+    Uint8 shift = 0;
+    if (mask == 0) return 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        shift++;
+    }
+    return shift;
+}
+
+static Bool isByteMask(Uint32 mask) {
+    return mask != 0 && (mask >> getMaskShift(mask)) == 0xFF;
+}
+
+/*
+ * Only 32 bit formats with 8 bits per channel can be used, because the rest of the code
+ * (and every client) expects to be able to store a color in an unsigned long pixel value.
+ */
+static Bool isUsablePixelFormat(Uint32 format) {
+    int bpp;
+    Uint32 redMask, greenMask, blueMask, alphaMask;
+    if (SDL_ISPIXELFORMAT_INDEXED(format) || SDL_ISPIXELFORMAT_FOURCC(format)
+        || SDL_BYTESPERPIXEL(format) != 4) {
+        return False;
+    }
+    if (!SDL_PixelFormatEnumToMasks(format, &bpp, &redMask, &greenMask, &blueMask, &alphaMask)) {
+        return False;
+    }
+    return isByteMask(redMask) && isByteMask(greenMask) && isByteMask(blueMask)
+           && (alphaMask == 0 || isByteMask(alphaMask));
+}
+
+/*
+ * Get the format with the same channel layout as the given one, but with an alpha channel
+ * in place of the padding byte. Drawing onto the textures relies on alpha blending.
+ */
+static Uint32 getAlphaPixelFormat(Uint32 format) {
+    switch (format) {
+        case SDL_PIXELFORMAT_RGB888:   return SDL_PIXELFORMAT_ARGB8888;
+        case SDL_PIXELFORMAT_BGR888:   return SDL_PIXELFORMAT_ABGR8888;
+        case SDL_PIXELFORMAT_RGBX8888: return SDL_PIXELFORMAT_RGBA8888;
+        case SDL_PIXELFORMAT_BGRX8888: return SDL_PIXELFORMAT_BGRA8888;
+        default: return format;
+    }
+}
+
+static Bool isTextureFormatSupported(SDL_RendererInfo* info, Uint32 format) {
+    Uint32 i;
+    for (i = 0; i < info->num_texture_formats; i++) {
+        if (info->texture_formats[i] == format) return True;
+    }
+    return False;
+}
+
+Bool initNativePixelFormat(SDL_Window* window, SDL_Renderer* renderer) {
+    SDL_RendererInfo info;
+    Uint32 windowFormat = SDL_PIXELFORMAT_UNKNOWN;
+    Uint32 format = SDL_PIXELFORMAT_UNKNOWN;
+    Uint32 i;
+    int bpp;
+    if (window != NULL) {
+        windowFormat = SDL_GetWindowPixelFormat(window);
+    }
+    if (renderer == NULL || SDL_GetRendererInfo(renderer, &info) != 0) {
+        LOG("Failed to get the renderer info in %s: %s\n", __func__, SDL_GetError());
+        return False;
+    }
+    // Prefer the format of the window, so presenting a texture never needs a conversion.
+    if (isUsablePixelFormat(windowFormat)) {
+        if (isTextureFormatSupported(&info, getAlphaPixelFormat(windowFormat))) {
+            format = getAlphaPixelFormat(windowFormat);
+        } else if (isTextureFormatSupported(&info, windowFormat)) {
+            format = windowFormat;
+        }
+    }
+    // Otherwise use the format the renderer likes the most.
+    for (i = 0; format == SDL_PIXELFORMAT_UNKNOWN && i < info.num_texture_formats; i++) {
+        if (isUsablePixelFormat(info.texture_formats[i])) {
+            format = info.texture_formats[i];
+        }
+    }
+    if (format == SDL_PIXELFORMAT_UNKNOWN) {
+        LOG("Warn: No usable native pixel format found, keeping %s\n",
+            SDL_GetPixelFormatName(NATIVE_PIXEL_FORMAT.format));
+        return False;
+    }
+    SDL_PixelFormatEnumToMasks(format, &bpp, &NATIVE_PIXEL_FORMAT.redMask,
+                               &NATIVE_PIXEL_FORMAT.greenMask, &NATIVE_PIXEL_FORMAT.blueMask,
+                               &NATIVE_PIXEL_FORMAT.alphaMask);
+    NATIVE_PIXEL_FORMAT.format = format;
+    NATIVE_PIXEL_FORMAT.redShift = getMaskShift(NATIVE_PIXEL_FORMAT.redMask);
+    NATIVE_PIXEL_FORMAT.greenShift = getMaskShift(NATIVE_PIXEL_FORMAT.greenMask);
+    NATIVE_PIXEL_FORMAT.blueShift = getMaskShift(NATIVE_PIXEL_FORMAT.blueMask);
+    NATIVE_PIXEL_FORMAT.alphaShift = getMaskShift(NATIVE_PIXEL_FORMAT.alphaMask);
+    LOG("Using native pixel format %s (window format is %s)\n", SDL_GetPixelFormatName(format),
+        SDL_GetPixelFormatName(windowFormat));
+    return True;
+}
+
+unsigned long colorToPixel(Uint8 red, Uint8 green, Uint8 blue, Uint8 alpha) {
+    unsigned long pixel = ((unsigned long) red << RED_SHIFT) | ((unsigned long) green << GREEN_SHIFT)
+                          | ((unsigned long) blue << BLUE_SHIFT);
+    if (NATIVE_PIXEL_FORMAT.alphaMask != 0) {
+        pixel |= (unsigned long) alpha << ALPHA_SHIFT;
+    }
+    return pixel;
+}
+
+unsigned long rgbaToPixel(unsigned long rgba) {
+    return colorToPixel((Uint8) (rgba >> 24), (Uint8) (rgba >> 16), (Uint8) (rgba >> 8), (Uint8) rgba);
+}
+
 SDL_Color uLongToColor(SDL_PixelFormat* pixelFormat, unsigned long color) {
     SDL_Color res;
     SDL_GetRGBA(color, pixelFormat, &res.r, &res.g, &res.b, &res.a);
@@ -14,10 +130,10 @@ SDL_Color uLongToColor(SDL_PixelFormat* pixelFormat, unsigned long color) {
 
 SDL_Color uLongToColorFromVisual(Visual* visual, unsigned long color) {
     SDL_Color res;
-    res.r = (visual->red_mask & color) >> 24;
-    res.g = (visual->green_mask & color) >> 16;
-    res.b = (visual->blue_mask & color) >> 8;
-    res.a = (~(visual->red_mask | visual->green_mask | visual->blue_mask)) & color;
+    res.r = (Uint8) ((visual->red_mask & color) >> getMaskShift(visual->red_mask));
+    res.g = (Uint8) ((visual->green_mask & color) >> getMaskShift(visual->green_mask));
+    res.b = (Uint8) ((visual->blue_mask & color) >> getMaskShift(visual->blue_mask));
+    res.a = GET_ALPHA_FROM_COLOR(color);
     return res;
 }
 
@@ -59,9 +175,9 @@ int XQueryColors(Display *display, Colormap colormap, XColor* defs_in_out, int n
     int i;
     for (i = 0; i < ncolors; ++i) {
         XColor color = defs_in_out[i];
-        color.red   = (unsigned int) (color.pixel & 0xFF000000) >> 24;
-        color.green = (unsigned int) (color.pixel & 0x00FF0000) >> 16;
-        color.blue  = (unsigned int) (color.pixel & 0x0000FF00) >>  8;
+        color.red   = GET_RED_FROM_COLOR(color.pixel);
+        color.green = GET_GREEN_FROM_COLOR(color.pixel);
+        color.blue  = GET_BLUE_FROM_COLOR(color.pixel);
     }
 	return Success;
 }
@@ -94,8 +210,8 @@ Status XLookupColor(Display* display, Colormap colormap, _Xconst char* color_nam
             if (doesMatch) {
                 // TODO: Should I use the colormap?
                 XColor colorList[] = {*exact_def_return, *screen_def_return};
-                exact_def_return->pixel = entry.pixelValue;
-                screen_def_return->pixel = entry.pixelValue;
+                exact_def_return->pixel = rgbaToPixel(entry.pixelValue);
+                screen_def_return->pixel = rgbaToPixel(entry.pixelValue);
                 XQueryColors(display, colormap, colorList, 2);
                 return 1;
             }
@@ -2,23 +2,37 @@
 #define _COLORS_H_
 
 #include <SDL2/SDL.h>
+#include <X11/Xlib.h>
 
-#if SDL_BYTEORDER != SDL_BIG_ENDIAN
-#  define RED_SHIFT   24
-#  define GREEN_SHIFT 16
-#  define BLUE_SHIFT  8
-#  define ALPHA_SHIFT 0
-#else
-#  define RED_SHIFT   0
-#  define GREEN_SHIFT 8
-#  define BLUE_SHIFT  16
-#  define ALPHA_SHIFT 24
-#endif
+typedef struct {
+    Uint32 format;
+    Uint32 redMask;
+    Uint32 greenMask;
+    Uint32 blueMask;
+    Uint32 alphaMask;
+    Uint8 redShift;
+    Uint8 greenShift;
+    Uint8 blueShift;
+    Uint8 alphaShift;
+} NativePixelFormat;
+
+/*
+ * The pixel format used for all window and pixmap textures. Pixel values handed to us by the
+ * client are interpreted in this format, so they can be uploaded to the renderer unchanged.
+ * Defaults to RGBA8888 until initNativePixelFormat picked the format of the real screen.
+ */
+extern NativePixelFormat NATIVE_PIXEL_FORMAT;
+
+#define RED_SHIFT   (NATIVE_PIXEL_FORMAT.redShift)
+#define GREEN_SHIFT (NATIVE_PIXEL_FORMAT.greenShift)
+#define BLUE_SHIFT  (NATIVE_PIXEL_FORMAT.blueShift)
+#define ALPHA_SHIFT (NATIVE_PIXEL_FORMAT.alphaShift)
 
 #define GET_RED_FROM_COLOR(color)   ((Uint8) ((color >> RED_SHIFT)   & 0xFF))
 #define GET_GREEN_FROM_COLOR(color) ((Uint8) ((color >> GREEN_SHIFT) & 0xFF))
 #define GET_BLUE_FROM_COLOR(color)  ((Uint8) ((color >> BLUE_SHIFT)  & 0xFF))
-#define GET_ALPHA_FROM_COLOR(color) ((Uint8) ((color >> ALPHA_SHIFT) & 0xFF))
+#define GET_ALPHA_FROM_COLOR(color) ((Uint8) (NATIVE_PIXEL_FORMAT.alphaMask != 0 ? \
+                                              ((color >> ALPHA_SHIFT) & 0xFF) : 0xFF))
 
 // TODO: Make these to real XIDs
 
@@ -26,5 +40,8 @@
 #define REAL_COLOR_COLORMAP ((XID) 2)
 
 SDL_Color uLongToColor(SDL_PixelFormat* pixelFormat, unsigned long color);
+unsigned long colorToPixel(Uint8 red, Uint8 green, Uint8 blue, Uint8 alpha);
+unsigned long rgbaToPixel(unsigned long rgba);
+Bool initNativePixelFormat(SDL_Window* window, SDL_Renderer* renderer);
 
 #endif /* _COLORS_H_ */
@@ -6,6 +6,7 @@
 #include "colors.h"
 #include "resourceTypes.h"
 #include "display.h"
+#include "renderThread.h"
 
 #define GET_CURSOR(cursorId) ((Cursor_*) GET_XID_VALUE(cursorId))
 
@@ -14,7 +15,7 @@ typedef struct {
     int hotspot_x, hotspot_y;
 } Cursor_;
 
-Cursor createPixmapCursor(Display* display, SDL_Texture* source, SDL_Texture* mask,
+Cursor createPixmapCursor(Display* display, SDL_Surface* source, SDL_Surface* mask,
                           _Xconst XColor* foreground_color, _Xconst XColor* background_color,
                           unsigned int x, unsigned int y) {
 //    if (x > source->w || y > source->h) {
@@ -74,14 +75,23 @@ Cursor XCreatePixmapCursor(Display* display, Pixmap source, Pixmap mask, XColor*
     // https://tronche.com/gui/x/xlib/pixmap-and-cursor/XCreatePixmapCursor.html
     SET_X_SERVER_REQUEST(display, X_CreateCursor);
     TYPE_CHECK(source, PIXMAP, display, None);
-	SDL_Texture* sourcePixmap = GET_PIXMAP_TEXTURE(source);
-    SDL_Texture* maskPixmap = NULL;
     if (mask != None) {
         TYPE_CHECK(mask, PIXMAP, display, None);
-		maskPixmap = GET_PIXMAP_TEXTURE(mask);
     }
-    return createPixmapCursor(display, sourcePixmap, maskPixmap, foreground_color,
-                              background_color, x, y);
+    syncRenderThread();
+    SDL_Surface* sourceSurface = getPixmapSurface(source, NULL);
+    SDL_Surface* maskSurface = NULL;
+    if (sourceSurface == NULL || (mask != None && (maskSurface = getPixmapSurface(mask, NULL)) == NULL)) {
+        LOG("Failed to read the pixmaps in %s\n", __func__);
+        SDL_FreeSurface(sourceSurface);
+        handleOutOfMemory(0, display, 0, 0);
+        return None;
+    }
+    Cursor cursor = createPixmapCursor(display, sourceSurface, maskSurface, foreground_color,
+                                       background_color, x, y);
+    SDL_FreeSurface(sourceSurface);
+    SDL_FreeSurface(maskSurface);
+    return cursor;
 }
 
 Cursor XCreateGlyphCursor(Display* display, Font source_font, Font mask_font,
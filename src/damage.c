@@ -0,0 +1,347 @@
+#include <stdlib.h>
+#include <pixman.h>
+#include "damage.h"
+#include "serverRegion.h"
+#include "extensions.h"
+#include "window.h"
+#include "pixmap.h"
+#include "doubleBuffer.h"
+#include "display.h"
+#include "events.h"
+#include "errors.h"
+#include "renderThread.h"
+#include "util.h"
+
+// The ids of all damage objects.
+static Array damages = {NULL, 0, 0};
+// Guards the damage regions, which are changed by the thread that draws.
+static SDL_mutex* damageMutex = NULL;
+// Scratch region for the reports of the delta level, only used while holding the mutex.
+static Region deltaRegion = NULL;
+// Set if any damage object has an event pending.
+static SDL_atomic_t hasPendingDamage;
+
+/*
+ * Get the geometry of the drawable as reported in the notify events.
+ * This must not use SDL, because it is called on the render thread.
+ */
+static Bool getDamageGeometry(Drawable drawable, XRectangle* geometry) {
+    if (IS_TYPE(drawable, PIXMAP)) {
+        geometry->x = geometry->y = 0;
+        geometry->width = (unsigned short) GET_PIXMAP_STRUCT(drawable)->width;
+        geometry->height = (unsigned short) GET_PIXMAP_STRUCT(drawable)->height;
+        return True;
+    }
+    Window window = IS_TYPE(drawable, BACK_BUFFER) ? GET_BACK_BUFFER(drawable)->window : drawable;
+    if (window == None) return False;
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    geometry->x = (short) windowStruct->x;
+    geometry->y = (short) windowStruct->y;
+    geometry->width = (unsigned short) windowStruct->w;
+    geometry->height = (unsigned short) windowStruct->h;
+    return True;
+}
+
+/*
+ * Add the area to the damage and remember what has to be reported according to its level.
+ * Must be called with the mutex held.
+ */
+static void addDamage(DamageStruct* damageStruct, XRectangle* area) {
+    XRectangle extents;
+    Bool wasEmpty = XEmptyRegion(damageStruct->region);
+    XClipBox(damageStruct->region, &extents);
+    switch (damageStruct->level) {
+        case XDamageReportRawRectangles:
+            XUnionRectWithRegion(area, damageStruct->pendingRegion, damageStruct->pendingRegion);
+            damageStruct->pending = True;
+            break;
+        case XDamageReportDeltaRectangles:
+            // Only the part which is not damaged already is reported.
+            XSubtractRegion(deltaRegion, deltaRegion, deltaRegion);
+            XUnionRectWithRegion(area, deltaRegion, deltaRegion);
+            XSubtractRegion(deltaRegion, damageStruct->region, deltaRegion);
+            if (!XEmptyRegion(deltaRegion)) {
+                XUnionRegion(deltaRegion, damageStruct->pendingRegion, damageStruct->pendingRegion);
+                damageStruct->pending = True;
+            }
+            break;
+        default:
+            break;
+    }
+    XUnionRectWithRegion(area, damageStruct->region, damageStruct->region);
+    if (damageStruct->level == XDamageReportNonEmpty && wasEmpty) {
+        damageStruct->pending = True;
+    } else if (damageStruct->level == XDamageReportBoundingBox) {
+        XRectangle newExtents;
+        XClipBox(damageStruct->region, &newExtents);
+        if (wasEmpty || newExtents.x != extents.x || newExtents.y != extents.y
+            || newExtents.width != extents.width || newExtents.height != extents.height) {
+            damageStruct->pending = True;
+        }
+    }
+    if (damageStruct->pending) {
+        SDL_AtomicSet(&hasPendingDamage, 1);
+    }
+}
+
+/*
+ * Add the area in the coordinates of the drawable to the damage objects of the drawable.
+ * offsetX and offsetY are the position of the drawing drawable in the drawable.
+ */
+static void damageDrawable(Drawable drawable, const SDL_Rect* area, int offsetX, int offsetY) {
+    XRectangle geometry;
+    size_t i;
+    for (i = 0; i < damages.length; i++) {
+        DamageStruct* damageStruct = GET_DAMAGE_STRUCT((Damage) damages.array[i]);
+        if (damageStruct->drawable != drawable || !getDamageGeometry(drawable, &geometry)) continue;
+        SDL_Rect drawableRect = {0, 0, geometry.width, geometry.height};
+        SDL_Rect damagedRect;
+        if (area == NULL) {
+            damagedRect = drawableRect;
+        } else {
+            damagedRect = *area;
+            damagedRect.x += offsetX;
+            damagedRect.y += offsetY;
+            if (!SDL_IntersectRect(&damagedRect, &drawableRect, &damagedRect)) continue;
+        }
+        XRectangle damagedArea = {(short) damagedRect.x, (short) damagedRect.y,
+                                  (unsigned short) damagedRect.w, (unsigned short) damagedRect.h};
+        addDamage(damageStruct, &damagedArea);
+    }
+}
+
+/*
+ * Report that the area of the drawable (NULL for all of it) was drawn into.
+ * This is cheap if there are no damage objects.
+ */
+void reportDamage(Drawable drawable, const SDL_Rect* area) {
+    if (damages.length == 0) return;
+    SDL_LockMutex(damageMutex);
+    if (IS_TYPE(drawable, WINDOW)) {
+        SDL_Rect windowArea;
+        int offsetX = 0, offsetY = 0;
+        if (area == NULL) {
+            windowArea.x = windowArea.y = 0;
+            windowArea.w = (int) GET_WINDOW_STRUCT(drawable)->w;
+            windowArea.h = (int) GET_WINDOW_STRUCT(drawable)->h;
+            area = &windowArea;
+        }
+        Window window;
+        for (window = drawable; window != None; window = GET_PARENT(window)) {
+            damageDrawable(window, area, offsetX, offsetY);
+            offsetX += GET_WINDOW_STRUCT(window)->x;
+            offsetY += GET_WINDOW_STRUCT(window)->y;
+        }
+    } else {
+        damageDrawable(drawable, area, 0, 0);
+    }
+    SDL_UnlockMutex(damageMutex);
+}
+
+static void postNotifyEvent(Damage damage, const XRectangle* area, const XRectangle* geometry, Bool more) {
+    DamageStruct* damageStruct = GET_DAMAGE_STRUCT(damage);
+    XDamageNotifyEvent* event = malloc(sizeof(XDamageNotifyEvent));
+    if (event == NULL) {
+        LOG("Out of memory: Failed to allocate the damage event in %s\n", __func__);
+        return;
+    }
+    event->type = DAMAGE_FIRST_EVENT + XDamageNotify;
+    event->send_event = False;
+    event->display = damageStruct->display;
+    event->drawable = damageStruct->drawable;
+    event->damage = damage;
+    event->level = damageStruct->level;
+    event->more = more;
+    event->timestamp = SDL_GetTicks();
+    event->area = *area;
+    event->geometry = *geometry;
+    if (!enqueueEvent(damageStruct->display, damageStruct->drawable, event)) {
+        free(event);
+    }
+}
+
+/*
+ * Post the pending notify events of the damage object, must be called with the mutex held.
+ */
+static void postPendingEvents(Damage damage) {
+    DamageStruct* damageStruct = GET_DAMAGE_STRUCT(damage);
+    XRectangle geometry, area;
+    if (!damageStruct->pending || !getDamageGeometry(damageStruct->drawable, &geometry)) return;
+    damageStruct->pending = False;
+    if (damageStruct->level == XDamageReportRawRectangles || damageStruct->level == XDamageReportDeltaRectangles) {
+        int numBoxes, i;
+        pixman_box16_t* boxes = pixman_region_rectangles(
+                (pixman_region16_t*) (void*) damageStruct->pendingRegion, &numBoxes);
+        for (i = 0; i < numBoxes; i++) {
+            area.x = boxes[i].x1;
+            area.y = boxes[i].y1;
+            area.width = (unsigned short) (boxes[i].x2 - boxes[i].x1);
+            area.height = (unsigned short) (boxes[i].y2 - boxes[i].y1);
+            postNotifyEvent(damage, &area, &geometry, i + 1 < numBoxes);
+        }
+        XSubtractRegion(damageStruct->pendingRegion, damageStruct->pendingRegion, damageStruct->pendingRegion);
+    } else {
+        XClipBox(damageStruct->region, &area);
+        postNotifyEvent(damage, &area, &geometry, False);
+    }
+}
+
+/*
+ * Post the notify events of all damage objects with new damage. This must be called on the client thread.
+ * If waitForDrawing is set, the damage of the queued drawing requests is included.
+ */
+void postDamageEvents(Bool waitForDrawing) {
+    if (damages.length == 0) return;
+    if (waitForDrawing) {
+        syncRenderThread();
+    }
+    if (SDL_AtomicGet(&hasPendingDamage) == 0) return;
+    SDL_LockMutex(damageMutex);
+    SDL_AtomicSet(&hasPendingDamage, 0);
+    size_t i;
+    for (i = 0; i < damages.length; i++) {
+        postPendingEvents((Damage) damages.array[i]);
+    }
+    SDL_UnlockMutex(damageMutex);
+}
+
+/*
+ * Stop tracking the damage of the drawable because it is destroyed.
+ * The damage objects stay allocated until they are destroyed.
+ */
+void detachDamage(Drawable drawable) {
+    size_t i;
+    for (i = 0; i < damages.length; i++) {
+        DamageStruct* damageStruct = GET_DAMAGE_STRUCT((Damage) damages.array[i]);
+        if (damageStruct->drawable == drawable) {
+            damageStruct->drawable = None;
+            damageStruct->pending = False;
+        }
+    }
+}
+
+Bool XDamageQueryExtension(Display* display, int* event_base_return, int* error_base_return) {
+    *event_base_return = DAMAGE_FIRST_EVENT;
+    *error_base_return = DAMAGE_FIRST_ERROR;
+    return True;
+}
+
+Status XDamageQueryVersion(Display* display, int* major_version_return, int* minor_version_return) {
+    SET_X_SERVER_REQUEST(display, DAMAGE_MAJOR_OPCODE);
+    *major_version_return = DAMAGE_MAJOR;
+    *minor_version_return = DAMAGE_MINOR;
+    return 1;
+}
+
+Damage XDamageCreate(Display* display, Drawable drawable, int level) {
+    SET_X_SERVER_REQUEST(display, DAMAGE_MAJOR_OPCODE);
+    TYPE_CHECK(drawable, DRAWABLE, display, None);
+    if (level < XDamageReportRawRectangles || level > XDamageReportNonEmpty) {
+        LOG("BadValue: Got invalid report level %d in %s!\n", level, __func__);
+        handleError(0, display, None, 0, BadValue, X_DamageCreate);
+        return None;
+    }
+    syncRenderThread();
+    if (damageMutex == NULL) {
+        damageMutex = SDL_CreateMutex();
+        deltaRegion = XCreateRegion();
+        if (damageMutex == NULL || deltaRegion == NULL) {
+            LOG("Failed to initialize the damage tracking in %s: %s\n", __func__, SDL_GetError());
+            if (damageMutex != NULL) SDL_DestroyMutex(damageMutex);
+            if (deltaRegion != NULL) XDestroyRegion(deltaRegion);
+            damageMutex = NULL;
+            deltaRegion = NULL;
+            handleOutOfMemory(0, display, 0, X_DamageCreate);
+            return None;
+        }
+    }
+    Damage damage = ALLOC_XID();
+    DamageStruct* damageStruct = malloc(sizeof(DamageStruct));
+    Region region = XCreateRegion();
+    Region pendingRegion = XCreateRegion();
+    if (damage == None || damageStruct == NULL || region == NULL || pendingRegion == NULL
+        || !insertArray(&damages, (void*) damage)) {
+        if (damage != None) FREE_XID(damage);
+        if (region != NULL) XDestroyRegion(region);
+        if (pendingRegion != NULL) XDestroyRegion(pendingRegion);
+        free(damageStruct);
+        handleOutOfMemory(0, display, 0, X_DamageCreate);
+        return None;
+    }
+    damageStruct->display = display;
+    damageStruct->drawable = drawable;
+    damageStruct->level = level;
+    damageStruct->region = region;
+    damageStruct->pendingRegion = pendingRegion;
+    damageStruct->pending = False;
+    SET_XID_TYPE(damage, DAMAGE);
+    SET_XID_VALUE(damage, damageStruct);
+    return damage;
+}
+
+void XDamageDestroy(Display* display, Damage damage) {
+    SET_X_SERVER_REQUEST(display, DAMAGE_MAJOR_OPCODE);
+    TYPE_CHECK(damage, DAMAGE, display);
+    syncRenderThread();
+    DamageStruct* damageStruct = GET_DAMAGE_STRUCT(damage);
+    ssize_t index = findInArray(&damages, (void*) damage);
+    if (index != -1) {
+        removeArray(&damages, (size_t) index, False);
+    }
+    if (damages.length == 0) {
+        freeArray(&damages);
+    }
+    XDestroyRegion(damageStruct->region);
+    XDestroyRegion(damageStruct->pendingRegion);
+    free(damageStruct);
+    FREE_XID(damage);
+}
+
+void XDamageSubtract(Display* display, Damage damage, XserverRegion repair, XserverRegion parts) {
+    SET_X_SERVER_REQUEST(display, DAMAGE_MAJOR_OPCODE);
+    TYPE_CHECK(damage, DAMAGE, display);
+    if (repair != None) {
+        TYPE_CHECK(repair, SERVER_REGION, display);
+    }
+    if (parts != None) {
+        TYPE_CHECK(parts, SERVER_REGION, display);
+    }
+    syncRenderThread();
+    DamageStruct* damageStruct = GET_DAMAGE_STRUCT(damage);
+    SDL_LockMutex(damageMutex);
+    if (repair == None) {
+        if (parts != None) {
+            XUnionRegion(damageStruct->region, damageStruct->region, GET_SERVER_REGION(parts));
+        }
+        XSubtractRegion(damageStruct->region, damageStruct->region, damageStruct->region);
+    } else {
+        if (parts != None) {
+            XIntersectRegion(damageStruct->region, GET_SERVER_REGION(repair), GET_SERVER_REGION(parts));
+        }
+        XSubtractRegion(damageStruct->region, GET_SERVER_REGION(repair), damageStruct->region);
+    }
+    if (!XEmptyRegion(damageStruct->region) && damageStruct->drawable != None) {
+        // The damage which is left is reported again.
+        if (damageStruct->level == XDamageReportRawRectangles
+            || damageStruct->level == XDamageReportDeltaRectangles) {
+            XUnionRegion(damageStruct->region, damageStruct->pendingRegion, damageStruct->pendingRegion);
+        }
+        damageStruct->pending = True;
+        SDL_AtomicSet(&hasPendingDamage, 1);
+    }
+    SDL_UnlockMutex(damageMutex);
+}
+
+void XDamageAdd(Display* display, Drawable drawable, XserverRegion region) {
+    SET_X_SERVER_REQUEST(display, DAMAGE_MAJOR_OPCODE);
+    TYPE_CHECK(drawable, DRAWABLE, display);
+    TYPE_CHECK(region, SERVER_REGION, display);
+    syncRenderThread();
+    int numBoxes, i;
+    pixman_box16_t* boxes = pixman_region_rectangles((pixman_region16_t*) (void*) GET_SERVER_REGION(region),
+                                                     &numBoxes);
+    for (i = 0; i < numBoxes; i++) {
+        SDL_Rect area = {boxes[i].x1, boxes[i].y1, boxes[i].x2 - boxes[i].x1, boxes[i].y2 - boxes[i].y1};
+        reportDamage(drawable, &area);
+    }
+}
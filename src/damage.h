@@ -0,0 +1,36 @@
+#ifndef _DAMAGE_H_
+#define _DAMAGE_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/Xdamage.h>
+
+/*
+ * The DAMAGE extension: Every render target a drawing request draws into reports its area
+ * (see nextDrawTarget), which is added to the damage region of all damage objects of the drawable.
+ * Drawing into a window also damages its ancestors. The damage can be reported on the render thread,
+ * so the notify events are only posted by the client thread when it flushes or waits for events,
+ * which coalesces the damage of consecutive drawing requests into few events.
+ */
+
+typedef struct {
+    Display* display;
+    /* The damaged drawable, None once it was destroyed. */
+    Drawable drawable;
+    int level;
+    /* The accumulated damage which was not subtracted yet. */
+    Region region;
+    /* The damage which has to be reported by the next events, only used for rectangle levels. */
+    Region pendingRegion;
+    /* Whether an event has to be posted. */
+    Bool pending;
+} DamageStruct;
+
+#define GET_DAMAGE_STRUCT(damage) ((DamageStruct*) GET_XID_VALUE(damage))
+
+void reportDamage(Drawable drawable, const SDL_Rect* area);
+void postDamageEvents(Bool waitForDrawing);
+void detachDamage(Drawable drawable);
+
+#endif /* _DAMAGE_H_ */
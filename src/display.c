@@ -10,10 +10,17 @@
 #include "events.h"
 #include "colors.h"
 #include "drawing.h"
+#include "damage.h"
+#include "sharedMemory.h"
 #include "display.h"
 #include "atoms.h"
 #include "visual.h"
 #include "font.h"
+#include "present.h"
+#include "capture.h"
+#include "scale.h"
+#include "raster.h"
+#include "renderThread.h"
 
 #include <X11/X.h>
 #include <X11/Xutil.h>
@@ -33,7 +40,9 @@ int XCloseDisplay(Display* display) {
     // https://tronche.com/gui/x/xlib/display/XCloseDisplay.html
     if (numDisplaysOpen == 1) {
         freeAtomStorage();
+        stopRenderThread();
         freeFontStorage();
+        shutdownRasterizer();
         destroyScreenWindow(display);
         TTF_Quit();
         SDL_Quit();
@@ -123,8 +132,11 @@ Display* XOpenDisplay(_Xconst char* display_name) {
             return NULL;
         }
         screen->display = display;
-        screen->width   = displayMode.w;
-        screen->height  = displayMode.h;
+        if (screenIndex == 0) {
+            initDeviceScale(screenIndex);
+        }
+        screen->width   = TO_LOGICAL(displayMode.w);
+        screen->height  = TO_LOGICAL(displayMode.h);
         #if SDL_VERSION_ATLEAST(2, 0, 4)
         // Calculate the values in millimeters
         float h_dpi, v_dpi;
@@ -145,9 +157,8 @@ Display* XOpenDisplay(_Xconst char* display_name) {
         screen->root_visual = getDefaultVisual(screenIndex);
         // TODO: Need real values here (use from visual)
         screen->root_depth = 64;
-        screen->white_pixel = 0xFFFFFFFF;
-        screen->black_pixel = 0x000000FF;
         screen->cmap = REAL_COLOR_COLORMAP;
+        screen->backing_store = Always;
     }
     if (SCREEN_WINDOW == None) {
         if (initScreenWindow(display) != True) {
@@ -160,21 +171,35 @@ Display* XOpenDisplay(_Xconst char* display_name) {
 			screen->root = SCREEN_WINDOW;
 		}
     }
+    initPresentConfig();
+    initCaptureConfig();
+    initBackingStoreConfig();
+    initRasterizer();
     GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlWindow = SDL_CreateWindow(NULL, 0, 0, 10, 10, SDL_WINDOW_HIDDEN | SDL_WINDOW_OPENGL);
     if (GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlWindow == NULL) {
         LOG("XOpenDisplay: Initializing the SDL screen window failed: %s!\n", SDL_GetError());
         XCloseDisplay(display);
         return NULL;
     }
-	GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer = SDL_CreateRenderer(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlWindow, -1, 0);
+	GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer = SDL_CreateRenderer(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlWindow, -1,
+			isRenderThreadRequested() ? SDL_RENDERER_SOFTWARE : 0);
+    if (initNativePixelFormat(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlWindow,
+                              GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer)) {
+        updateVisualMasks();
+    }
     if (numDisplaysOpen == 1) {
         // Init the font search path
         XSetFontPath(display, NULL, 0);
     }
 	for (screenIndex = 0; screenIndex < display->nscreens; screenIndex++) {
 		Screen* screen = &display->screens[screenIndex];
+		screen->white_pixel = colorToPixel(0xFF, 0xFF, 0xFF, 0xFF);
+		screen->black_pixel = colorToPixel(0x00, 0x00, 0x00, 0xFF);
 		screen->default_gc = XCreateGC(display, screen->root, 0, NULL);
 	}
+    if (numDisplaysOpen == 1) {
+        initRenderThread(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer);
+    }
     return display;
 }
 
@@ -195,6 +220,9 @@ int XSync(Display *display, Bool discard) {
     // https://tronche.com/gui/x/xlib/event-handling/XSync.html
     WARN_UNIMPLEMENTED;
     flipScreen();
+    postDamageEvents(True);
+    postShmCompletions(True);
+    postRenderErrors(True);
     return 1;
 }
 
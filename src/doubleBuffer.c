@@ -0,0 +1,485 @@
+#include <stdlib.h>
+#include <string.h>
+#include <X11/extensions/dbe.h>
+#include "doubleBuffer.h"
+#include "extensions.h"
+#include "window.h"
+#include "drawing.h"
+#include "display.h"
+#include "errors.h"
+#include "colors.h"
+#include "present.h"
+#include "renderThread.h"
+#include "damage.h"
+#include "util.h"
+
+// The back buffers of all windows.
+static Array backBuffers = {NULL, 0, 0};
+
+static void freeBufferTexture(BufferTexture* buffer) {
+    if (buffer->texture != NULL) {
+        SDL_DestroyTexture(buffer->texture);
+    }
+    buffer->texture = NULL;
+    buffer->renderer = NULL;
+    buffer->width = buffer->height = 0;
+}
+
+static void clearBufferTexture(BufferTexture* buffer, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    SDL_SetRenderTarget(buffer->renderer, buffer->texture);
+    SDL_SetRenderDrawColor(buffer->renderer, r, g, b, a);
+    SDL_RenderClear(buffer->renderer);
+}
+
+/*
+ * Make sure the buffer has a texture of the given size on the renderer.
+ * If it already had a texture on the renderer its content is kept where it fits,
+ * otherwise the new texture is cleared. Changes the render target.
+ */
+static Bool resizeBufferTexture(BufferTexture* buffer, SDL_Renderer* renderer, int width, int height,
+                                int logicalWidth, int logicalHeight) {
+    buffer->logicalWidth = logicalWidth;
+    buffer->logicalHeight = logicalHeight;
+    if (buffer->texture != NULL && buffer->renderer == renderer
+        && buffer->width == width && buffer->height == height) {
+        return True;
+    }
+    SDL_Texture* texture = SDL_CreateTexture(renderer, DEFAULT_TEXTURE_FORMAT, SDL_TEXTUREACCESS_TARGET,
+                                             width, height);
+    if (texture == NULL) {
+        LOG("SDL_CreateTexture failed in %s: %s\n", __func__, SDL_GetError());
+        freeBufferTexture(buffer);
+        return False;
+    }
+    SDL_SetRenderTarget(renderer, texture);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    if (buffer->texture != NULL && buffer->renderer == renderer) {
+        SDL_Rect rect = {0, 0, MIN(width, buffer->width), MIN(height, buffer->height)};
+        SDL_SetTextureBlendMode(buffer->texture, SDL_BLENDMODE_NONE);
+        SDL_RenderCopy(renderer, buffer->texture, &rect, &rect);
+    }
+    freeBufferTexture(buffer);
+    buffer->texture = texture;
+    buffer->renderer = renderer;
+    buffer->width = width;
+    buffer->height = height;
+    return True;
+}
+
+/*
+ * Make the real window the render target of its renderer, with the whole window in device pixels as the viewport.
+ */
+static void setWindowFramebufferTarget(SDL_Renderer* renderer) {
+    SDL_SetRenderTarget(renderer, NULL);
+    SDL_RenderSetScale(renderer, 1.0f, 1.0f);
+    SDL_RenderSetViewport(renderer, NULL);
+    SDL_RenderSetClipRect(renderer, NULL);
+}
+
+/*
+ * Get the front buffer of the window, if the window is composited because it has a back buffer.
+ * The front buffer has the size of the real window in device pixels, it is created on the first
+ * call with the current content of the window and resized with the window. Returns NULL if the window
+ * is not composited. Changes the render target.
+ */
+SDL_Texture* getFrontBuffer(Window window, SDL_Renderer* renderer) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    if (windowStruct->backBuffer == NULL || windowStruct->sdlWindow == NULL) {
+        return NULL;
+    }
+    BufferTexture* front = &windowStruct->frontBuffer;
+    int width, height, outputWidth, outputHeight;
+    GET_WINDOW_DIMS(window, width, height);
+    if (front->texture != NULL && front->renderer == renderer
+        && front->logicalWidth == width && front->logicalHeight == height) {
+        return front->texture;
+    }
+    setWindowFramebufferTarget(renderer);
+    if (SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight) != 0) {
+        LOG("SDL_GetRendererOutputSize failed in %s: %s\n", __func__, SDL_GetError());
+        return NULL;
+    }
+    SDL_Surface* content = NULL;
+    if (front->texture == NULL || front->renderer != renderer) {
+        // Start compositing with what is currently shown in the window.
+        content = SDL_CreateRGBSurface(0, outputWidth, outputHeight, SDL_SURFACE_DEPTH, DEFAULT_RED_MASK,
+                                       DEFAULT_GREEN_MASK, DEFAULT_BLUE_MASK, DEFAULT_ALPHA_MASK);
+        if (content != NULL && SDL_RenderReadPixels(renderer, NULL, DEFAULT_TEXTURE_FORMAT,
+                                                    content->pixels, content->pitch) != 0) {
+            LOG("SDL_RenderReadPixels failed in %s: %s\n", __func__, SDL_GetError());
+            SDL_FreeSurface(content);
+            content = NULL;
+        }
+    }
+    if (!resizeBufferTexture(front, renderer, outputWidth, outputHeight, width, height)) {
+        SDL_FreeSurface(content);
+        return NULL;
+    }
+    if (content != NULL) {
+        SDL_UpdateTexture(front->texture, NULL, content->pixels, content->pitch);
+        SDL_FreeSurface(content);
+    }
+    return front->texture;
+}
+
+/*
+ * Copy the front buffer of a composited window into the real window. Must be called before presenting it.
+ */
+void presentFrontBuffer(Window window) {
+    BufferTexture* front = &GET_WINDOW_STRUCT(window)->frontBuffer;
+    if (front->texture == NULL) return;
+    setWindowFramebufferTarget(front->renderer);
+    SDL_SetTextureBlendMode(front->texture, SDL_BLENDMODE_NONE);
+    if (SDL_RenderCopy(front->renderer, front->texture, NULL, NULL) != 0) {
+        LOG("SDL_RenderCopy failed in %s: %s\n", __func__, SDL_GetError());
+    }
+}
+
+/*
+ * Stop compositing the window, its content stays in the real window.
+ */
+static void freeFrontBuffer(Window window) {
+    BufferTexture* front = &GET_WINDOW_STRUCT(window)->frontBuffer;
+    if (front->texture == NULL) return;
+    presentFrontBuffer(window);
+    freeBufferTexture(front);
+    markWindowContentChanged(window);
+}
+
+/*
+ * Make the back buffer the render target of the renderer of its window and set the scale of the
+ * renderer for logical window coordinates. The texture is (re)created if the window has no texture
+ * of the right size on its renderer yet. Returns NULL on failure or if the window was destroyed.
+ */
+static SDL_Renderer* setBackBufferTarget(BackBuffer* backBuffer) {
+    Window window = backBuffer->window;
+    if (window == None) return NULL;
+    SDL_Renderer* renderer = getWindowRenderer(window);
+    if (renderer == NULL) return NULL;
+    int width, height, deviceWidth, deviceHeight;
+    GET_WINDOW_DIMS(window, width, height);
+    BufferTexture* front = &GET_WINDOW_STRUCT(window)->frontBuffer;
+    if (front->texture != NULL) {
+        // The buffers of composited windows must be interchangeable.
+        deviceWidth = front->width;
+        deviceHeight = front->height;
+    } else {
+        float scale;
+        SDL_RenderGetScale(renderer, &scale, NULL);
+        deviceWidth = MAX((int) (width * scale + 0.5f), 1);
+        deviceHeight = MAX((int) (height * scale + 0.5f), 1);
+    }
+    if (!resizeBufferTexture(&backBuffer->buffer, renderer, deviceWidth, deviceHeight, width, height)) {
+        return NULL;
+    }
+    SDL_SetRenderTarget(renderer, backBuffer->buffer.texture);
+    SDL_RenderSetScale(renderer, (float) deviceWidth / MAX(width, 1), (float) deviceHeight / MAX(height, 1));
+    return renderer;
+}
+
+SDL_Renderer* getBackBufferRenderer(XdbeBackBuffer backBuffer) {
+    return setBackBufferTarget(GET_BACK_BUFFER(backBuffer));
+}
+
+/*
+ * Free the back buffer of the window when the window is destroyed.
+ * The names of the back buffer stay allocated until they are deallocated.
+ */
+void detachBackBuffer(Window window) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    BackBuffer* backBuffer = windowStruct->backBuffer;
+    if (backBuffer == NULL) return;
+    freeBufferTexture(&windowStruct->frontBuffer);
+    freeBufferTexture(&backBuffer->buffer);
+    backBuffer->window = None;
+    windowStruct->backBuffer = NULL;
+    ssize_t index = findInArray(&backBuffers, backBuffer);
+    if (index != -1) {
+        removeArray(&backBuffers, (size_t) index, False);
+    }
+    if (backBuffers.length == 0) {
+        freeArray(&backBuffers);
+    }
+}
+
+/*
+ * Free all double buffer textures of the renderer. Must be called before the renderer is destroyed.
+ * The content of the back buffers is lost, the front buffers are recreated with the next drawing request.
+ */
+void freeDoubleBuffers(SDL_Renderer* renderer) {
+    size_t i;
+    for (i = 0; i < backBuffers.length; i++) {
+        BackBuffer* backBuffer = backBuffers.array[i];
+        if (backBuffer->buffer.renderer == renderer) {
+            freeBufferTexture(&backBuffer->buffer);
+        }
+        BufferTexture* front = &GET_WINDOW_STRUCT(backBuffer->window)->frontBuffer;
+        if (front->renderer == renderer) {
+            freeBufferTexture(front);
+        }
+    }
+}
+
+static Bool hasMappedChildren(Window window) {
+    Window* children = GET_CHILDREN(window);
+    size_t i;
+    for (i = 0; i < GET_WINDOW_STRUCT(window)->children.length; i++) {
+        if (GET_WINDOW_STRUCT(children[i])->mapState == Mapped) {
+            return True;
+        }
+    }
+    return False;
+}
+
+/*
+ * Read the current content of the window into a new texture with the size of the back buffer.
+ */
+static SDL_Texture* readWindowContent(BackBuffer* backBuffer) {
+    SDL_Renderer* renderer = getWindowRenderer(backBuffer->window);
+    SDL_Surface* surface = renderer != NULL ? getRenderSurface(renderer) : NULL;
+    if (surface == NULL) return NULL;
+    SDL_Texture* texture = SDL_CreateTexture(renderer, DEFAULT_TEXTURE_FORMAT, SDL_TEXTUREACCESS_TARGET,
+                                             backBuffer->buffer.width, backBuffer->buffer.height);
+    if (texture != NULL) {
+        SDL_Rect rect = {0, 0, MIN(surface->w, backBuffer->buffer.width),
+                         MIN(surface->h, backBuffer->buffer.height)};
+        SDL_UpdateTexture(texture, &rect, surface->pixels, surface->pitch);
+    } else {
+        LOG("SDL_CreateTexture failed in %s: %s\n", __func__, SDL_GetError());
+    }
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+static void swapWindowBuffers(Window window, XdbeSwapAction swapAction) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    BackBuffer* backBuffer = windowStruct->backBuffer;
+    if (backBuffer == NULL || setBackBufferTarget(backBuffer) == NULL) return;
+    BufferTexture* back = &backBuffer->buffer;
+    BufferTexture* front = &windowStruct->frontBuffer;
+    if (front->texture != NULL && front->renderer == back->renderer && front->width == back->width
+        && front->height == back->height && !hasMappedChildren(window)) {
+        // The back buffer covers the whole composited window, the buffers can be exchanged.
+        BufferTexture oldFront = *front;
+        *front = *back;
+        *back = oldFront;
+        if (swapAction == XdbeCopied) {
+            SDL_SetRenderTarget(back->renderer, back->texture);
+            SDL_SetTextureBlendMode(front->texture, SDL_BLENDMODE_NONE);
+            SDL_RenderCopy(back->renderer, front->texture, NULL, NULL);
+        }
+        reportDamage(window, NULL);
+    } else {
+        SDL_Texture* untouched = swapAction == XdbeUntouched ? readWindowContent(backBuffer) : NULL;
+        SDL_Rect srcRect = {0, 0, back->width, back->height};
+        SDL_Rect destRect = {0, 0, back->logicalWidth, back->logicalHeight};
+        DrawTarget target;
+        SDL_SetTextureBlendMode(back->texture, SDL_BLENDMODE_NONE);
+        FOR_EACH_DRAW_TARGET(window, NULL, NULL, target) {
+            if (target.renderer == NULL) break;
+            SDL_RenderCopy(target.renderer, back->texture, &srcRect, &destRect);
+        }
+        if (untouched != NULL) {
+            SDL_DestroyTexture(back->texture);
+            back->texture = untouched;
+        }
+    }
+    if (swapAction == XdbeBackground) {
+        unsigned long color = windowStruct->backgroundColor;
+        clearBufferTexture(back, GET_RED_FROM_COLOR(color), GET_GREEN_FROM_COLOR(color),
+                           GET_BLUE_FROM_COLOR(color), GET_ALPHA_FROM_COLOR(color));
+    }
+    markWindowContentChanged(window);
+}
+
+typedef struct {
+    int numWindows;
+    XdbeSwapInfo swapInfo[];
+} SwapArgs;
+
+static void swapBuffersNow(void* data) {
+    SwapArgs* args = data;
+    int i;
+    for (i = 0; i < args->numWindows; i++) {
+        swapWindowBuffers(args->swapInfo[i].swap_window, args->swapInfo[i].swap_action);
+    }
+    free(args);
+}
+
+static Bool checkBackBuffer(Display* display, XdbeBackBuffer buffer, unsigned char minorCode) {
+    if (buffer == None || GET_XID_TYPE(buffer) != BACK_BUFFER) {
+        LOG("Bad back buffer %lu in request %d of %s\n", buffer, minorCode, DBE_PROTOCOL_NAME);
+        handleError(0, display, buffer, 0, DBE_FIRST_ERROR + XdbeBadBuffer, minorCode);
+        return False;
+    }
+    return True;
+}
+
+Status XdbeQueryExtension(Display* display, int* major_version_return, int* minor_version_return) {
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    *major_version_return = DBE_MAJOR_VERSION;
+    *minor_version_return = DBE_MINOR_VERSION;
+    return True;
+}
+
+XdbeBackBuffer XdbeAllocateBackBufferName(Display* display, Window window, XdbeSwapAction swap_action) {
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    TYPE_CHECK(window, WINDOW, display, None);
+    if (IS_INPUT_ONLY(window)) {
+        LOG("BadMatch: Got input only window in %s!\n", __func__);
+        handleError(0, display, window, 0, BadMatch, X_DbeAllocateBackBufferName);
+        return None;
+    }
+    if (swap_action > XdbeCopied) {
+        LOG("BadValue: Got invalid swap action %d in %s!\n", swap_action, __func__);
+        handleError(0, display, None, 0, BadValue, X_DbeAllocateBackBufferName);
+        return None;
+    }
+    syncRenderThread();
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    XdbeBackBuffer backBufferId = ALLOC_XID();
+    if (backBufferId == None) {
+        handleOutOfMemory(0, display, 0, X_DbeAllocateBackBufferName);
+        return None;
+    }
+    BackBuffer* backBuffer = windowStruct->backBuffer;
+    if (backBuffer == NULL) {
+        backBuffer = malloc(sizeof(BackBuffer));
+        if (backBuffer == NULL || !insertArray(&backBuffers, backBuffer)) {
+            free(backBuffer);
+            FREE_XID(backBufferId);
+            handleOutOfMemory(0, display, 0, X_DbeAllocateBackBufferName);
+            return None;
+        }
+        memset(backBuffer, 0, sizeof(BackBuffer));
+        backBuffer->window = window;
+        windowStruct->backBuffer = backBuffer;
+        // The content of a new back buffer is undefined, so its texture is only created once it is used.
+        markWindowContentChanged(window);
+    }
+    backBuffer->numNames++;
+    SET_XID_TYPE(backBufferId, BACK_BUFFER);
+    SET_XID_VALUE(backBufferId, backBuffer);
+    return backBufferId;
+}
+
+Status XdbeDeallocateBackBufferName(Display* display, XdbeBackBuffer buffer) {
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    if (!checkBackBuffer(display, buffer, X_DbeDeallocateBackBufferName)) {
+        return False;
+    }
+    syncRenderThread();
+    BackBuffer* backBuffer = GET_BACK_BUFFER(buffer);
+    detachDamage(buffer);
+    FREE_XID(buffer);
+    if (--backBuffer->numNames > 0) {
+        return True;
+    }
+    if (backBuffer->window != None) {
+        freeFrontBuffer(backBuffer->window);
+        detachBackBuffer(backBuffer->window);
+    }
+    free(backBuffer);
+    return True;
+}
+
+Status XdbeSwapBuffers(Display* display, XdbeSwapInfo* swap_info, int num_windows) {
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    int i, j;
+    for (i = 0; i < num_windows; i++) {
+        Window window = swap_info[i].swap_window;
+        TYPE_CHECK(window, WINDOW, display, False);
+        if (GET_WINDOW_STRUCT(window)->backBuffer == NULL) {
+            LOG("BadMatch: Window %lu has no back buffer in %s!\n", window, __func__);
+            handleError(0, display, window, 0, BadMatch, X_DbeSwapBuffers);
+            return False;
+        }
+        if (swap_info[i].swap_action > XdbeCopied) {
+            LOG("BadValue: Got invalid swap action %d in %s!\n", swap_info[i].swap_action, __func__);
+            handleError(0, display, None, 0, BadValue, X_DbeSwapBuffers);
+            return False;
+        }
+        for (j = 0; j < i; j++) {
+            if (swap_info[j].swap_window == window) {
+                LOG("BadMatch: Window %lu is swapped twice in %s!\n", window, __func__);
+                handleError(0, display, window, 0, BadMatch, X_DbeSwapBuffers);
+                return False;
+            }
+        }
+    }
+    if (num_windows <= 0) return True;
+    SwapArgs* args = malloc(sizeof(SwapArgs) + sizeof(XdbeSwapInfo) * num_windows);
+    if (args == NULL) {
+        handleOutOfMemory(0, display, 0, X_DbeSwapBuffers);
+        return False;
+    }
+    args->numWindows = num_windows;
+    memcpy(args->swapInfo, swap_info, sizeof(XdbeSwapInfo) * num_windows);
+    // Swapped after the drawing requests queued before, like any other drawing request.
+    enqueueRenderCommand(swapBuffersNow, args);
+    return True;
+}
+
+Status XdbeBeginIdiom(Display* display) {
+    // The requests of an idiom are executed in order anyway, there is nothing to optimize.
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    return True;
+}
+
+Status XdbeEndIdiom(Display* display) {
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    return True;
+}
+
+XdbeScreenVisualInfo* XdbeGetVisualInfo(Display* display, Drawable* screen_specifiers, int* num_screens) {
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    int i;
+    if (*num_screens == 0) {
+        *num_screens = ScreenCount(display);
+    } else {
+        for (i = 0; i < *num_screens; i++) {
+            TYPE_CHECK(screen_specifiers[i], DRAWABLE, display, NULL);
+        }
+    }
+    // Every window of the screen supports double buffering with the root visual.
+    XdbeScreenVisualInfo* visualInfo = malloc(sizeof(XdbeScreenVisualInfo) * *num_screens);
+    if (visualInfo == NULL) {
+        handleOutOfMemory(0, display, 0, X_DbeGetVisualInfo);
+        return NULL;
+    }
+    for (i = 0; i < *num_screens; i++) {
+        visualInfo[i].count = 1;
+        visualInfo[i].visinfo = malloc(sizeof(XdbeVisualInfo));
+        if (visualInfo[i].visinfo == NULL) {
+            visualInfo[i].count = 0;
+            continue;
+        }
+        Screen* screen = DefaultScreenOfDisplay(display);
+        visualInfo[i].visinfo->visual = XVisualIDFromVisual(screen->root_visual);
+        visualInfo[i].visinfo->depth = screen->root_depth;
+        visualInfo[i].visinfo->perflevel = 0;
+    }
+    return visualInfo;
+}
+
+void XdbeFreeVisualInfo(XdbeScreenVisualInfo* visual_info) {
+    // The number of screens is not known here, but there is only one.
+    if (visual_info == NULL) return;
+    free(visual_info[0].visinfo);
+    free(visual_info);
+}
+
+XdbeBackBufferAttributes* XdbeGetBackBufferAttributes(Display* display, XdbeBackBuffer buffer) {
+    SET_X_SERVER_REQUEST(display, DBE_MAJOR_OPCODE);
+    if (!checkBackBuffer(display, buffer, X_DbeGetBackBufferAttributes)) {
+        return NULL;
+    }
+    XdbeBackBufferAttributes* attributes = malloc(sizeof(XdbeBackBufferAttributes));
+    if (attributes == NULL) {
+        handleOutOfMemory(0, display, 0, X_DbeGetBackBufferAttributes);
+        return NULL;
+    }
+    attributes->window = GET_BACK_BUFFER(buffer)->window;
+    return attributes;
+}
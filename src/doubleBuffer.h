@@ -0,0 +1,52 @@
+#ifndef _DOUBLE_BUFFER_H_
+#define _DOUBLE_BUFFER_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/Xdbe.h>
+
+/*
+ * The DOUBLE-BUFFER extension (Xdbe): A back buffer is a render target texture of the renderer
+ * of its window, drawing into it doesn't touch the window. Top level windows with a back buffer
+ * are composited: They are drawn into a front buffer texture, which is copied to the real window
+ * when it is presented, so swapping the buffers only exchanges the two textures.
+ * The back buffers of other windows are copied into the window when they are swapped.
+ */
+
+/* Minor opcodes of the DOUBLE-BUFFER requests. */
+#define X_DbeGetVersion 0
+#define X_DbeAllocateBackBufferName 1
+#define X_DbeDeallocateBackBufferName 2
+#define X_DbeSwapBuffers 3
+#define X_DbeBeginIdiom 4
+#define X_DbeEndIdiom 5
+#define X_DbeGetVisualInfo 6
+#define X_DbeGetBackBufferAttributes 7
+
+typedef struct {
+    SDL_Texture* texture;
+    /* The renderer the texture belongs to. */
+    SDL_Renderer* renderer;
+    /* The size of the texture in device pixels. */
+    int width, height;
+    /* The size of the window the texture was created for. */
+    int logicalWidth, logicalHeight;
+} BufferTexture;
+
+typedef struct {
+    /* The window of this back buffer, None once the window is destroyed. */
+    Window window;
+    BufferTexture buffer;
+    /* The number of back buffer names which refer to this back buffer. */
+    int numNames;
+} BackBuffer;
+
+#define GET_BACK_BUFFER(backBuffer) ((BackBuffer*) GET_XID_VALUE(backBuffer))
+
+SDL_Renderer* getBackBufferRenderer(XdbeBackBuffer backBuffer);
+SDL_Texture* getFrontBuffer(Window window, SDL_Renderer* renderer);
+void presentFrontBuffer(Window window);
+void detachBackBuffer(Window window);
+void freeDoubleBuffers(SDL_Renderer* renderer);
+
+#endif /* _DOUBLE_BUFFER_H_ */
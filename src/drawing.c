@@ -5,18 +5,22 @@
 #include "display.h"
 #include "util.h"
 #include "gc.h"
+#include "bitmap.h"
+#include "windowClip.h"
+#include "present.h"
+#include "scale.h"
+#include "raster.h"
+#include "renderThread.h"
+#include "texturePool.h"
+#include "damage.h"
+#include "pixelConversion.h"
 
 /*
  * Flip all screen children and cause them to draw their content to the screen.
  */
 void flipScreen() {
-	Window* children = GET_CHILDREN(SCREEN_WINDOW);
-	int i;
-	for (i = 0; i < GET_WINDOW_STRUCT(SCREEN_WINDOW)->children.length; i++) {
-		if (children[i] != NULL && GET_WINDOW_STRUCT(children[i])->sdlRenderer != NULL) {
-			SDL_RenderPresent(GET_WINDOW_STRUCT(children[i])->sdlRenderer);
-		}
-	}
+	presentChangedWindows(False);
+	syncRenderThread();
 	#ifdef DEBUG_WINDOWS
 	printWindowsHierarchy();
     //drawDebugWindowSurfacePlanes();
@@ -42,7 +46,7 @@ SDL_Renderer* getWindowRenderer(Window window) {
 	if (renderer == NULL) {
 		if (IS_MAPPED_TOP_LEVEL_WINDOW(window)) {
 			renderer = SDL_CreateRenderer(GET_WINDOW_STRUCT(window)->sdlWindow, -1,
-										  SDL_RENDERER_ACCELERATED);
+										  getRendererFlags(SDL_RENDERER_ACCELERATED));
 		}
 		if (renderer == NULL) {
 			renderer = GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer;
@@ -50,23 +54,45 @@ SDL_Renderer* getWindowRenderer(Window window) {
 			if (texture == NULL) {
 				int w, h;
 				GET_WINDOW_DIMS(window, w, h);
-				texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888,
-											SDL_TEXTUREACCESS_TARGET, w, h);
+				texture = acquireTexture(renderer, DEFAULT_TEXTURE_FORMAT, SDL_TEXTUREACCESS_TARGET,
+										 TO_DEVICE(w), TO_DEVICE(h));
 				if (texture == NULL) {
-					fprintf(stderr, "WTF: SDL_CreateTexture failed in %s for window %p: %s\n",
+					fprintf(stderr, "WTF: acquireTexture failed in %s for window %p: %s\n",
 							__func__, window, SDL_GetError());
 					#ifdef DEBUG_WINDOWS
 					printWindowsHierarchy();
 					#endif
 				} else {
 					GET_WINDOW_STRUCT(window)->sdlTexture = texture;
+					GET_WINDOW_STRUCT(window)->textureWidth = TO_DEVICE(w);
+					GET_WINDOW_STRUCT(window)->textureHeight = TO_DEVICE(h);
 				}
-				SDL_SetRenderTarget(renderer, texture);
 			}
+			SDL_SetRenderTarget(renderer, texture);
 		} else {
 			GET_WINDOW_STRUCT(window)->sdlRenderer = renderer;
 		}
 	}
+	if (GET_WINDOW_STRUCT(window)->sdlTexture == NULL) {
+		// Composited windows are drawn into their front buffer, see doubleBuffer.h.
+		SDL_Texture* frontBuffer = getFrontBuffer(window, renderer);
+		if (SDL_GetRenderTarget(renderer) != frontBuffer) {
+			SDL_SetRenderTarget(renderer, frontBuffer);
+		}
+	}
+	float scaleX = DEVICE_SCALE, scaleY = DEVICE_SCALE;
+	if (window != SCREEN_WINDOW && GET_WINDOW_STRUCT(window)->sdlWindow != NULL) {
+		// The platform may provide a different number of pixels than requested on high density displays.
+		int outputWidth, outputHeight, logicalWidth, logicalHeight;
+		GET_WINDOW_DIMS(window, logicalWidth, logicalHeight);
+		if (SDL_GetRendererOutputSize(renderer, &outputWidth, &outputHeight) == 0
+			&& logicalWidth > 0 && logicalHeight > 0) {
+			scaleX = (float) outputWidth / logicalWidth;
+			scaleY = (float) outputHeight / logicalHeight;
+		}
+	}
+	// All geometry is logical, the renderer scales it to the device pixels of the target.
+	SDL_RenderSetScale(renderer, scaleX, scaleY);
 	#ifdef SDL_VIEWPORT_INCORRECT_COORDINATE_ORIGIN
 	int w, h;
 	GET_WINDOW_DIMS(window, w, h);
@@ -79,9 +105,138 @@ SDL_Renderer* getWindowRenderer(Window window) {
 	return renderer;
 }
 
+Bool nextDrawTarget(Drawable drawable, GC gc, const SDL_Rect* bounds, DrawTarget* target) {
+	if (IS_TYPE(drawable, WINDOW)) {
+		// Drawing into minimized or fully covered windows is dropped, they get an Expose once visible,
+		// unless their content is preserved by the backing store.
+		if (target->nextIndex == 0 && getWindowVisibility(drawable) == VisibilityFullyObscured
+			&& !isContentPreserved(drawable)) {
+			return False;
+		}
+		Bool includeInferiors = gc != NULL && GET_GC(gc)->subWindowMode == IncludeInferiors;
+		pixman_region16_t* clipRegion = getWindowClipRegion(drawable, includeInferiors);
+		int numBoxes;
+		pixman_box16_t* boxes = pixman_region_rectangles(clipRegion, &numBoxes);
+		SDL_Rect clipRect;
+		while (target->nextIndex < numBoxes) {
+			pixman_box16_t* box = &boxes[target->nextIndex++];
+			clipRect.x = box->x1;
+			clipRect.y = box->y1;
+			clipRect.w = box->x2 - box->x1;
+			clipRect.h = box->y2 - box->y1;
+			if (bounds != NULL && !SDL_IntersectRect(bounds, &clipRect, &clipRect)) {
+				continue;
+			}
+			if (target->renderer == NULL) {
+				target->renderer = getWindowRenderer(drawable);
+				if (target->renderer == NULL) {
+					return True;
+				}
+			}
+			SDL_RenderSetClipRect(target->renderer, &clipRect);
+			target->offsetX = target->offsetY = 0;
+			reportDamage(drawable, &clipRect);
+			return True;
+		}
+		return False;
+	} else if (IS_TYPE(drawable, BACK_BUFFER)) {
+		if (target->nextIndex++ > 0) {
+			return False;
+		}
+		target->renderer = getBackBufferRenderer(drawable);
+		target->offsetX = target->offsetY = 0;
+		reportDamage(drawable, bounds);
+		return True;
+	} else if (!IS_TYPE(drawable, PIXMAP) || IS_BITMAP(drawable)) {
+		fprintf(stderr, "Got unknown or depth 1 drawable in %s\n", __func__);
+		return False;
+	}
+	PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(drawable);
+	SDL_Rect tileRect, intersection;
+	while (target->nextIndex < pixmapStruct->columns * pixmapStruct->rows) {
+		int column = target->nextIndex % pixmapStruct->columns;
+		int row = target->nextIndex / pixmapStruct->columns;
+		target->nextIndex++;
+		getPixmapTileRect(drawable, column, row, &tileRect);
+		if (bounds != NULL && !SDL_IntersectRect(bounds, &tileRect, &intersection)) {
+			continue;
+		}
+		target->renderer = GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer;
+		target->offsetX = tileRect.x;
+		target->offsetY = tileRect.y;
+		SDL_Texture* tile = getPixmapTile(drawable, column, row, True);
+		if (tile == NULL || SDL_SetRenderTarget(target->renderer, tile) != 0) {
+			LOG("Failed to get the tile (%d, %d) of pixmap %lu in %s: %s\n", column, row, drawable,
+				__func__, SDL_GetError());
+			target->renderer = NULL;
+		} else {
+			SDL_RenderSetScale(target->renderer, DEVICE_SCALE, DEVICE_SCALE);
+			reportDamage(drawable, bounds != NULL ? &intersection : &tileRect);
+		}
+		return True;
+	}
+	return False;
+}
+
+/*
+ * Complete the iteration over the render targets of the drawable, see FOR_EACH_DRAW_TARGET:
+ * Reset the clip rectangle of the window renderer and mark the window as changed.
+ */
+void endDrawTargets(Drawable drawable, DrawTarget* target) {
+	target->nextIndex = -1;
+	if (IS_TYPE(drawable, WINDOW) && target->renderer != NULL) {
+		SDL_RenderSetClipRect(target->renderer, NULL);
+		markWindowContentChanged(drawable);
+	}
+}
+
+static void getPointsBounds(SDL_Point* points, int npoints, int lineWidth, SDL_Rect* bounds) {
+	int i, minX, minY, maxX, maxY;
+	minX = maxX = points[0].x;
+	minY = maxY = points[0].y;
+	for (i = 1; i < npoints; i++) {
+		minX = MIN(minX, points[i].x);
+		minY = MIN(minY, points[i].y);
+		maxX = MAX(maxX, points[i].x);
+		maxY = MAX(maxY, points[i].y);
+	}
+	lineWidth = lineWidth / 2 + 1;
+	bounds->x = minX - lineWidth;
+	bounds->y = minY - lineWidth;
+	bounds->w = maxX - minX + 2 * lineWidth;
+	bounds->h = maxY - minY + 2 * lineWidth;
+}
+
+/*
+ * Read the current viewport of the renderer into a new surface, in the device pixels of the render target.
+ */
 SDL_Surface* getRenderSurface(SDL_Renderer* renderer) {
-	SDL_Rect rect;
+	return getRenderSurfaceArea(renderer, NULL);
+}
+
+/*
+ * Read an area of the current viewport of the renderer into a new surface, in the device pixels of the
+ * render target. The area is in logical coordinates relative to the viewport, NULL means the whole viewport.
+ * Returns NULL if the area is outside of the viewport.
+ */
+SDL_Surface* getRenderSurfaceArea(SDL_Renderer* renderer, const SDL_Rect* area) {
+	SDL_Rect rect, viewportRect;
+	float scale;
 	SDL_RenderGetViewport(renderer, &rect);
+	SDL_RenderGetScale(renderer, &scale, NULL);
+	if (area != NULL) {
+		viewportRect.x = viewportRect.y = 0;
+		viewportRect.w = rect.w;
+		viewportRect.h = rect.h;
+		if (!SDL_IntersectRect(area, &viewportRect, &viewportRect)) {
+			return NULL;
+		}
+		rect.x += viewportRect.x;
+		rect.y += viewportRect.y;
+		rect.w = viewportRect.w;
+		rect.h = viewportRect.h;
+	}
+	scaleRect(&rect, scale);
 	SDL_Surface* surface = SDL_CreateRGBSurface(0, rect.w, rect.h, SDL_SURFACE_DEPTH,
 												DEFAULT_RED_MASK, DEFAULT_GREEN_MASK,
 												DEFAULT_BLUE_MASK, DEFAULT_ALPHA_MASK);
@@ -89,7 +244,7 @@ SDL_Surface* getRenderSurface(SDL_Renderer* renderer) {
 		fprintf(stderr, "SDL_CreateRGBSurface failed in %s: %s\n", __func__, SDL_GetError());
 		return NULL;
 	}
-	if (SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_RGBA8888, surface->pixels, surface->pitch) != 0) {
+	if (SDL_RenderReadPixels(renderer, &rect, DEFAULT_TEXTURE_FORMAT, surface->pixels, surface->pitch) != 0) {
 		fprintf(stderr, "SDL_RenderReadPixels failed in %s: %s\n", __func__, SDL_GetError());
 		SDL_FreeSurface(surface);
 		return NULL;
@@ -97,11 +252,165 @@ SDL_Surface* getRenderSurface(SDL_Renderer* renderer) {
 	return surface;
 }
 
+/*
+ * Read the area of the drawable (or all of it, if area is NULL) into a new surface in the device pixels
+ * of the drawable, with the format or with the default format if format is SDL_PIXELFORMAT_UNKNOWN.
+ * Set bits of bitmaps are read as opaque white and cleared bits as transparent black.
+ * Must be called after the drawing that should be read was executed. Returns NULL on failure.
+ */
+SDL_Surface* getDrawableSurfaceArea(Drawable drawable, const SDL_Rect* area, Uint32 format) {
+	SDL_Surface* surface;
+	if (IS_TYPE(drawable, PIXMAP)) {
+		surface = getPixmapSurface(drawable, area);
+	} else {
+		SDL_Renderer* renderer = NULL;
+		GET_RENDERER(drawable, renderer);
+		if (renderer == NULL) return NULL;
+		surface = getRenderSurfaceArea(renderer, area);
+	}
+	if (surface == NULL || format == SDL_PIXELFORMAT_UNKNOWN || surface->format->format == format) {
+		return surface;
+	}
+	PixelLayout nativeLayout, targetLayout;
+	PixelConversion conversion;
+	SDL_Surface* converted;
+	getNativePixelLayout(&nativeLayout);
+	if (surface->format->format == DEFAULT_TEXTURE_FORMAT && getFormatPixelLayout(format, &targetLayout)
+		&& initPixelConversion(&conversion, &nativeLayout, &targetLayout)) {
+		converted = SDL_CreateRGBSurfaceWithFormat(0, surface->w, surface->h, targetLayout.bitsPerPixel, format);
+		if (converted != NULL) {
+			convertPixels(&conversion, surface->pixels, surface->pitch, converted->pixels, converted->pitch,
+						  surface->w, surface->h);
+		}
+	} else {
+		converted = SDL_ConvertSurfaceFormat(surface, format, 0);
+	}
+	if (converted == NULL) {
+		LOG("Failed to convert the read surface in %s: %s\n", __func__, SDL_GetError());
+	}
+	SDL_FreeSurface(surface);
+	return converted;
+}
+
+/*
+ * Fill the polygon with the given points in drawable coordinates, which are modified.
+ */
+static void fillPolygon(Display* display, Drawable d, GC gc, RasterPoint* rasterPoints, int npoints) {
+	GraphicContext* gContext = GET_GC(gc);
+	int i, minX, minY, maxX, maxY;
+	minX = maxX = (int) rasterPoints[0].x;
+	minY = maxY = (int) rasterPoints[0].y;
+	for (i = 1; i < npoints; i++) {
+		minX = MIN(minX, (int) rasterPoints[i].x);
+		maxX = MAX(maxX, (int) rasterPoints[i].x);
+		minY = MIN(minY, (int) rasterPoints[i].y);
+		maxY = MAX(maxY, (int) rasterPoints[i].y);
+	}
+	if (IS_BITMAP(d)) {
+		// TODO: Respect the fill style
+		fillBitmapPolygon(d, rasterPoints, npoints, gContext->fillRule, (int) (gContext->foreground & 1));
+		return;
+	}
+	if (gContext->fillStyle != FillSolid) {
+		LOG("%s: Fill style %d is not supported, filling solid\n", __func__, gContext->fillStyle);
+	}
+	SDL_Rect bounds = {minX, minY, maxX - minX, maxY - minY};
+	if (bounds.w == 0 || bounds.h == 0) {
+		return;
+	}
+	// Rasterize the polygon in software at the device resolution into a transparent surface.
+	SDL_Surface* polygonSurface = SDL_CreateRGBSurface(0, TO_DEVICE(bounds.w), TO_DEVICE(bounds.h), 32,
+													   0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+	if (polygonSurface == NULL) {
+		LOG("SDL_CreateRGBSurface failed in %s: %s\n", __func__, SDL_GetError());
+		handleOutOfMemory(0, display, 0, 0);
+		return;
+	}
+	for (i = 0; i < npoints; i++) {
+		rasterPoints[i].x = (rasterPoints[i].x - bounds.x) * DEVICE_SCALE;
+		rasterPoints[i].y = (rasterPoints[i].y - bounds.y) * DEVICE_SCALE;
+	}
+	long color = gContext->foreground;
+	Uint32 argbColor = (Uint32) GET_ALPHA_FROM_COLOR(color) << 24 | (Uint32) GET_RED_FROM_COLOR(color) << 16
+					   | (Uint32) GET_GREEN_FROM_COLOR(color) << 8 | GET_BLUE_FROM_COLOR(color);
+	RasterFrame frame;
+	Bool res;
+	SDL_LockSurface(polygonSurface);
+	initRasterFrame(&frame, polygonSurface->pixels, polygonSurface->pitch, polygonSurface->w,
+					polygonSurface->h, False);
+	res = rasterFillPolygon(&frame, rasterPoints, npoints, gContext->fillRule, argbColor)
+		  && flushRasterFrame(&frame);
+	freeRasterFrame(&frame);
+	SDL_UnlockSurface(polygonSurface);
+	if (!res) {
+		SDL_FreeSurface(polygonSurface);
+		handleOutOfMemory(0, display, 0, 0);
+		return;
+	}
+	SDL_Rect polygonRect = {0, 0, polygonSurface->w, polygonSurface->h};
+	SDL_Texture* polygonTexture = NULL;
+	SDL_Renderer* polygonTextureRenderer = NULL;
+	DrawTarget target;
+	FOR_EACH_DRAW_TARGET(d, gc, &bounds, target) {
+		if (target.renderer == NULL) {
+			LOG("Failed to create renderer in %s: %s\n", __func__, SDL_GetError());
+			handleError(0, display, d, 0, BadDrawable, 0);
+			break;
+		}
+		if (target.renderer != polygonTextureRenderer) {
+			releaseTexture(polygonTextureRenderer, polygonTexture);
+			polygonTexture = acquireSurfaceTexture(target.renderer, polygonSurface);
+			polygonTextureRenderer = target.renderer;
+			if (polygonTexture == NULL) {
+				LOG("acquireSurfaceTexture failed in %s: %s\n", __func__, SDL_GetError());
+				break;
+			}
+		}
+		SDL_Rect destRect = bounds;
+		destRect.x -= target.offsetX;
+		destRect.y -= target.offsetY;
+		SDL_RenderCopy(target.renderer, polygonTexture, &polygonRect, &destRect);
+	}
+	releaseTexture(polygonTextureRenderer, polygonTexture);
+	SDL_FreeSurface(polygonSurface);
+}
+
+typedef struct {
+	int numPoints;
+	RasterPoint points[];
+} PolygonArgs;
+
+static void fillDeferredPolygon(Display* display, Drawable d, GC gc, void* args) {
+	fillPolygon(display, d, gc, ((PolygonArgs*) args)->points, ((PolygonArgs*) args)->numPoints);
+}
+
 int XFillPolygon(Display* display, Drawable d, GC gc, XPoint *points, int npoints, int shape, int mode) {
     // https://tronche.com/gui/x/xlib/graphics/filling-areas/XFillPolygon.html
-	SET_X_SERVER_REQUEST(display, X_PolyFillArc);
-	WARN_UNIMPLEMENTED;
-    return 1;
+	SET_X_SERVER_REQUEST(display, X_FillPoly);
+	TYPE_CHECK(d, DRAWABLE, display, 0);
+	if (npoints < 3) {
+		return 1;
+	}
+	RasterPoint rasterPoints[npoints];
+	int i;
+	for (i = 0; i < npoints; i++) {
+		rasterPoints[i].x = points[i].x;
+		rasterPoints[i].y = points[i].y;
+		if (mode == CoordModePrevious && i > 0) {
+			rasterPoints[i].x += rasterPoints[i - 1].x;
+			rasterPoints[i].y += rasterPoints[i - 1].y;
+		}
+	}
+	PolygonArgs* args = beginDeferredDraw(display, d, gc, fillDeferredPolygon,
+										  sizeof(PolygonArgs) + sizeof(RasterPoint) * npoints);
+	if (args != NULL) {
+		args->numPoints = npoints;
+		memcpy(args->points, rasterPoints, sizeof(RasterPoint) * npoints);
+		submitDeferredDraw(args);
+		return 1;
+	}
+	fillPolygon(display, d, gc, rasterPoints, npoints);
+	return 1;
 }
 
 int XFillArc(Display *display, Drawable d, GC gc, int x, int y, unsigned int width, unsigned int height, int angle1, int angle2) {
@@ -118,11 +427,124 @@ int XDrawArc(Display *display, Drawable d, GC gc, int x, int y, unsigned int wid
     return 1;
 }
 
+static void copyPlane(Display* display, Drawable src, Drawable dest, GC gc, SDL_Rect srcRect, int dest_x, int dest_y) {
+	SDL_Rect destRect = {dest_x, dest_y, srcRect.w, srcRect.h};
+	if (IS_BITMAP(dest)) {
+		copyBitmapArea(src, dest, &srcRect, dest_x, dest_y);
+		return;
+	}
+	GraphicContext* gContext = GET_GC(gc);
+	SDL_Rect targetRect;
+	DrawTarget target;
+	FOR_EACH_DRAW_TARGET(dest, gc, &destRect, target) {
+		if (target.renderer == NULL) {
+			handleError(0, display, dest, 0, BadAlloc, 0);
+			break;
+		}
+		SDL_Texture* bitmapTexture = getBitmapTexture(src, target.renderer);
+		if (bitmapTexture == NULL) {
+			handleOutOfMemory(0, display, 0, 0);
+			break;
+		}
+		targetRect = destRect;
+		targetRect.x -= target.offsetX;
+		targetRect.y -= target.offsetY;
+		// Cleared bits get the background, set bits the foreground color.
+		SDL_SetRenderDrawBlendMode(target.renderer, SDL_BLENDMODE_NONE);
+		SDL_SetRenderDrawColor(target.renderer, GET_RED_FROM_COLOR(gContext->background),
+							   GET_GREEN_FROM_COLOR(gContext->background),
+							   GET_BLUE_FROM_COLOR(gContext->background),
+							   GET_ALPHA_FROM_COLOR(gContext->background));
+		SDL_RenderFillRect(target.renderer, &targetRect);
+		SDL_SetTextureColorMod(bitmapTexture, GET_RED_FROM_COLOR(gContext->foreground),
+							   GET_GREEN_FROM_COLOR(gContext->foreground),
+							   GET_BLUE_FROM_COLOR(gContext->foreground));
+		SDL_SetTextureAlphaMod(bitmapTexture, GET_ALPHA_FROM_COLOR(gContext->foreground));
+		if (SDL_RenderCopy(target.renderer, bitmapTexture, &srcRect, &targetRect) != 0) {
+			LOG("SDL_RenderCopy failed in %s: %s\n", __func__, SDL_GetError());
+		}
+	}
+}
+
+typedef struct {
+	Drawable src;
+	SDL_Rect srcRect;
+	int destX, destY;
+} CopyPlaneArgs;
+
+static void copyDeferredPlane(Display* display, Drawable d, GC gc, void* args) {
+	CopyPlaneArgs* copy = args;
+	copyPlane(display, copy->src, d, gc, copy->srcRect, copy->destX, copy->destY);
+}
+
 int XCopyPlane(Display *display, Drawable src, Drawable dest, GC gc, int src_x, int src_y, unsigned int width, unsigned int height, int dest_x, int dest_y, unsigned long plane) {
     // https://tronche.com/gui/x/xlib/graphics/XCopyPlane.html
     SET_X_SERVER_REQUEST(display, X_CopyPlane);
-    WARN_UNIMPLEMENTED;
-    return 1;
+	TYPE_CHECK(src, DRAWABLE, display, 0);
+	TYPE_CHECK(dest, DRAWABLE, display, 0);
+	if (!IS_BITMAP(src)) {
+		// TODO: Copy planes of deeper drawables
+		WARN_UNIMPLEMENTED;
+		return 1;
+	}
+	if (plane != 1) {
+		LOG("BadValue: Got invalid plane %lu for a bitmap in %s!\n", plane, __func__);
+		handleError(0, display, None, 0, BadValue, 0);
+		return 0;
+	}
+	SDL_Rect srcRect = {src_x, src_y, (int) width, (int) height};
+	// The bitmap textures and bits of the source are used by the render thread as well.
+	CopyPlaneArgs* args = beginDeferredDraw(display, dest, gc, copyDeferredPlane, sizeof(CopyPlaneArgs));
+	if (args != NULL) {
+		args->src = src;
+		args->srcRect = srcRect;
+		args->destX = dest_x;
+		args->destY = dest_y;
+		submitDeferredDraw(args);
+		return 1;
+	}
+	copyPlane(display, src, dest, gc, srcRect, dest_x, dest_y);
+	return 1;
+}
+
+typedef struct {
+	int numPoints;
+	SDL_Point points[];
+} LinesArgs;
+
+static void drawLines(Display* display, Drawable d, GC gc, SDL_Point* sdlPoints, int npoints) {
+	SDL_Point targetPoints[npoints];
+	int i;
+	GraphicContext* gContext = GET_GC(gc);
+	long color = gContext->foreground;
+	if (IS_BITMAP(d)) {
+		drawBitmapLines(d, sdlPoints, npoints, (int) (gContext->foreground & 1));
+		return;
+	}
+	SDL_Rect bounds;
+	getPointsBounds(sdlPoints, npoints, gContext->lineWidth, &bounds);
+	DrawTarget target;
+	FOR_EACH_DRAW_TARGET(d, gc, &bounds, target) {
+		if (target.renderer == NULL) {
+			fprintf(stderr, "Failed to create renderer in %s: %s\n", __func__, SDL_GetError());
+			handleError(0, display, None, 0, BadValue, 0);
+			break;
+		}
+		for (i = 0; i < npoints; i++) {
+			targetPoints[i].x = sdlPoints[i].x - target.offsetX;
+			targetPoints[i].y = sdlPoints[i].y - target.offsetY;
+		}
+		SDL_SetRenderDrawBlendMode(target.renderer, SDL_BLENDMODE_BLEND);
+		SDL_SetRenderDrawColor(target.renderer, GET_RED_FROM_COLOR(color), GET_GREEN_FROM_COLOR(color),
+			GET_BLUE_FROM_COLOR(color), GET_ALPHA_FROM_COLOR(color));
+		if (SDL_RenderDrawLines(target.renderer, &targetPoints[0], npoints)) {
+			fprintf(stderr, "SDL_RenderDrawLines failed in %s: %s\n", __func__, SDL_GetError());
+		}
+	}
+}
+
+static void drawDeferredLines(Display* display, Drawable d, GC gc, void* args) {
+	drawLines(display, d, gc, ((LinesArgs*) args)->points, ((LinesArgs*) args)->numPoints);
 }
 
 int XDrawLine(Display* display, Drawable d, GC gc, int x1, int y1, int x2, int y2) {
@@ -141,14 +563,6 @@ int XDrawLines(Display *display, Drawable d, GC gc, XPoint *points, int npoints,
 		handleError(0, display, None, 0, BadValue, 0);
 		return 1;
 	}
-	SDL_Renderer* renderer = NULL;
-	GET_RENDERER(d, renderer);
-	if (renderer == NULL) {
-		fprintf(stderr, "Failed to create renderer in %s: %s\n", __func__, SDL_GetError());
-		handleError(0, display, None, 0, BadValue, 0);
-		return 1;
-	}
-	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 	SDL_Point sdlPoints[npoints];
 	int i;
 	if (mode == CoordModeOrigin) {
@@ -170,67 +584,134 @@ int XDrawLines(Display *display, Drawable d, GC gc, XPoint *points, int npoints,
 //    for (i = 0; i < npoints; i++) {
 //        fprintf(stderr, " (x = %d, y = %d)\n", sdlPoints[i].x, sdlPoints[i].y);
 //    }
-	GraphicContext* gContext = GET_GC(gc);
-	long color = gContext->foreground;
-	SDL_SetRenderDrawColor(renderer, GET_RED_FROM_COLOR(color), GET_GREEN_FROM_COLOR(color),
-		GET_BLUE_FROM_COLOR(color), GET_ALPHA_FROM_COLOR(color));
-	if (SDL_RenderDrawLines(renderer, &sdlPoints[0], npoints)) {
-		fprintf(stderr, "SDL_RenderDrawLines failed in %s: %s\n", __func__, SDL_GetError());
+	LinesArgs* args = beginDeferredDraw(display, d, gc, drawDeferredLines,
+										sizeof(LinesArgs) + sizeof(SDL_Point) * npoints);
+	if (args != NULL) {
+		args->numPoints = npoints;
+		memcpy(args->points, sdlPoints, sizeof(SDL_Point) * npoints);
+		submitDeferredDraw(args);
+		return 1;
 	}
-	SDL_RenderPresent(renderer);
+	drawLines(display, d, gc, sdlPoints, npoints);
+	return 1;
 }
 
-int XCopyArea(Display* display, Drawable src, Drawable dest, GC gc, int src_x, int src_y,
-               unsigned int width, unsigned int height, int dest_x, int dest_y) {
-    // https://tronche.com/gui/x/xlib/graphics/XCopyArea.html
-	SET_X_SERVER_REQUEST(display, X_CopyArea);
-	TYPE_CHECK(src, DRAWABLE, display, 0);
-	TYPE_CHECK(dest, DRAWABLE, display, 0);
-	LOG("%s: Copy area from %p to %p\n", __func__, src, dest);
-	if (IS_TYPE(src, WINDOW)) {
-		if (IS_INPUT_ONLY(src)) {
-			LOG("BadMatch: Got input only window as the source in %s!\n", __func__);
-			handleError(0, display, src, 0, BadMatch, 0);
-			return 0;
-		} else if (GET_WINDOW_STRUCT(src)->mapState == UnMapped && GET_WINDOW_STRUCT(src)->sdlTexture == NULL) {
-			return 0;
-		}
+static void copyArea(Display* display, Drawable src, Drawable dest, GC gc, SDL_Rect srcRect, int dest_x, int dest_y) {
+	if (IS_TYPE(src, WINDOW) && GET_WINDOW_STRUCT(src)->mapState == UnMapped
+		&& GET_WINDOW_STRUCT(src)->sdlTexture == NULL) {
+		return;
+	}
+	SDL_Rect destRect = {dest_x, dest_y, srcRect.w, srcRect.h};
+	if (IS_BITMAP(src)) {
+		copyBitmapArea(src, dest, &srcRect, dest_x, dest_y);
+		return;
 	}
-	if (IS_TYPE(dest, WINDOW)) {
-		if (IS_INPUT_ONLY(dest)) {
-			LOG("BadMatch: Got input only window as the destination in %s!\n", __func__);
-			handleError(0, display, dest, 0, BadMatch, 0);
-			return 0;
+	SDL_Surface* srcSurface;
+	if (IS_TYPE(src, PIXMAP)) {
+		// Only read the requested area, the pixmap might consist of many tiles.
+		SDL_Rect pixmapRect = {0, 0, (int) GET_PIXMAP_STRUCT(src)->width, (int) GET_PIXMAP_STRUCT(src)->height};
+		if (!SDL_IntersectRect(&srcRect, &pixmapRect, &pixmapRect)) {
+			return;
+		}
+		destRect.x += pixmapRect.x - srcRect.x;
+		destRect.y += pixmapRect.y - srcRect.y;
+		destRect.w = srcRect.w = pixmapRect.w;
+		destRect.h = srcRect.h = pixmapRect.h;
+		srcSurface = getPixmapSurface(src, &pixmapRect);
+		srcRect.x = srcRect.y = 0;
+		if (srcSurface != NULL) {
+			srcRect.w = srcSurface->w;
+			srcRect.h = srcSurface->h;
 		}
-		SDL_Renderer* destRenderer = getWindowRenderer(dest);
+	} else {
 		SDL_Renderer* srcRenderer;
+		float srcScale;
 		GET_RENDERER(src, srcRenderer);
-		SDL_Surface* srcSurface = getRenderSurface(srcRenderer);
-		if (srcSurface == NULL) {
-			handleError(0, display, src, 0, BadMatch, 0);
+		srcSurface = getRenderSurface(srcRenderer);
+		// The surface has the resolution of the source, the destination renderer scales it back.
+		SDL_RenderGetScale(srcRenderer, &srcScale, NULL);
+		scaleRect(&srcRect, srcScale);
+	}
+	if (srcSurface == NULL) {
+		handleError(0, display, src, 0, BadMatch, 0);
+		return;
+	}
+	SDL_Texture* srcTexture = NULL;
+	SDL_Renderer* srcTextureRenderer = NULL;
+	SDL_Rect targetRect;
+	DrawTarget target;
+	FOR_EACH_DRAW_TARGET(dest, gc, &destRect, target) {
+		if (target.renderer == NULL) {
+			handleError(0, display, dest, 0, BadAlloc, 0);
+			break;
 		}
-		SDL_Texture* srcTexture = SDL_CreateTextureFromSurface(destRenderer, srcSurface);
-		SDL_FreeSurface(srcSurface);
-		SDL_SetRenderDrawBlendMode(destRenderer, SDL_BLENDMODE_BLEND);
-		SDL_SetTextureBlendMode(srcTexture, SDL_BLENDMODE_BLEND);
-		SDL_Rect srcRect, destRect;
-		srcRect.x = src_x;
-		srcRect.y = src_y;
-		destRect.x = dest_x;
-		destRect.y = dest_y;
-		srcRect.w = destRect.w = width;
-		srcRect.h = destRect.h = height;
-		if (SDL_RenderCopy(destRenderer, srcTexture, &srcRect, &destRect) != 0) {
+		if (target.renderer != srcTextureRenderer) {
+			releaseTexture(srcTextureRenderer, srcTexture);
+			srcTexture = acquireSurfaceTexture(target.renderer, srcSurface);
+			srcTextureRenderer = target.renderer;
+			if (srcTexture == NULL) {
+				handleError(0, display, dest, 0, BadAlloc, 0);
+				break;
+			}
+		}
+		SDL_SetRenderDrawBlendMode(target.renderer, SDL_BLENDMODE_BLEND);
+		targetRect = destRect;
+		targetRect.x -= target.offsetX;
+		targetRect.y -= target.offsetY;
+		if (SDL_RenderCopy(target.renderer, srcTexture, &srcRect, &targetRect) != 0) {
 			LOG("SDL_RenderCopy failed in %s: %s\n", __func__, SDL_GetError());
 			handleError(0, display, src, 0, BadMatch, 0);
-			return 0;
+			break;
 		}
-		SDL_DestroyTexture(srcTexture);
-		SDL_RenderPresent(destRenderer);
-	} else {
-		LOG("Hit unimplemented type in %s: %d\n", __func__, GET_XID_TYPE(dest));
 	}
+	releaseTexture(srcTextureRenderer, srcTexture);
+	SDL_FreeSurface(srcSurface);
+}
+
+typedef struct {
+	Drawable src;
+	SDL_Rect srcRect;
+	int destX, destY;
+} CopyAreaArgs;
+
+static void copyDeferredArea(Display* display, Drawable d, GC gc, void* args) {
+	CopyAreaArgs* copy = args;
+	copyArea(display, copy->src, d, gc, copy->srcRect, copy->destX, copy->destY);
+}
 
+int XCopyArea(Display* display, Drawable src, Drawable dest, GC gc, int src_x, int src_y,
+               unsigned int width, unsigned int height, int dest_x, int dest_y) {
+    // https://tronche.com/gui/x/xlib/graphics/XCopyArea.html
+	SET_X_SERVER_REQUEST(display, X_CopyArea);
+	TYPE_CHECK(src, DRAWABLE, display, 0);
+	TYPE_CHECK(dest, DRAWABLE, display, 0);
+	LOG("%s: Copy area from %p to %p\n", __func__, src, dest);
+	if (IS_TYPE(src, WINDOW) && IS_INPUT_ONLY(src)) {
+		LOG("BadMatch: Got input only window as the source in %s!\n", __func__);
+		handleError(0, display, src, 0, BadMatch, 0);
+		return 0;
+	}
+	if (IS_TYPE(dest, WINDOW) && IS_INPUT_ONLY(dest)) {
+		LOG("BadMatch: Got input only window as the destination in %s!\n", __func__);
+		handleError(0, display, dest, 0, BadMatch, 0);
+		return 0;
+	}
+	if (IS_BITMAP(src) != IS_BITMAP(dest)) {
+		LOG("BadMatch: Source and destination have different depths in %s!\n", __func__);
+		handleError(0, display, dest, 0, BadMatch, 0);
+		return 0;
+	}
+	SDL_Rect srcRect = {src_x, src_y, (int) width, (int) height};
+	CopyAreaArgs* args = beginDeferredDraw(display, dest, gc, copyDeferredArea, sizeof(CopyAreaArgs));
+	if (args != NULL) {
+		args->src = src;
+		args->srcRect = srcRect;
+		args->destX = dest_x;
+		args->destY = dest_y;
+		submitDeferredDraw(args);
+		return 1;
+	}
+	copyArea(display, src, dest, gc, srcRect, dest_x, dest_y);
 	// TODO: Events
 	return 1;
 }
@@ -240,6 +721,84 @@ int XDrawRectangle(Display *display, Drawable d, GC gc, int x, int y, unsigned i
 	return 1;
 }
 
+/*
+ * Draw the stipple of the graphic context in the foreground color into the rectangles,
+ * repeating it from the stipple origin. The offset is the position of the render target.
+ */
+static void fillStippled(SDL_Renderer* renderer, GraphicContext* gContext, SDL_Rect* sdlRectangles,
+						 int nrectangles, int offsetX, int offsetY) {
+	if (!IS_BITMAP(gContext->stipple)) {
+		LOG("The stipple of the graphic context is not a bitmap in %s\n", __func__);
+		return;
+	}
+	SDL_Texture* stippleTexture = getBitmapTexture(gContext->stipple, renderer);
+	if (stippleTexture == NULL) {
+		return;
+	}
+	long color = gContext->foreground;
+	SDL_SetTextureColorMod(stippleTexture, GET_RED_FROM_COLOR(color), GET_GREEN_FROM_COLOR(color),
+						   GET_BLUE_FROM_COLOR(color));
+	SDL_SetTextureAlphaMod(stippleTexture, GET_ALPHA_FROM_COLOR(color));
+	SDL_Rect stippleRect;
+	stippleRect.w = (int) GET_PIXMAP_STRUCT(gContext->stipple)->width;
+	stippleRect.h = (int) GET_PIXMAP_STRUCT(gContext->stipple)->height;
+	int originX = gContext->tileStipOriginX - offsetX;
+	int originY = gContext->tileStipOriginY - offsetY;
+	int i, startX, startY;
+	// The stipple is clipped to each rectangle, but must stay within the clip of the draw target.
+	SDL_Rect targetClipRect, clipRect;
+	Bool hasTargetClip = SDL_RenderIsClipEnabled(renderer);
+	SDL_RenderGetClipRect(renderer, &targetClipRect);
+	for (i = 0; i < nrectangles; i++) {
+		clipRect = sdlRectangles[i];
+		if (hasTargetClip && !SDL_IntersectRect(&targetClipRect, &sdlRectangles[i], &clipRect)) {
+			continue;
+		}
+		SDL_RenderSetClipRect(renderer, &clipRect);
+		// Align the first stipple copy left and above the rectangle to the stipple origin.
+		startX = sdlRectangles[i].x - originX;
+		startX = originX + (startX >= 0 ? startX / stippleRect.w : (startX + 1) / stippleRect.w - 1) * stippleRect.w;
+		startY = sdlRectangles[i].y - originY;
+		startY = originY + (startY >= 0 ? startY / stippleRect.h : (startY + 1) / stippleRect.h - 1) * stippleRect.h;
+		for (stippleRect.y = startY; stippleRect.y < sdlRectangles[i].y + sdlRectangles[i].h;
+			 stippleRect.y += stippleRect.h) {
+			for (stippleRect.x = startX; stippleRect.x < sdlRectangles[i].x + sdlRectangles[i].w;
+				 stippleRect.x += stippleRect.w) {
+				SDL_RenderCopy(renderer, stippleTexture, NULL, &stippleRect);
+			}
+		}
+	}
+	SDL_RenderSetClipRect(renderer, hasTargetClip ? &targetClipRect : NULL);
+}
+
+static Bool fillRectangles(SDL_Renderer* renderer, GraphicContext* gContext, SDL_Rect* sdlRectangles,
+						   int nrectangles, int offsetX, int offsetY) {
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	LOG("bgColor: 0x%08lx, fgColor: 0x%08lx\n", gContext->background, gContext->foreground);
+	if (gContext->fillStyle == FillSolid || gContext->fillStyle == FillOpaqueStippled) {
+		LOG("Fill_style is %s\n", gContext->fillStyle == FillSolid ? "FillSolid" : "FillOpaqueStippled");
+		long color = gContext->fillStyle == FillSolid ? gContext->foreground : gContext->background;
+		SDL_SetRenderDrawColor(renderer,
+							   GET_RED_FROM_COLOR(color),
+							   GET_GREEN_FROM_COLOR(color),
+							   GET_BLUE_FROM_COLOR(color),
+							   GET_ALPHA_FROM_COLOR(color));
+		SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+		if (SDL_RenderFillRects(renderer, &sdlRectangles[0], nrectangles)) {
+			LOG("SDL_RenderFillRects failed in %s: %s\n", __func__, SDL_GetError());
+		}
+		if (gContext->fillStyle == FillOpaqueStippled) {
+			fillStippled(renderer, gContext, sdlRectangles, nrectangles, offsetX, offsetY);
+		}
+	} else if (gContext->fillStyle == FillTiled) {
+		LOG("Fill_style is %s\n", "FillTiled");
+	} else if (gContext->fillStyle == FillStippled) {
+		LOG("Fill_style is %s\n", "FillStippled");
+		fillStippled(renderer, gContext, sdlRectangles, nrectangles, offsetX, offsetY);
+	}
+	return True;
+}
+
 int XFillRectangle(Display* display, Drawable d, GC gc, int x, int y,
                    unsigned int width, unsigned int height) {
     XRectangle rectangle; // TODO: Make this not depend on XFillRectangles
@@ -250,6 +809,47 @@ int XFillRectangle(Display* display, Drawable d, GC gc, int x, int y,
     return XFillRectangles(display, d, gc, &rectangle, 1);
 }
 
+static void fillDrawableRectangles(Display* display, Drawable d, GC gc, SDL_Rect* sdlRectangles, int nrectangles) {
+	SDL_Rect bounds = sdlRectangles[0];
+	int i;
+	for (i = 1; i < nrectangles; i++) {
+		SDL_UnionRect(&bounds, &sdlRectangles[i], &bounds);
+	}
+	if (IS_BITMAP(d)) {
+		// TODO: Respect the fill style
+		fillBitmapRectangles(d, sdlRectangles, nrectangles, (int) (GET_GC(gc)->foreground & 1));
+		return;
+	}
+	DrawTarget target;
+	FOR_EACH_DRAW_TARGET(d, gc, &bounds, target) {
+		if (target.renderer == NULL) {
+			LOG("Failed to create renderer in %s: %s\n", __func__, SDL_GetError());
+			handleError(0, display, d, 0, BadDrawable, 0);
+			break;
+		}
+		SDL_Rect targetRectangles[nrectangles];
+		for (i = 0; i < nrectangles; i++) {
+			targetRectangles[i] = sdlRectangles[i];
+			targetRectangles[i].x -= target.offsetX;
+			targetRectangles[i].y -= target.offsetY;
+		}
+		if (!fillRectangles(target.renderer, GET_GC(gc), targetRectangles, nrectangles,
+							target.offsetX, target.offsetY)) {
+			break;
+		}
+	}
+}
+
+typedef struct {
+	int numRectangles;
+	SDL_Rect rectangles[];
+} RectanglesArgs;
+
+static void fillDeferredRectangles(Display* display, Drawable d, GC gc, void* args) {
+	fillDrawableRectangles(display, d, gc, ((RectanglesArgs*) args)->rectangles,
+						   ((RectanglesArgs*) args)->numRectangles);
+}
+
 int XFillRectangles(Display *display, Drawable d, GC gc, XRectangle *rectangles, int nrectangles) {
 	// https://tronche.com/gui/x/xlib/graphics/filling-areas/XFillRectangles.html
 	SET_X_SERVER_REQUEST(display, X_PolyFillRectangle);
@@ -260,14 +860,6 @@ int XFillRectangles(Display *display, Drawable d, GC gc, XRectangle *rectangles,
 		handleError(0, display, None, 0, BadValue, 0);
 		return 0;
 	}
-	SDL_Renderer* renderer = NULL;
-	GET_RENDERER(d, renderer);
-	if (renderer == NULL) {
-		LOG("Failed to create renderer in %s: %s\n", __func__, SDL_GetError());
-		handleError(0, display, d, 0, BadDrawable, 0);
-		return 0;
-	}
-	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 	SDL_Rect sdlRectangles[nrectangles];
 	int i;
 	for (i = 0; i < nrectangles; i++) {
@@ -278,50 +870,14 @@ int XFillRectangles(Display *display, Drawable d, GC gc, XRectangle *rectangles,
 		LOG("{x = %d, y = %d, w = %d, h = %d}\n", sdlRectangles[i].x,
 				sdlRectangles[i].y, sdlRectangles[i].w, sdlRectangles[i].h);
 	}
-	GraphicContext* gContext = GET_GC(gc);
-	LOG("bgColor: 0x%08lx, fgColor: 0x%08lx\n", gContext->background, gContext->foreground);
-	if (gContext->fillStyle == FillSolid) {
-		LOG("Fill_style is %s\n", "FillSolid");
-		long color = gContext->foreground;
-		SDL_SetRenderDrawColor(renderer,
-							   GET_RED_FROM_COLOR(color),
-							   GET_GREEN_FROM_COLOR(color),
-							   GET_BLUE_FROM_COLOR(color),
-							   GET_ALPHA_FROM_COLOR(color));
-		SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
-		if (SDL_RenderFillRects(renderer, &sdlRectangles[0], nrectangles)) {
-			LOG("SDL_RenderFillRects failed in %s: %s\n", __func__, SDL_GetError());
-		}
-	} else if (gContext->fillStyle == FillTiled) {
-		LOG("Fill_style is %s\n", "FillTiled");
-	} else if (gContext->fillStyle == FillOpaqueStippled) {
-		LOG("Fill_style is %s\n", "FillOpaqueStippled");
-		SDL_Rect viewPort;
-		SDL_RenderGetViewport(renderer, &viewPort);
-		SDL_Surface* renderSurface = SDL_CreateRGBSurface(0, viewPort.w, viewPort.h, SDL_SURFACE_DEPTH, DEFAULT_RED_MASK,
-														  DEFAULT_GREEN_MASK, DEFAULT_BLUE_MASK,
-														  DEFAULT_ALPHA_MASK);
-		if (renderSurface == NULL) {
-			LOG("Failed to create rendering surface in %s: %s\n", __func__, SDL_GetError());
-			return 0;
-		}
-		if (SDL_FillRects(renderSurface, &sdlRectangles[0], nrectangles, gContext->background)) {
-			LOG("SDL_FillRects failed in %s: %s\n", __func__, SDL_GetError());
-			SDL_FreeSurface(renderSurface);
-			return 0;
-		}
-//        colorClipped(renderSurface, GET_SURFACE(gc->stipple), gc->ts_x_origin, gc->ts_y_origin, gc->foreground);
-		SDL_Texture* renderTexture = SDL_CreateTextureFromSurface(renderer, renderSurface);
-		if (renderTexture == NULL) {
-			LOG("Failed to create texture in %s: %s\n", __func__, SDL_GetError());
-		} else {
-			SDL_RenderCopy(renderer, renderTexture, NULL, NULL);
-		}
-		SDL_DestroyTexture(renderTexture);
-		SDL_FreeSurface(renderSurface);
-	} else if (gContext->fillStyle == FillStippled) {
-		LOG("Fill_style is %s\n", "FillStippled");
+	RectanglesArgs* args = beginDeferredDraw(display, d, gc, fillDeferredRectangles,
+											 sizeof(RectanglesArgs) + sizeof(SDL_Rect) * nrectangles);
+	if (args != NULL) {
+		args->numRectangles = nrectangles;
+		memcpy(args->rectangles, sdlRectangles, sizeof(SDL_Rect) * nrectangles);
+		submitDeferredDraw(args);
+		return 1;
 	}
-	SDL_RenderPresent(renderer);
+	fillDrawableRectangles(display, d, gc, sdlRectangles, nrectangles);
 	return 1;
 }
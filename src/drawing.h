@@ -6,35 +6,77 @@
 #include "colors.h"
 #include "resourceTypes.h"
 #include "window.h"
+#include "pixmap.h"
+#include "scale.h"
 
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN || 1
-#  define DEFAULT_RED_MASK   0xFF000000
-#  define DEFAULT_GREEN_MASK 0x00FF0000
-#  define DEFAULT_BLUE_MASK  0x0000FF00
-#  define DEFAULT_ALPHA_MASK 0x000000FF
-#else
-#  define DEFAULT_RED_MASK   0x000000FF
-#  define DEFAULT_GREEN_MASK 0x0000FF00
-#  define DEFAULT_BLUE_MASK  0x00FF0000
-#  define DEFAULT_ALPHA_MASK 0xFF000000
-#endif
+#define DEFAULT_RED_MASK   (NATIVE_PIXEL_FORMAT.redMask)
+#define DEFAULT_GREEN_MASK (NATIVE_PIXEL_FORMAT.greenMask)
+#define DEFAULT_BLUE_MASK  (NATIVE_PIXEL_FORMAT.blueMask)
+#define DEFAULT_ALPHA_MASK (NATIVE_PIXEL_FORMAT.alphaMask)
+#define DEFAULT_TEXTURE_FORMAT (NATIVE_PIXEL_FORMAT.format)
 #define SDL_SURFACE_DEPTH 32
 
-#define GET_PIXMAP_TEXTURE(pixmap) (IS_TYPE(pixmap, PIXMAP) ? ((SDL_Texture*) GET_XID_VALUE(pixmap)) : NULL)
+/*
+ * Only single tile pixmaps with a depth other than 1 have a texture that can be used as a render target.
+ * Tiled pixmaps must be drawn with FOR_EACH_DRAW_TARGET and read with getPixmapSurface,
+ * bitmaps are drawn and read through their bits (see bitmap.h).
+ */
+#define IS_RENDERABLE_PIXMAP(pixmap) (IS_TYPE(pixmap, PIXMAP) && GET_PIXMAP_STRUCT(pixmap)->depth != 1 \
+	&& !IS_TILED_PIXMAP(pixmap))
+#define GET_PIXMAP_TEXTURE(pixmap) (IS_RENDERABLE_PIXMAP(pixmap) ? getPixmapTile(pixmap, 0, 0, True) : NULL)
 #define GET_RENDERER(drawable, renderer) \
 if (IS_TYPE(drawable, WINDOW)) {\
 	renderer = getWindowRenderer(drawable);\
 } else if (IS_TYPE(drawable, PIXMAP)) {\
-	renderer = GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer;\
-	if (SDL_SetRenderTarget(renderer, GET_PIXMAP_TEXTURE(drawable)) != 0) {\
-		fprintf(stderr, "SDL_SetRenderTarget failed while trying to get renderer in %s, %s, %d: %s\n", __FILE__, __func__, __LINE__, SDL_GetError());\
+	if (!IS_RENDERABLE_PIXMAP(drawable)) {\
+		fprintf(stderr, "Got a tiled or depth 1 pixmap while trying to get renderer in %s, %s, %d\n", __FILE__, __func__, __LINE__);\
+		renderer = NULL;\
+	} else {\
+		renderer = GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer;\
+		if (SDL_SetRenderTarget(renderer, GET_PIXMAP_TEXTURE(drawable)) != 0) {\
+			fprintf(stderr, "SDL_SetRenderTarget failed while trying to get renderer in %s, %s, %d: %s\n", __FILE__, __func__, __LINE__, SDL_GetError());\
+			renderer = NULL;\
+		} else {\
+			SDL_RenderSetScale(renderer, DEVICE_SCALE, DEVICE_SCALE);\
+		}\
 	}\
+} else if (IS_TYPE(drawable, BACK_BUFFER)) {\
+	renderer = getBackBufferRenderer(drawable);\
 } else {\
 	fprintf(stderr, "Got unknown drawable type while trying to get renderer in %s, %s, %d\n", __FILE__, __func__, __LINE__);\
 }
 
+/*
+ * A render target of a drawable. Windows have one per rectangle of their clip region
+ * (with the clip rectangle of the renderer set to it), tiled pixmaps have one per tile
+ * and back buffers have a single one.
+ * offsetX and offsetY are the position of the target in the coordinates of the drawable,
+ * so every coordinate passed to the renderer must be translated by them.
+ */
+typedef struct {
+	SDL_Renderer* renderer;
+	int offsetX, offsetY;
+	int nextIndex;
+} DrawTarget;
+
+/*
+ * Iterate over all render targets of the drawable which intersect with the given bounds
+ * (NULL means the whole drawable). The renderer of a target is NULL if it could not be created.
+ * Drawing into a window is clipped according to the subwindow mode of the graphic context
+ * (gc may be NULL for ClipByChildren), nothing is iterated if the window is fully obscured.
+ * Windows are marked as changed once the iteration is complete, see present.h.
+ * The iteration may be left early with break, which still completes it, but not with return.
+ */
+#define FOR_EACH_DRAW_TARGET(drawable, gc, bounds, target) \
+for ((target).nextIndex = 0, (target).renderer = NULL; (target).nextIndex >= 0; endDrawTargets(drawable, &(target))) \
+	for (; nextDrawTarget(drawable, gc, bounds, &(target));)
+
+Bool nextDrawTarget(Drawable drawable, GC gc, const SDL_Rect* bounds, DrawTarget* target);
+void endDrawTargets(Drawable drawable, DrawTarget* target);
 SDL_Renderer* getWindowRenderer(Window window);
 SDL_Surface* getRenderSurface(SDL_Renderer* renderer);
+SDL_Surface* getRenderSurfaceArea(SDL_Renderer* renderer, const SDL_Rect* area);
+SDL_Surface* getDrawableSurfaceArea(Drawable drawable, const SDL_Rect* area, Uint32 format);
 void flipScreen(void);
 
 #endif /* _DRAWING_H_ */
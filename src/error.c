@@ -1,10 +1,28 @@
 #include "errors.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include "display.h"
+#include "renderThread.h"
+#include "extensions.h"
+#include <X11/extensions/render.h>
+#include <X11/extensions/xfixeswire.h>
+#include <X11/extensions/damagewire.h>
+#include <X11/extensions/syncconst.h>
+#include <X11/extensions/shm.h>
 
 typedef int (*errorHandlerFunction)(Display*, XErrorEvent*);
 errorHandlerFunction error_handler = defaultErrorHandler;
 
+/* An error of a request executed on the render thread, which is reported on the calling thread. */
+typedef struct PendingError {
+    XErrorEvent event;
+    struct PendingError* next;
+} PendingError;
+
+static PendingError* firstPendingError = NULL;
+static PendingError* lastPendingError = NULL;
+static SDL_SpinLock pendingErrorsLock = 0;
+
 errorHandlerFunction XSetErrorHandler(errorHandlerFunction handler) {
     // https://tronche.com/gui/x/xlib/event-handling/protocol-errors/XSetErrorHandler.html
     errorHandlerFunction prev_error_handler = error_handler;
@@ -70,9 +88,48 @@ void handleError(int type, Display* display, XID resourceId, unsigned long seria
     event.error_code = error_code;
     event.request_code = (unsigned char) GET_DISPLAY(display)->request;
     event.minor_code = minor_code;
+    if (isRenderThread()) {
+        // The error handler belongs to the client, it is called by postRenderErrors.
+        PendingError* error = malloc(sizeof(PendingError));
+        if (error == NULL) {
+            fprintf(stderr, "Out of memory: Dropping error %u of the render thread\n", error_code);
+            return;
+        }
+        error->event = event;
+        error->next = NULL;
+        SDL_AtomicLock(&pendingErrorsLock);
+        if (lastPendingError == NULL) {
+            firstPendingError = error;
+        } else {
+            lastPendingError->next = error;
+        }
+        lastPendingError = error;
+        SDL_AtomicUnlock(&pendingErrorsLock);
+        return;
+    }
     error_handler(display, &event);
 }
 
+/*
+ * Report the errors of the requests which were executed on the render thread to the error handler.
+ * If waitForDrawing is True, all queued requests are executed first.
+ */
+void postRenderErrors(Bool waitForDrawing) {
+    if (waitForDrawing) {
+        syncRenderThread();
+    }
+    SDL_AtomicLock(&pendingErrorsLock);
+    PendingError* error = firstPendingError;
+    firstPendingError = lastPendingError = NULL;
+    SDL_AtomicUnlock(&pendingErrorsLock);
+    while (error != NULL) {
+        PendingError* next = error->next;
+        error_handler(error->event.display, &error->event);
+        free(error);
+        error = next;
+    }
+}
+
 unsigned char resourceTypeToErrorCode(XResourceType resourceType) {
     switch (resourceType) {
         case WINDOW:
@@ -87,6 +144,20 @@ unsigned char resourceTypeToErrorCode(XResourceType resourceType) {
             return BadFont;
         case CURSOR:
             return BadCursor;
+        case BACK_BUFFER:
+            return BadDrawable;
+        case PICTURE:
+            return RENDER_FIRST_ERROR + BadPicture;
+        case GLYPH_SET:
+            return RENDER_FIRST_ERROR + BadGlyphSet;
+        case SERVER_REGION:
+            return XFIXES_FIRST_ERROR + BadRegion;
+        case DAMAGE:
+            return DAMAGE_FIRST_ERROR + BadDamage;
+        case SYNC_COUNTER:
+            return SYNC_FIRST_ERROR + XSyncBadCounter;
+        case SHM_SEGMENT:
+            return SHM_FIRST_ERROR + BadShmSeg;
         default:
             return BadMatch;
     }
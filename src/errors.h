@@ -10,6 +10,7 @@ int defaultErrorHandler(Display* display, XErrorEvent* event);
 void handleError(int type, Display* display, XID resourceId, unsigned long serial,
                  unsigned char error_code, unsigned char minor_code);
 void handleOutOfMemory(int type, Display* display, unsigned long serial, unsigned char minor_code);
+void postRenderErrors(Bool waitForDrawing);
 unsigned char resourceTypeToErrorCode(XResourceType resourceType);
 
 #endif /* _ERRORS_H_ */
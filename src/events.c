@@ -8,6 +8,15 @@
 #include "display.h"
 #include "atoms.h"
 #include "util.h"
+#include "windowClip.h"
+#include "present.h"
+#include "scale.h"
+#include "renderThread.h"
+#include "texturePool.h"
+#include "extensions.h"
+#include "damage.h"
+#include "syncCounter.h"
+#include "sharedMemory.h"
 
 int eventFds[2];
 #define READ_EVENT_FD eventFds[0]
@@ -140,6 +149,33 @@ unsigned int convertModifierState(Uint16 mod) {
     return state;
 }
 
+/*
+ * Update the visibility of a top level window and its children after the state of its SDL window changed.
+ */
+static void updateTopLevelVisibility(Display* display, Window window) {
+    if (window == None) return;
+    invalidateWindowClip(window);
+    updateWindowVisibility(display, window);
+}
+
+/*
+ * Make the internal event the next event returned by XNextEvent, before any queued SDL event.
+ */
+static void deferEvent(Display* display, Window eventWindow, void* event) {
+    ENQUEUE_EVENT_IN_PIPE(display);
+    eventWaiting = True;
+    SDL_zero(waitingEvent);
+    waitingEvent.type = SDL_USEREVENT;
+    waitingEvent.user.code = INTERNAL_EVENT_CODE;
+    waitingEvent.user.data1 = event;
+    waitingEvent.user.data2 = (void*) eventWindow;
+}
+
+static void trimTexturePoolCommand(void* data) {
+    (void) data;
+    trimTexturePool();
+}
+
 int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
     Bool sendEvent = False;
     Window eventWindow = None;
@@ -165,7 +201,7 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
             xEvent->xkey.window = eventWindow;
             xEvent->xkey.subwindow = None;
             xEvent->xkey.time = sdlEvent->key.timestamp;
-            SDL_GetMouseState(&xEvent->xkey.x, &xEvent->xkey.y);
+            getLogicalMouseState(&xEvent->xkey.x, &xEvent->xkey.y);
             xEvent->xkey.x_root = xEvent->xkey.x; // Because root and window are the same.
             xEvent->xkey.y_root = xEvent->xkey.y;
             xEvent->xkey.state = convertModifierState(sdlEvent->key.keysym.mod);
@@ -184,13 +220,13 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                 if (xEvent->xbutton.root == None) {
                     xEvent->xbutton.root = SCREEN_WINDOW;
                 }
-                eventWindow = getContainingWindow(xEvent->xcrossing.root, sdlEvent->button.x, sdlEvent->button.y);
+                eventWindow = getContainingWindow(xEvent->xcrossing.root, TO_LOGICAL(sdlEvent->button.x), TO_LOGICAL(sdlEvent->button.y));
                 FILL_STANDARD_VALUES(xcrossing);
                 xEvent->xcrossing.window = eventWindow;
                 // TODO: Check if pointer is in child
                 xEvent->xcrossing.subwindow = None;
                 xEvent->xcrossing.time = sdlEvent->button.timestamp;
-                SDL_GetMouseState(&xEvent->xcrossing.x_root, &xEvent->xcrossing.y_root);
+                getLogicalMouseState(&xEvent->xcrossing.x_root, &xEvent->xcrossing.y_root);
                 xEvent->xcrossing.x = xEvent->xcrossing.x_root;
                 xEvent->xcrossing.y = xEvent->xcrossing.y_root;
                 xEvent->xcrossing.mode = NotifyNormal;
@@ -216,15 +252,15 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
             if (xEvent->xbutton.root == None) {
                 xEvent->xbutton.root = SCREEN_WINDOW;
             }
-            xEvent->xbutton.subwindow = getContainingWindow(xEvent->xbutton.root, sdlEvent->button.x, sdlEvent->button.y); // The event window is always the SDL Window.
+            xEvent->xbutton.subwindow = getContainingWindow(xEvent->xbutton.root, TO_LOGICAL(sdlEvent->button.x), TO_LOGICAL(sdlEvent->button.y)); // The event window is always the SDL Window.
             eventWindow = xEvent->xbutton.subwindow;
 //            while (eventWindow != SCREEN_WINDOW && 0 && !HAS_VALUE(GET_WINDOW_STRUCT(eventWindow)->eventMask, ButtonPressMask)) {
 //                eventWindow = GET_PARENT(eventWindow);
 //            }
             xEvent->xbutton.window = eventWindow;
             xEvent->xbutton.time = sdlEvent->button.timestamp;
-            xEvent->xbutton.x = sdlEvent->button.x;
-            xEvent->xbutton.y = sdlEvent->button.y;
+            xEvent->xbutton.x = TO_LOGICAL(sdlEvent->button.x);
+            xEvent->xbutton.y = TO_LOGICAL(sdlEvent->button.y);
             xEvent->xbutton.x_root = xEvent->xbutton.x; // Because root and window are the same.
             xEvent->xbutton.y_root = xEvent->xbutton.y;
             xEvent->xbutton.state = convertModifierState(SDL_GetModState());
@@ -249,15 +285,15 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
             if (xEvent->xbutton.root == None) {
                 xEvent->xbutton.root = SCREEN_WINDOW;
             }
-            eventWindow = getContainingWindow(xEvent->xbutton.root, sdlEvent->motion.x, sdlEvent->motion.y);
+            eventWindow = getContainingWindow(xEvent->xbutton.root, TO_LOGICAL(sdlEvent->motion.x), TO_LOGICAL(sdlEvent->motion.y));
             xEvent->xmotion.window = eventWindow; // The event window is always the window the mouse is in.
             if (xEvent->xmotion.window == None) {
                 xEvent->xmotion.window = SCREEN_WINDOW;
             }
             xEvent->xmotion.subwindow = None;
             xEvent->xmotion.time = sdlEvent->motion.timestamp;
-            xEvent->xmotion.x = sdlEvent->motion.x;
-            xEvent->xmotion.y = sdlEvent->motion.y;
+            xEvent->xmotion.x = TO_LOGICAL(sdlEvent->motion.x);
+            xEvent->xmotion.y = TO_LOGICAL(sdlEvent->motion.y);
             xEvent->xmotion.x_root = xEvent->xbutton.x; // Because root and window are the same.
             xEvent->xmotion.y_root = xEvent->xbutton.y;
             xEvent->xmotion.state = convertModifierState(SDL_GetModState());
@@ -265,10 +301,13 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
             xEvent->xmotion.same_screen = True;
             break;
         case SDL_WINDOWEVENT:
+            // Window events change the window state queued drawing requests depend on.
+            syncRenderThread();
             eventWindow = getWindowFromId(sdlEvent->window.windowID);
             switch (sdlEvent->window.event) {
                 case SDL_WINDOWEVENT_SHOWN:
                     LOG("Window %d shown\n", sdlEvent->window.windowID);
+                    updateTopLevelVisibility(display, eventWindow);
                     type = MapNotify;
                     FILL_STANDARD_VALUES(xmap);
                     xEvent->xmap.window = eventWindow;
@@ -277,6 +316,7 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                     break;
                 case SDL_WINDOWEVENT_HIDDEN:
                     LOG("Window %d hidden\n", sdlEvent->window.windowID);
+                    updateTopLevelVisibility(display, eventWindow);
                     type = UnmapNotify;
                     FILL_STANDARD_VALUES(xunmap);
                     xEvent->xunmap.window = eventWindow;
@@ -285,6 +325,10 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                     break;
                 case SDL_WINDOWEVENT_EXPOSED:
                     LOG("Window %d exposed\n", sdlEvent->window.windowID);
+                    if (eventWindow != None) {
+                        // The system lost the window content, present it again with the next flush.
+                        GET_WINDOW_STRUCT(eventWindow)->contentChanged = True;
+                    }
                     return -1;
                     break;
                 case SDL_WINDOWEVENT_MOVED:
@@ -300,31 +344,51 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                         LOG("Window %d size changed to %dx%d\n", sdlEvent->window.windowID,
                             sdlEvent->window.data1, sdlEvent->window.data2);
                     }
+                    updateTopLevelVisibility(display, eventWindow);
                     type = ConfigureNotify;
                     FILL_STANDARD_VALUES(xconfigure);
 					xEvent->xconfigure.event = eventWindow;
 					xEvent->xconfigure.window = xEvent->xconfigure.event;
 					if (sdlEvent->window.event == SDL_WINDOWEVENT_MOVED) {
-						xEvent->xconfigure.x = sdlEvent->window.data1;
-						xEvent->xconfigure.y = sdlEvent->window.data2;
+						xEvent->xconfigure.x = TO_LOGICAL(sdlEvent->window.data1);
+						xEvent->xconfigure.y = TO_LOGICAL(sdlEvent->window.data2);
 					} else {
-						SDL_GetWindowPosition(SDL_GetWindowFromID(sdlEvent->window.windowID),
-											  &xEvent->xconfigure.x, &xEvent->xconfigure.y);
+						GET_WINDOW_POS(eventWindow, xEvent->xconfigure.x, xEvent->xconfigure.y);
 					}
 					if (sdlEvent->window.event == SDL_WINDOWEVENT_RESIZED
 						|| sdlEvent->window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
-						xEvent->xconfigure.width  = sdlEvent->window.data1;
-						xEvent->xconfigure.height = sdlEvent->window.data2;
+						xEvent->xconfigure.width  = TO_LOGICAL(sdlEvent->window.data1);
+						xEvent->xconfigure.height = TO_LOGICAL(sdlEvent->window.data2);
 					} else {
-						SDL_GetWindowSize(SDL_GetWindowFromID(sdlEvent->window.windowID),
-										  &xEvent->xconfigure.width, &xEvent->xconfigure.height);
+						GET_WINDOW_DIMS(eventWindow, xEvent->xconfigure.width, xEvent->xconfigure.height);
 					}
 					xEvent->xconfigure.border_width = GET_WINDOW_STRUCT(eventWindow)->borderWidth;
 					xEvent->xconfigure.above = None;
 					xEvent->xconfigure.override_redirect = GET_WINDOW_STRUCT(eventWindow)->overrideRedirect;
+					if (sdlEvent->window.event != SDL_WINDOWEVENT_MOVED) {
+						XSyncCounter counter = getSyncRequestCounter(eventWindow);
+						if (counter != None) {
+							// Drop the resize frames the client can't keep up with.
+							if (withholdResize(eventWindow, (unsigned int) xEvent->xconfigure.width,
+											   (unsigned int) xEvent->xconfigure.height)) {
+								return -1;
+							}
+							XConfigureEvent* configureEvent = malloc(sizeof(XConfigureEvent));
+							if (configureEvent != NULL) {
+								// Deliver the sync request first and the ConfigureNotify right after it.
+								memcpy(configureEvent, &xEvent->xconfigure, sizeof(XConfigureEvent));
+								deferEvent(display, eventWindow, configureEvent);
+								type = ClientMessage;
+								startSyncRequest(display, counter, configureEvent,
+												 sdlEvent->window.timestamp, &xEvent->xclient);
+								FILL_STANDARD_VALUES(xclient);
+							}
+						}
+					}
 					break;
 				case SDL_WINDOWEVENT_MINIMIZED:
                     LOG("Window %d minimized\n", sdlEvent->window.windowID);
+                    updateTopLevelVisibility(display, eventWindow);
                     return -1;
                     break;
                 case SDL_WINDOWEVENT_MAXIMIZED:
@@ -333,9 +397,14 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                     break;
                 case SDL_WINDOWEVENT_RESTORED:
                     LOG("Window %d restored\n", sdlEvent->window.windowID);
-                    SDL_Rect windowArea = {0, 0, 0, 0};
-                    GET_WINDOW_DIMS(eventWindow, windowArea.w, windowArea.h);
-                    postExposeEvent(display, eventWindow, &windowArea, 1);
+                    if (eventWindow == None) return -1;
+                    if (isContentPreserved(eventWindow)) {
+                        // The content was drawn while the window was minimized, it only needs to be presented.
+                        GET_WINDOW_STRUCT(eventWindow)->contentChanged = True;
+                    } else {
+                        forgetWindowExposure(eventWindow);
+                    }
+                    updateTopLevelVisibility(display, eventWindow);
                     return -1;
                     break;
                 case SDL_WINDOWEVENT_ENTER:
@@ -352,7 +421,7 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                     // TODO: Check if pointer is in child
                     xEvent->xcrossing.subwindow = None;
                     xEvent->xcrossing.time = sdlEvent->window.timestamp;
-                    SDL_GetMouseState(&xEvent->xcrossing.x_root, &xEvent->xcrossing.y_root);
+                    getLogicalMouseState(&xEvent->xcrossing.x_root, &xEvent->xcrossing.y_root);
                     xEvent->xcrossing.x = xEvent->xcrossing.x_root;
                     xEvent->xcrossing.y = xEvent->xcrossing.y_root;
                     xEvent->xcrossing.mode = NotifyNormal;
@@ -422,6 +491,7 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                                      Called on Android in onLowMemory()
                                 */
             LOG("SDL_APP_LOWMEMORY\n");
+            enqueueRenderCommand(trimTexturePoolCommand, NULL);
             return -1;
         case SDL_APP_WILLENTERBACKGROUND: /**< The application is about to enter the background
                                      Called on iOS in applicationWillResignActive()
@@ -465,7 +535,7 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
             xEvent->xkey.window = eventWindow;
             xEvent->xkey.subwindow = None;
             xEvent->xkey.time = sdlEvent->text.timestamp;
-            SDL_GetMouseState(&xEvent->xkey.x, &xEvent->xkey.y);
+            getLogicalMouseState(&xEvent->xkey.x, &xEvent->xkey.y);
             xEvent->xkey.x_root = xEvent->xkey.x; // Because root and window are the same.
             xEvent->xkey.y_root = xEvent->xkey.y;
             xEvent->xkey.state = convertModifierState(SDL_GetModState());
@@ -676,6 +746,10 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
                             memcpy(&xEvent->xclient, allocEvent, sizeof(XClientMessageEvent)); break;
                         case MappingNotify:
                             memcpy(&xEvent->xmapping, allocEvent, sizeof(XMappingEvent)); break;
+                        case DAMAGE_FIRST_EVENT + XDamageNotify:
+                            memcpy(xEvent, allocEvent, sizeof(XDamageNotifyEvent)); break;
+                        case SHM_FIRST_EVENT + ShmCompletion:
+                            memcpy(xEvent, allocEvent, sizeof(XShmCompletionEvent)); break;
                         default: break;
                     }
                     free(allocEvent);
@@ -698,13 +772,16 @@ int convertEvent(Display* display, SDL_Event* sdlEvent, XEvent* xEvent) {
 void updateWindowRenderTargets(Display* display) {
     size_t i;
     LOG("Resetting window render targets\n");
+    syncRenderThread();
     Window* children = GET_CHILDREN(SCREEN_WINDOW);
     for (i = 0; i < GET_WINDOW_STRUCT(SCREEN_WINDOW)->children.length; i++) {
         if (GET_WINDOW_STRUCT(children[i])->sdlWindow != NULL) {
             WindowStruct* windowStruct = GET_WINDOW_STRUCT(children[i]);
             LOG("Resetting render target of window %lu\n", children[i]);
+			freeDoubleBuffers(windowStruct->sdlRenderer);
+			freeTexturePool(windowStruct->sdlRenderer);
 			SDL_DestroyRenderer(windowStruct->sdlRenderer);
-			windowStruct->sdlRenderer = SDL_CreateRenderer(windowStruct->sdlWindow, -1, 0);
+			windowStruct->sdlRenderer = SDL_CreateRenderer(windowStruct->sdlWindow, -1, getRendererFlags(0));
             SDL_Rect exposeRect;
             exposeRect.x = 0;
             exposeRect.y = 0;
@@ -765,6 +842,18 @@ void printEventInfo(XEvent* event) {
     LOG("%s\n", msg);
 }
 
+/*
+ * Wait for the next SDL event. Size changes which are withheld for a sync request
+ * are delivered once the request times out, even if no other event arrives.
+ */
+static int waitForEvent(Display* display, SDL_Event* event) {
+    Sint32 timeout;
+    while ((timeout = releaseTimedOutResizes(display)) >= 0) {
+        if (SDL_WaitEventTimeout(event, timeout) == 1) return 1;
+    }
+    return SDL_WaitEvent(event);
+}
+
 int XNextEvent(Display* display, XEvent* event_return) {
     // https://tronche.com/gui/x/xlib/event-handling/manipulating-event-queue/XNextEvent.html
     SDL_Event event;
@@ -794,7 +883,14 @@ int XNextEvent(Display* display, XEvent* event_return) {
             event_return->xexpose.count = 0;
             break;
         }
-        if (eventWaiting || SDL_WaitEvent(&event) == 1) {
+        if (qlen == 0 && !eventWaiting) {
+            // We are going to wait, show everything that was drawn so far.
+            presentChangedWindows(True);
+            postDamageEvents(True);
+            postShmCompletions(True);
+            postRenderErrors(True);
+        }
+        if (eventWaiting || waitForEvent(display, &event) == 1) {
             tmpVar = False;
             if (eventWaiting) {
                 event = waitingEvent;
@@ -902,7 +998,16 @@ int XEventsQueued(Display *display, int mode) {
     // https://tronche.com/gui/x/xlib/event-handling/XEventsQueued.html
 //    SET_X_SERVER_REQUEST(display, XCB_);
     if (GET_DISPLAY(display)->qlen == 0 && mode != QueuedAlready) {
+        postDamageEvents(False);
+        postShmCompletions(False);
+        postRenderErrors(False);
+        releaseTimedOutResizes(display);
         SDL_PumpEvents();
+        if (GET_DISPLAY(display)->qlen == 0) {
+            // The client is likely to wait on the connection next, so nothing that was throttled
+            // may be left unpresented.
+            presentChangedWindows(True);
+        }
     }
     return GET_DISPLAY(display)->qlen;
 }
@@ -911,6 +1016,10 @@ int XFlush(Display *display) {
     // https://tronche.com/gui/x/xlib/event-handling/XFlush.html
 //    SET_X_SERVER_REQUEST(display, XCB_);
 //    SDL_PumpEvents(); // TODO: This locks up the main thread
+    presentChangedWindows(False);
+    postDamageEvents(False);
+    postShmCompletions(False);
+    postRenderErrors(False);
     return 1;
 }
 
@@ -1152,6 +1261,18 @@ Bool postEvent(Display* display, Window eventWindow, unsigned int eventId, ...)
             eventData = event;
             break;
         }
+        case VisibilityNotify: {
+            if (!HAS_EVENT_MASK(eventWindow, VisibilityChangeMask)) SKIP
+            XVisibilityEvent* event = malloc(sizeof(XVisibilityEvent));
+            if (event == NULL) break;
+            event->type = eventId;
+            event->send_event = False;
+            event->display = display;
+            event->window = eventWindow;
+            event->state = va_arg(args, int);
+            eventData = event;
+            break;
+        }
         case ClientMessage: {
             XClientMessageEvent* event = malloc(sizeof(XClientMessageEvent));
             if (event == NULL) break;
@@ -1185,8 +1306,6 @@ Bool postEvent(Display* display, Window eventWindow, unsigned int eventId, ...)
 //            memcpy(&xEvent->xgraphicsexpose, allocEvent, sizeof(XGraphicsExposeEvent)); break;
         case NoExpose:
             /*memcpy(&xEvent->xnoexpose, allocEvent, sizeof(XNoExposeEvent)); */break; // TODO
-        case VisibilityNotify:
-//            memcpy(&xEvent->xvisibility, allocEvent, sizeof(XVisibilityEvent)); break;
         case GravityNotify:
             /*memcpy(&xEvent->xgravity, allocEvent, sizeof(XGravityEvent)); */break; // TODO
         case ResizeRequest:
@@ -0,0 +1,68 @@
+#include <stdlib.h>
+#include <string.h>
+#include <X11/Xlib.h>
+#include <X11/Xproto.h>
+#include <X11/extensions/dbe.h>
+#include <X11/extensions/render.h>
+#include <X11/extensions/xfixeswire.h>
+#include <X11/extensions/damagewire.h>
+#include <X11/extensions/syncconst.h>
+#include <X11/extensions/shm.h>
+#include "extensions.h"
+#include "display.h"
+#include "util.h"
+
+typedef struct {
+    const char* name;
+    int majorOpcode;
+    int firstEvent;
+    int firstError;
+} Extension;
+
+static const Extension extensions[] = {
+    {DBE_PROTOCOL_NAME, DBE_MAJOR_OPCODE, 0, DBE_FIRST_ERROR},
+    {RENDER_NAME, RENDER_MAJOR_OPCODE, 0, RENDER_FIRST_ERROR},
+    {XFIXES_NAME, XFIXES_MAJOR_OPCODE, XFIXES_FIRST_EVENT, XFIXES_FIRST_ERROR},
+    {DAMAGE_NAME, DAMAGE_MAJOR_OPCODE, DAMAGE_FIRST_EVENT, DAMAGE_FIRST_ERROR},
+    {SYNC_NAME, SYNC_MAJOR_OPCODE, SYNC_FIRST_EVENT, SYNC_FIRST_ERROR},
+    {SHMNAME, SHM_MAJOR_OPCODE, SHM_FIRST_EVENT, SHM_FIRST_ERROR},
+};
+
+Bool XQueryExtension(Display* display, _Xconst char* name, int* major_opcode_return,
+                     int* first_event_return, int* first_error_return) {
+    // https://tronche.com/gui/x/xlib/utilities/extensions/XQueryExtension.html
+    SET_X_SERVER_REQUEST(display, X_QueryExtension);
+    size_t i;
+    for (i = 0; i < ARRAY_LENGTH(extensions); i++) {
+        if (strcmp(extensions[i].name, name) == 0) {
+            *major_opcode_return = extensions[i].majorOpcode;
+            *first_event_return = extensions[i].firstEvent;
+            *first_error_return = extensions[i].firstError;
+            return True;
+        }
+    }
+    return False;
+}
+
+char** XListExtensions(Display* display, int* nextensions_return) {
+    // https://tronche.com/gui/x/xlib/utilities/extensions/XListExtensions.html
+    SET_X_SERVER_REQUEST(display, X_ListExtensions);
+    char** list = malloc(sizeof(char*) * ARRAY_LENGTH(extensions));
+    size_t i;
+    *nextensions_return = 0;
+    if (list == NULL) {
+        handleOutOfMemory(0, display, 0, 0);
+        return NULL;
+    }
+    for (i = 0; i < ARRAY_LENGTH(extensions); i++) {
+        list[i] = (char*) extensions[i].name;
+    }
+    *nextensions_return = (int) ARRAY_LENGTH(extensions);
+    return list;
+}
+
+int XFreeExtensionList(char** list) {
+    // https://tronche.com/gui/x/xlib/utilities/extensions/XFreeExtensionList.html
+    free(list);
+    return 1;
+}
@@ -0,0 +1,26 @@
+#ifndef _EXTENSIONS_H_
+#define _EXTENSIONS_H_
+
+/*
+ * Major opcodes, first event codes and first error codes of the emulated extensions,
+ * as reported by XQueryExtension. The major opcode is used as the request code of errors.
+ */
+
+#define DBE_MAJOR_OPCODE 128
+#define DBE_FIRST_ERROR 128
+#define RENDER_MAJOR_OPCODE 129
+#define RENDER_FIRST_ERROR 129
+#define XFIXES_MAJOR_OPCODE 130
+#define XFIXES_FIRST_EVENT 64
+#define XFIXES_FIRST_ERROR 134
+#define DAMAGE_MAJOR_OPCODE 131
+#define DAMAGE_FIRST_EVENT 66
+#define DAMAGE_FIRST_ERROR 135
+#define SYNC_MAJOR_OPCODE 132
+#define SYNC_FIRST_EVENT 67
+#define SYNC_FIRST_ERROR 136
+#define SHM_MAJOR_OPCODE 133
+#define SHM_FIRST_EVENT 69
+#define SHM_FIRST_ERROR 138
+
+#endif /* _EXTENSIONS_H_ */
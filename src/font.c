@@ -12,12 +12,16 @@
 #include "resourceTypes.h"
 #include "atoms.h"
 #include "drawing.h"
+#include "bitmap.h"
 #include "display.h"
 #include "gc.h"
 #include "util.h"
 #include "font.h"
+#include "scale.h"
+#include "renderThread.h"
+#include "texturePool.h"
+#include "glyphAtlas.h"
 
-// TODO: Maybe implement character atlas
 // TODO: Convert text decoding to Utf-8
 // http://www.cprogramming.com/tutorial/unicode.html
 
@@ -26,7 +30,51 @@ typedef struct {
     char* XLFName;
 } FontCacheEntry;
 
-#define GET_FONT(fontXID) ((TTF_Font*) GET_XID_VALUE(fontXID))
+// The characters in the metrics tables of a font, the printable ASCII characters.
+#define FIRST_TABLE_CHAR 0x20
+#define NUM_TABLE_CHARS (0x7F - FIRST_TABLE_CHAR)
+// The size of the cache of measured text widths, as sets of entries with the same hash.
+#define TEXT_WIDTH_CACHE_SETS 64
+#define TEXT_WIDTH_CACHE_WAYS 4
+// The maximum length of a text in the cache, longer texts are measured every time.
+#define TEXT_WIDTH_CACHE_MAX_LENGTH 64
+
+// The metrics of the table characters of a font, so measuring text that only consists
+// of them is a sum over the table, with the same result as TTF_SizeUTF8.
+typedef struct {
+    Sint16 advance[NUM_TABLE_CHARS];
+    Sint16 minX[NUM_TABLE_CHARS];
+    // The right edge of the character, the maximum of its advance and maxX.
+    Sint16 right[NUM_TABLE_CHARS];
+    Bool provided[NUM_TABLE_CHARS];
+    // The kerning between every two table characters, NULL if the font has no kerning for them.
+    Sint8* kerning;
+} TextMetrics;
+
+typedef struct {
+    TTF_Font* font;
+    // The font at the size of the device pixels, opened on the first use if the display is scaled
+    // or the render thread is enabled.
+    TTF_Font* deviceFont;
+    char* filePath;
+    int size;
+    // The metrics tables of the font, created on the first measurement.
+    TextMetrics* metrics;
+} FontData;
+
+typedef struct {
+    // The font of the entry, NULL if the entry is unused.
+    const FontData* font;
+    Uint64 hash;
+    size_t length;
+    // The measured text, to tell texts with the same hash apart.
+    char text[TEXT_WIDTH_CACHE_MAX_LENGTH];
+    int width;
+    Uint32 lastUse;
+} TextWidthEntry;
+
+#define GET_FONT_DATA(fontXID) ((FontData*) GET_XID_VALUE(fontXID))
+#define GET_FONT(fontXID) (GET_FONT_DATA(fontXID)->font)
 #define FONT_SIZE 8
 
 // This Array contains a list of default font search paths for the compiled architecture
@@ -41,6 +89,10 @@ static const char* DEFAULT_FONT_SEARCH_PATHS[] = {
 Array* fontSearchPaths = NULL;
 Array* fontCache = NULL;
 
+// The widths of recently measured texts which are not only made of table characters.
+static TextWidthEntry textWidthCache[TEXT_WIDTH_CACHE_SETS][TEXT_WIDTH_CACHE_WAYS];
+static Uint32 textWidthUseCounter = 0;
+
 // Check if the given path points to an existing directory
 Bool checkFontPath(const char* path) {
     if (path == NULL) return False;
@@ -257,16 +309,75 @@ Font XLoadFont(Display* display, _Xconst char* name) {
         handleError(0, display, None, 0, BadName, 0);
         return None;
     }
-    SET_XID_VALUE(font, TTF_OpenFont(fontPath, fontSize));
-    if (GET_XID_VALUE(font) == NULL){
+    FontData* fontData = malloc(sizeof(FontData));
+    if (fontData == NULL || (fontData->filePath = strdup(fontPath)) == NULL) {
+        free(fontData);
+        FREE_XID(font);
+        handleOutOfMemory(0, display, 0, 0);
+        return None;
+    }
+    fontData->size = fontSize;
+    fontData->deviceFont = NULL;
+    fontData->metrics = NULL;
+    fontData->font = TTF_OpenFont(fontPath, fontSize);
+    if (fontData->font == NULL){
+        free(fontData->filePath);
+        free(fontData);
         FREE_XID(font);
         LOG("Failed to load font %s!\n", name);
         handleError(0, display, None, 0, BadName, 0);
         return None;
     }
+    SET_XID_VALUE(font, fontData);
     return font;
 }
 
+static void freeFont(Font font) {
+    FontData* fontData = GET_FONT_DATA(font);
+    int i, way;
+    freeGlyphAtlasFont(fontData->font);
+    TTF_CloseFont(fontData->font);
+    if (fontData->deviceFont != NULL) {
+        freeGlyphAtlasFont(fontData->deviceFont);
+        TTF_CloseFont(fontData->deviceFont);
+    }
+    if (fontData->metrics != NULL) {
+        free(fontData->metrics->kerning);
+        free(fontData->metrics);
+    }
+    for (i = 0; i < TEXT_WIDTH_CACHE_SETS; i++) {
+        for (way = 0; way < TEXT_WIDTH_CACHE_WAYS; way++) {
+            if (textWidthCache[i][way].font == fontData) {
+                textWidthCache[i][way].font = NULL;
+            }
+        }
+    }
+    free(fontData->filePath);
+    free(fontData);
+    FREE_XID(font);
+}
+
+/*
+ * Get the font to rasterize text with for render targets with the device scale,
+ * so text stays sharp instead of being upscaled. Falls back to the logical font.
+ * With the render thread, this is always a separate font, because the logical one
+ * is used for measuring text on the calling thread at the same time.
+ */
+static TTF_Font* getDeviceFont(Font font) {
+    FontData* fontData = GET_FONT_DATA(font);
+    if (!IS_SCALED && !isRenderThreadEnabled()) {
+        return fontData->font;
+    }
+    if (fontData->deviceFont == NULL) {
+        fontData->deviceFont = TTF_OpenFont(fontData->filePath, TO_DEVICE(fontData->size));
+        if (fontData->deviceFont == NULL) {
+            LOG("Failed to load font %s at the device size: %s\n", fontData->filePath, TTF_GetError());
+            return fontData->font;
+        }
+    }
+    return fontData->deviceFont;
+}
+
 int XFreeFontPath(char** list) {
     free(list);
     return 1;
@@ -343,8 +454,8 @@ int XFreeFontNames(char** list) {
 int XFreeFont(Display* display, XFontStruct* font_struct) {
     // https://tronche.com/gui/x/xlib/graphics/font-metrics/XFreeFont.html
     SET_X_SERVER_REQUEST(display, X_CloseFont);
-    TTF_CloseFont(GET_FONT(font_struct->fid));
-    FREE_XID(font_struct->fid);
+    syncRenderThread();
+    freeFont(font_struct->fid);
     if (font_struct->per_char != NULL) {
         int numChars = font_struct->max_char_or_byte2 - font_struct->min_char_or_byte2;
         int i;
@@ -397,7 +508,7 @@ XFontStruct* XLoadQueryFont(Display* display, _Xconst char* name) {
     XFontStruct* fontStruct = malloc(sizeof(XFontStruct));
     if (fontStruct == NULL) {
         handleOutOfMemory(0, display, 0, 0);
-        TTF_CloseFont(font);
+        freeFont(fontId);
         return NULL;
     }
     fontStruct->fid = fontId;
@@ -524,13 +635,112 @@ char* decodeString(const char* string, int count) {
     return text;
 }
 
+/*
+ * Create the metrics tables of the font.
+ */
+static TextMetrics* getTextMetrics(FontData* fontData) {
+    if (fontData->metrics != NULL) {
+        return fontData->metrics;
+    }
+    TextMetrics* metrics = malloc(sizeof(TextMetrics));
+    if (metrics == NULL) {
+        return NULL;
+    }
+    int minX, maxX, minY, maxY, advance, first, second;
+    Bool hasKerning = False;
+    for (first = 0; first < NUM_TABLE_CHARS; first++) {
+        metrics->provided[first] = TTF_GlyphIsProvided(fontData->font, (Uint16) (FIRST_TABLE_CHAR + first))
+                && TTF_GlyphMetrics(fontData->font, (Uint16) (FIRST_TABLE_CHAR + first),
+                                    &minX, &maxX, &minY, &maxY, &advance) == 0;
+        metrics->advance[first] = (Sint16) (metrics->provided[first] ? advance : 0);
+        metrics->minX[first] = (Sint16) (metrics->provided[first] ? minX : 0);
+        metrics->right[first] = (Sint16) (metrics->provided[first] ? MAX(advance, maxX) : 0);
+    }
+    metrics->kerning = NULL;
+    if (TTF_GetFontKerning(fontData->font)) {
+        metrics->kerning = malloc(NUM_TABLE_CHARS * NUM_TABLE_CHARS);
+        for (first = 0; metrics->kerning != NULL && first < NUM_TABLE_CHARS; first++) {
+            for (second = 0; second < NUM_TABLE_CHARS; second++) {
+                int kerning = TTF_GetFontKerningSizeGlyphs(fontData->font, (Uint16) (FIRST_TABLE_CHAR + first),
+                                                           (Uint16) (FIRST_TABLE_CHAR + second));
+                metrics->kerning[first * NUM_TABLE_CHARS + second] = (Sint8) MAX(MIN(kerning, 127), -128);
+                hasKerning |= kerning != 0;
+            }
+        }
+        if (!hasKerning) {
+            free(metrics->kerning);
+            metrics->kerning = NULL;
+        }
+    }
+    fontData->metrics = metrics;
+    return metrics;
+}
+
+/*
+ * Measure the first count characters of the string with the metrics tables of the font.
+ * Returns False if the string contains characters which are not in the tables.
+ * Like TTF_SizeUTF8, the width spans from the leftmost to the rightmost pixel or advance.
+ */
+static Bool measureTableText(FontData* fontData, const char* string, int count, int* width) {
+    TextMetrics* metrics = getTextMetrics(fontData);
+    if (metrics == NULL) {
+        return False;
+    }
+    int x = 0, left = 0, right = 0, i;
+    int previous = -1;
+    for (i = 0; i < count && string[i] != '\0'; i++) {
+        int character = (Uint8) string[i] - FIRST_TABLE_CHAR;
+        // Backslashes start escape sequences, see decodeString.
+        if (character < 0 || character >= NUM_TABLE_CHARS || string[i] == '\\' || !metrics->provided[character]) {
+            return False;
+        }
+        if (metrics->kerning != NULL && previous != -1) {
+            x += metrics->kerning[previous * NUM_TABLE_CHARS + character];
+        }
+        left = MIN(left, x + metrics->minX[character]);
+        right = MAX(right, x + metrics->right[character]);
+        x += metrics->advance[character];
+        previous = character;
+    }
+    *width = right - left;
+    return True;
+}
+
 int getTextWidth(XFontStruct* font_struct, const char* string) {
-    int width, height;
+    const FontData* fontData = GET_FONT_DATA(font_struct->fid);
+    size_t length = strlen(string);
+    Uint64 hash = 0;
+    TextWidthEntry* entry = NULL;
+    int width, height, way;
+    if (length <= TEXT_WIDTH_CACHE_MAX_LENGTH) {
+        hash = hashData(string, length);
+        TextWidthEntry* set = textWidthCache[hash % TEXT_WIDTH_CACHE_SETS];
+        entry = &set[0];
+        for (way = 0; way < TEXT_WIDTH_CACHE_WAYS; way++) {
+            if (set[way].font == fontData && set[way].hash == hash && set[way].length == length
+                && memcmp(set[way].text, string, length) == 0) {
+                set[way].lastUse = ++textWidthUseCounter;
+                return set[way].width;
+            }
+            // Replace an unused or the least recently used entry of the set.
+            if (entry->font != NULL && (set[way].font == NULL || (Sint32) (set[way].lastUse - entry->lastUse) < 0)) {
+                entry = &set[way];
+            }
+        }
+    }
     if (TTF_SizeUTF8(GET_FONT(font_struct->fid), string, &width, &height) != 0) {
         LOG("Failed to calculate the text with in XTextWidth[16]: %s! "
                     "Returning max width of font.\n", TTF_GetError());
         return (int) (font_struct->max_bounds.rbearing * strlen(string));
     }
+    if (entry != NULL) {
+        entry->font = fontData;
+        entry->hash = hash;
+        entry->length = length;
+        memcpy(entry->text, string, length);
+        entry->width = width;
+        entry->lastUse = ++textWidthUseCounter;
+    }
     return width;
 }
 
@@ -567,18 +777,22 @@ int XTextWidth16(XFontStruct* font_struct, _Xconst XChar2b* string, int count) {
 
 int XTextWidth(XFontStruct* font_struct, _Xconst char* string, int count) {
     // https://tronche.com/gui/x/xlib/graphics/font-metrics/XTextWidth.html
+    int width;
+    if (measureTableText(GET_FONT_DATA(font_struct->fid), string, count, &width)) {
+        return width;
+    }
     char* text = decodeString(string, count);
     if (text == NULL) {
         LOG("Out of memory: Failed to allocate memory in XTextWidth! "
                     "Returning max width of font.\n");
         return font_struct->max_bounds.rbearing * count;
     }
-    int width = getTextWidth(font_struct, text);
+    width = getTextWidth(font_struct, text);
     free(text);
     return width;
 }
 
-Bool renderText(Display *display, SDL_Renderer *renderer, GC gc, int x, int y, const char *string) {
+Bool renderText(Display *display, Drawable drawable, GC gc, int x, int y, const char *string) {
 	LOG("Rendering text: '%s'\n", string);
 	if (string == NULL || string[0] == '\0') { return True; }
 	GraphicContext* gContext = GET_GC(gc);
@@ -588,31 +802,117 @@ Bool renderText(Display *display, SDL_Renderer *renderer, GC gc, int x, int y, c
 			GET_BLUE_FROM_COLOR(gContext->foreground),
 			GET_ALPHA_FROM_COLOR(gContext->foreground),
 	};
-	if (gContext->font == None) {
-		// TODO: do we care about XUnloadFont ?
-		gContext->font = XLoadFont(display, "fixed");
+	SDL_Surface* fontSurface;
+	if (IS_BITMAP(drawable)) {
+		// The foreground of a bitmap is just a bit, render opaque and use the coverage instead.
+		// Bitmaps are not scaled, so they are drawn with the logical font.
+		color.r = color.g = color.b = color.a = 0xFF;
+		fontSurface = TTF_RenderUTF8_Blended(GET_FONT(gContext->font), string, color);
+		if (fontSurface == NULL) {
+			return False;
+		}
+		drawBitmapSurface(drawable, fontSurface, x, y - TTF_FontAscent(GET_FONT(gContext->font)),
+						  (int) (gContext->foreground & 1));
+		SDL_FreeSurface(fontSurface);
+		return True;
 	}
-	SDL_Surface* fontSurface = TTF_RenderUTF8_Blended(GET_FONT(gContext->font), string, color);
-	if (fontSurface == NULL) {
+	// Everything else is rendered at the device resolution.
+	TTF_Font* font = getDeviceFont(gContext->font);
+	float scale = font == GET_FONT(gContext->font) ? 1.0f : 1.0f / DEVICE_SCALE;
+	SDL_Rect bounds, destR;
+	if (TTF_SizeUTF8(font, string, &bounds.w, &bounds.h) != 0) {
 		return False;
 	}
-	SDL_Rect destR;
-	destR.w = fontSurface->w;
-	destR.h = fontSurface->h;
-	SDL_Texture* fontTexture = SDL_CreateTextureFromSurface(renderer, fontSurface);
+	if (font != GET_FONT(gContext->font)) {
+		bounds.w = TO_LOGICAL(bounds.w);
+		bounds.h = TO_LOGICAL(bounds.h);
+	}
+	bounds.x = x;
+	bounds.y = y - TTF_FontAscent(GET_FONT(gContext->font))/* - 6*/;
+	// Text is drawn from the glyph atlas, only text that does not fit into it is rasterized as a whole.
+	fontSurface = NULL;
+	SDL_Rect fontRect = {0, 0, 0, 0};
+	SDL_Texture* fontTexture = NULL;
+	SDL_Renderer* fontTextureRenderer = NULL;
+	Bool res = True;
+	DrawTarget target;
+	FOR_EACH_DRAW_TARGET(drawable, gc, &bounds, target) {
+		if (target.renderer == NULL) {
+			res = False;
+			break;
+		}
+		if (drawAtlasText(target.renderer, font, string, (float) (bounds.x - target.offsetX),
+						  (float) (bounds.y - target.offsetY), scale, color)) {
+			continue;
+		}
+		if (fontSurface == NULL) {
+			fontSurface = TTF_RenderUTF8_Blended(font, string, color);
+			if (fontSurface == NULL) {
+				res = False;
+				break;
+			}
+			fontRect.w = fontSurface->w;
+			fontRect.h = fontSurface->h;
+		}
+		if (target.renderer != fontTextureRenderer) {
+			releaseTexture(fontTextureRenderer, fontTexture);
+			fontTexture = acquireSurfaceTexture(target.renderer, fontSurface);
+			fontTextureRenderer = target.renderer;
+			if (fontTexture == NULL) {
+				res = False;
+				break;
+			}
+		}
+		destR = bounds;
+		destR.x -= target.offsetX;
+		destR.y -= target.offsetY;
+		if (SDL_RenderCopy(target.renderer, fontTexture, &fontRect, &destR) != 0) {
+			res = False;
+			break;
+		}
+	}
+	releaseTexture(fontTextureRenderer, fontTexture);
 	SDL_FreeSurface(fontSurface);
-	if (fontTexture == NULL) {
-		return False;
+	return res;
+}
+
+typedef struct {
+	int x, y;
+	char text[];
+} TextArgs;
+
+static void renderDeferredText(Display* display, Drawable drawable, GC gc, void* args) {
+	TextArgs* textArgs = args;
+	if (!renderText(display, drawable, gc, textArgs->x, textArgs->y, textArgs->text)) {
+		LOG("Rendering the text failed in %s: %s\n", __func__, SDL_GetError());
+		handleError(0, display, drawable, 0, BadMatch, 0);
 	}
-	destR.x = x;
-	destR.y = y - TTF_FontAscent(GET_FONT(gContext->font))/* - 6*/;
-	// h and w are ignored
-	if (SDL_RenderCopy(renderer, fontTexture, NULL, &destR) != 0) {
-		return False;
+}
+
+/*
+ * Draw the UTF-8 text, on the render thread if it is enabled.
+ */
+static Bool drawText(Display* display, Drawable drawable, GC gc, int x, int y, const char* text) {
+	GraphicContext* gContext = GET_GC(gc);
+	if (gContext->font == None) {
+		// TODO: do we care about XUnloadFont ?
+		gContext->font = XLoadFont(display, "fixed");
+	}
+	// Bitmaps are drawn in system memory on the calling thread.
+	if (!IS_BITMAP(drawable)) {
+		size_t textSize = strlen(text) + 1;
+		TextArgs* args = beginDeferredDraw(display, drawable, gc, renderDeferredText, sizeof(TextArgs) + textSize);
+		if (args != NULL) {
+			args->x = x;
+			args->y = y;
+			memcpy(args->text, text, textSize);
+			submitDeferredDraw(args);
+			return True;
+		}
+	} else {
+		syncRenderThread();
 	}
-	SDL_DestroyTexture(fontTexture);
-	SDL_RenderPresent(renderer);
-	return True;
+	return renderText(display, drawable, gc, x, y, text);
 }
 
 int XDrawString16(Display* display, Drawable drawable, GC gc, int x, int y, _Xconst XChar2b* string, int length) {
@@ -625,13 +925,6 @@ int XDrawString16(Display* display, Drawable drawable, GC gc, int x, int y, _Xco
 		return 0;
 	}
 	if (length == 0 || ((Uint16*) string)[0] == 0) { return 1; }
-	SDL_Renderer* renderer;
-	GET_RENDERER(drawable, renderer);
-	if (renderer == NULL) {
-		LOG("Failed to get the render target in %s\n", __func__);
-		handleError(0, display, None, 0, BadDrawable, 0);
-		return 0;
-	}
 	size_t size;
 	char * text = decodeMbString((const wchar_t *) string, &size);
 	if (text == NULL) {
@@ -640,10 +933,9 @@ int XDrawString16(Display* display, Drawable drawable, GC gc, int x, int y, _Xco
 		return 0;
 	}
 	int res = 1;
-	if (!renderText(display, renderer, gc, x, y, text)) {
+	if (!drawText(display, drawable, gc, x, y, text)) {
 		LOG("Rendering the text failed in %s: %s\n", __func__, SDL_GetError());
 		handleError(0, display, drawable, 0, BadMatch, 0);
-		free(text);
 		res = 0;
 	}
 	free(text);
@@ -660,13 +952,6 @@ int XDrawString(Display* display, Drawable drawable, GC gc, int x, int y, _Xcons
 		return 0;
 	}
 	if (length == 0 || string[0] == 0) { return 1; }
-	SDL_Renderer* renderer;
-	GET_RENDERER(drawable, renderer);
-	if (renderer == NULL) {
-		LOG("Failed to get the render target in %s\n", __func__);
-		handleError(0, display, None, 0, BadDrawable, 0);
-		return 0;
-	}
 	char* text = decodeString(string, length);
 	if (text == NULL) {
 		LOG("Out of memory: Failed to allocate decoded string in XDrawString, "
@@ -675,7 +960,7 @@ int XDrawString(Display* display, Drawable drawable, GC gc, int x, int y, _Xcons
 		return 0;
 	}
 	int res = 1;
-	if (!renderText(display, renderer, gc, x, y, text)) {
+	if (!drawText(display, drawable, gc, x, y, text)) {
 		LOG("Rendering the text failed in %s: %s\n", __func__, SDL_GetError());
 		handleError(0, display, drawable, 0, BadMatch, 0);
 		res = 0;
@@ -2,10 +2,13 @@
 #include "gc.h"
 #include "display.h"
 #include "drawing.h"
+#include "bitmap.h"
+#include "renderThread.h"
 
 
 int XFreeGC(Display* display, GC gc) {
     SET_X_SERVER_REQUEST(display, X_FreeGC);
+    syncRenderThread();
     GraphicContext* gContext = GET_GC(gc);
     if (gContext->stipple != None) {
         XFreePixmap(display, gContext->stipple);
@@ -37,6 +40,7 @@ int XFreeGC(Display* display, GC gc) {
 GC XCreateGC(Display* display, Drawable d, unsigned long valuemask, XGCValues* values) {
     // https://tronche.com/gui/x/xlib/GC/XCreateGC.html
     SET_X_SERVER_REQUEST(display, X_CreateGC);
+    syncRenderThread();
     TYPE_CHECK(d, DRAWABLE, display, NULL);
     if (IS_TYPE(d, WINDOW) && IS_INPUT_ONLY(d)) {
         handleError(0, display, d, 0, BadMatch, 0);
@@ -112,14 +116,16 @@ GC XCreateGC(Display* display, Drawable d, unsigned long valuemask, XGCValues* v
 		color.g = GET_GREEN_FROM_COLOR(gc->foreground);
 		color.b = GET_BLUE_FROM_COLOR(gc->foreground);
 
-		SDL_Renderer* renderer = NULL;
-		GET_RENDERER(d, renderer);
-		if (renderer == NULL) {
-			return NULL;
+		DrawTarget target;
+		FOR_EACH_DRAW_TARGET(gc->tile, NULL, NULL, target) {
+			if (target.renderer == NULL) {
+				XFreeGC(display, graphicContextStruct);
+				return NULL;
+			}
+			SDL_SetRenderDrawColor(target.renderer, color.r, color.g, color.b, color.a);
+			SDL_Rect rect = { .x = -target.offsetX, .y = -target.offsetY, .w = 2, .h = 2 };
+			SDL_RenderFillRect(target.renderer, &rect);
 		}
-		SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-		SDL_Rect rect = { .x = 0, .y = 0, .w = 2, .h = 2 };
-		SDL_RenderFillRect(renderer, &rect);
 	}
     if (gc->stipple == None) {
 		gc->stipple = XCreatePixmap(display, d, 2, 2, 1);
@@ -127,16 +133,8 @@ GC XCreateGC(Display* display, Drawable d, unsigned long valuemask, XGCValues* v
 			XFreeGC(display, graphicContextStruct);
 			return NULL;
 		}
-		SDL_Color color = {0xFF, 0xFF, 0xFF, 0xFF};
-
-		SDL_Renderer* renderer = NULL;
-		GET_RENDERER(d, renderer);
-		if (renderer == NULL) {
-			return NULL;
-		}
-		SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
 		SDL_Rect rect = { .x = 0, .y = 0, .w = 2, .h = 2 };
-		SDL_RenderFillRect(renderer, &rect);
+		fillBitmapRectangles(gc->stipple, &rect, 1, 1);
 	}
     return graphicContextStruct;
 }
@@ -290,6 +288,8 @@ int XSetDashes(Display* display, GC gc, int dash_offset, _Xconst char dash_list[
         handleError(0, display, None, 0, BadValue, 0);
         return 0;
     }
+    // Queued requests may still use the old dashes.
+    syncRenderThread();
     GraphicContext* graphicContext = GET_GC(gc);
 	if (!setDashes(display, graphicContext, dash_list, (size_t) n, True)) return 0;
     graphicContext->dashOffset = dash_offset;
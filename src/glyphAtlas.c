@@ -0,0 +1,395 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "glyphAtlas.h"
+#include "util.h"
+
+/* Transparent space around every glyph on a page, so filtering never samples a neighbour. */
+#define GLYPH_PADDING 1
+#define INVALID_CODEPOINT 0xFFFFFFFF
+
+typedef struct AtlasGlyph {
+    struct AtlasGlyph* next;
+    SDL_Renderer* renderer;
+    TTF_Font* font;
+    Uint32 codepoint;
+    /* The page of the glyph and its area on the page, the page is -1 if the glyph has no pixels. */
+    int page;
+    SDL_Rect rect;
+    /* The position of the left edge of the glyph image relative to the pen position, and the advance. */
+    int offsetX, advance;
+} AtlasGlyph;
+
+typedef struct {
+    /* The renderer of the texture, NULL if the page is unused. */
+    SDL_Renderer* renderer;
+    SDL_Texture* texture;
+    /* Glyphs are packed into rows (shelves), only the last one is still filled. */
+    int shelfX, shelfY, shelfHeight;
+    /* The use counter value of the last text which used the page. */
+    Uint32 lastUse;
+} AtlasPage;
+
+static AtlasGlyph* glyphBuckets[GLYPH_ATLAS_BUCKETS];
+static AtlasPage pages[GLYPH_ATLAS_MAX_PAGES];
+static Uint32 useCounter = 0;
+
+static size_t getBucket(const SDL_Renderer* renderer, const TTF_Font* font, Uint32 codepoint) {
+    uintptr_t hash = (uintptr_t) renderer ^ ((uintptr_t) font >> 4) ^ (codepoint * 2654435761u);
+    return (size_t) (hash ^ hash >> 16) % GLYPH_ATLAS_BUCKETS;
+}
+
+/*
+ * Remove the glyphs of the renderer, font or page. NULL and -1 match any renderer, font and page.
+ */
+static void removeAtlasGlyphs(const SDL_Renderer* renderer, const TTF_Font* font, int page) {
+    size_t i;
+    for (i = 0; i < GLYPH_ATLAS_BUCKETS; i++) {
+        AtlasGlyph** link = &glyphBuckets[i];
+        while (*link != NULL) {
+            AtlasGlyph* glyph = *link;
+            if ((renderer == NULL || glyph->renderer == renderer) && (font == NULL || glyph->font == font)
+                && (page == -1 || glyph->page == page)) {
+                *link = glyph->next;
+                free(glyph);
+            } else {
+                link = &glyph->next;
+            }
+        }
+    }
+}
+
+/*
+ * Make the page an empty page of the renderer.
+ */
+static Bool resetAtlasPage(int page, SDL_Renderer* renderer) {
+    AtlasPage* atlasPage = &pages[page];
+    if (atlasPage->renderer != NULL) {
+        removeAtlasGlyphs(atlasPage->renderer, NULL, page);
+        if (atlasPage->renderer != renderer) {
+            SDL_DestroyTexture(atlasPage->texture);
+            atlasPage->texture = NULL;
+            atlasPage->renderer = NULL;
+        }
+    }
+    if (atlasPage->texture == NULL) {
+        atlasPage->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                               GLYPH_ATLAS_PAGE_SIZE, GLYPH_ATLAS_PAGE_SIZE);
+        if (atlasPage->texture == NULL) {
+            LOG("SDL_CreateTexture failed in %s: %s\n", __func__, SDL_GetError());
+            return False;
+        }
+        SDL_SetTextureBlendMode(atlasPage->texture, SDL_BLENDMODE_BLEND);
+    }
+    // Clear the page, the padding around the glyphs must be transparent.
+    void* pixels = calloc((size_t) GLYPH_ATLAS_PAGE_SIZE * GLYPH_ATLAS_PAGE_SIZE, sizeof(Uint32));
+    if (pixels == NULL || SDL_UpdateTexture(atlasPage->texture, NULL, pixels,
+                                            GLYPH_ATLAS_PAGE_SIZE * sizeof(Uint32)) != 0) {
+        free(pixels);
+        SDL_DestroyTexture(atlasPage->texture);
+        atlasPage->texture = NULL;
+        atlasPage->renderer = NULL;
+        return False;
+    }
+    free(pixels);
+    atlasPage->renderer = renderer;
+    atlasPage->shelfX = atlasPage->shelfY = atlasPage->shelfHeight = 0;
+    atlasPage->lastUse = useCounter;
+    return True;
+}
+
+static Bool allocateOnPage(AtlasPage* page, int width, int height, SDL_Rect* rect) {
+    if (page->shelfX + width > GLYPH_ATLAS_PAGE_SIZE) {
+        page->shelfY += page->shelfHeight;
+        page->shelfX = page->shelfHeight = 0;
+    }
+    if (page->shelfX + width > GLYPH_ATLAS_PAGE_SIZE || page->shelfY + height > GLYPH_ATLAS_PAGE_SIZE) {
+        return False;
+    }
+    rect->x = page->shelfX;
+    rect->y = page->shelfY;
+    rect->w = width - GLYPH_PADDING;
+    rect->h = height - GLYPH_PADDING;
+    page->shelfX += width;
+    page->shelfHeight = MAX(page->shelfHeight, height);
+    return True;
+}
+
+/*
+ * Find space for a glyph of the size on a page of the renderer. Pages which were used
+ * by the current text (see drawAtlasText) are never cleared. Returns the page or -1.
+ */
+static int allocateGlyphSpace(SDL_Renderer* renderer, int width, int height, SDL_Rect* rect) {
+    int i, freePage = -1, oldestPage = -1;
+    width += GLYPH_PADDING;
+    height += GLYPH_PADDING;
+    if (width > GLYPH_ATLAS_PAGE_SIZE || height > GLYPH_ATLAS_PAGE_SIZE) {
+        return -1;
+    }
+    for (i = 0; i < GLYPH_ATLAS_MAX_PAGES; i++) {
+        if (pages[i].renderer == renderer && allocateOnPage(&pages[i], width, height, rect)) {
+            return i;
+        } else if (pages[i].renderer == NULL) {
+            if (freePage == -1) freePage = i;
+        } else if (pages[i].lastUse != useCounter
+                   && (oldestPage == -1 || (Sint32) (pages[i].lastUse - pages[oldestPage].lastUse) < 0)) {
+            oldestPage = i;
+        }
+    }
+    i = freePage != -1 ? freePage : oldestPage;
+    if (i == -1 || !resetAtlasPage(i, renderer) || !allocateOnPage(&pages[i], width, height, rect)) {
+        return -1;
+    }
+    return i;
+}
+
+/*
+ * Get the glyph of the codepoint from the atlas, rasterize it if it is not in there yet.
+ */
+static AtlasGlyph* getAtlasGlyph(SDL_Renderer* renderer, TTF_Font* font, Uint32 codepoint) {
+    size_t bucket = getBucket(renderer, font, codepoint);
+    AtlasGlyph* glyph;
+    for (glyph = glyphBuckets[bucket]; glyph != NULL; glyph = glyph->next) {
+        if (glyph->codepoint == codepoint && glyph->font == font && glyph->renderer == renderer) {
+            if (glyph->page != -1) {
+                pages[glyph->page].lastUse = useCounter;
+            }
+            return glyph;
+        }
+    }
+    int minX, maxX, minY, maxY, advance;
+    if (codepoint > 0xFFFF || TTF_GlyphMetrics(font, (Uint16) codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+        return NULL;
+    }
+    glyph = malloc(sizeof(AtlasGlyph));
+    if (glyph == NULL) {
+        return NULL;
+    }
+    glyph->renderer = renderer;
+    glyph->font = font;
+    glyph->codepoint = codepoint;
+    glyph->page = -1;
+    glyph->offsetX = MIN(minX, 0);
+    glyph->advance = advance;
+    // Rasterize the glyph like a whole string would be, so it has the same position relative to the line.
+    Uint16 text[2] = {(Uint16) codepoint, 0};
+    SDL_Color white = {0xFF, 0xFF, 0xFF, 0xFF};
+    SDL_Surface* surface = maxX > minX ? TTF_RenderUNICODE_Blended(font, text, white) : NULL;
+    if (surface != NULL) {
+        SDL_Surface* convertedSurface = NULL;
+        if (surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+            convertedSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        }
+        SDL_Surface* uploadSurface = convertedSurface != NULL ? convertedSurface : surface;
+        if (uploadSurface->format->format == SDL_PIXELFORMAT_ARGB8888) {
+            glyph->page = allocateGlyphSpace(renderer, uploadSurface->w, uploadSurface->h, &glyph->rect);
+        }
+        if (glyph->page != -1) {
+            Bool mustLock = SDL_MUSTLOCK(uploadSurface);
+            if (mustLock) SDL_LockSurface(uploadSurface);
+            if (SDL_UpdateTexture(pages[glyph->page].texture, &glyph->rect, uploadSurface->pixels,
+                                  uploadSurface->pitch) != 0) {
+                LOG("SDL_UpdateTexture failed in %s: %s\n", __func__, SDL_GetError());
+                glyph->page = -1;
+            }
+            if (mustLock) SDL_UnlockSurface(uploadSurface);
+        }
+        SDL_FreeSurface(convertedSurface);
+        SDL_FreeSurface(surface);
+        if (glyph->page == -1) {
+            free(glyph);
+            return NULL;
+        }
+        pages[glyph->page].lastUse = useCounter;
+    }
+    glyph->next = glyphBuckets[bucket];
+    glyphBuckets[bucket] = glyph;
+    return glyph;
+}
+
+/*
+ * Decode the next codepoint of the UTF-8 text and advance behind it.
+ */
+static Uint32 decodeUtf8(const char** text) {
+    const Uint8* p = (const Uint8*) *text;
+    Uint32 codepoint;
+    int length, i;
+    if (p[0] < 0x80) {
+        codepoint = p[0];
+        length = 1;
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        codepoint = p[0] & 0x1Fu;
+        length = 2;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        codepoint = p[0] & 0x0Fu;
+        length = 3;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        codepoint = p[0] & 0x07u;
+        length = 4;
+    } else {
+        return INVALID_CODEPOINT;
+    }
+    for (i = 1; i < length; i++) {
+        if ((p[i] & 0xC0) != 0x80) {
+            return INVALID_CODEPOINT;
+        }
+        codepoint = codepoint << 6 | (p[i] & 0x3Fu);
+    }
+    *text += length;
+    return codepoint;
+}
+
+typedef struct {
+    SDL_Renderer* renderer;
+    SDL_Color color;
+    int page;
+    int numGlyphs;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    SDL_Vertex vertices[GLYPH_ATLAS_BATCH_SIZE * 4];
+#else
+    SDL_Rect srcRects[GLYPH_ATLAS_BATCH_SIZE];
+    SDL_Rect destRects[GLYPH_ATLAS_BATCH_SIZE];
+#endif
+} GlyphBatch;
+
+static Bool flushGlyphBatch(GlyphBatch* batch) {
+    if (batch->numGlyphs == 0) {
+        return True;
+    }
+    SDL_Texture* texture = pages[batch->page].texture;
+    int numGlyphs = batch->numGlyphs;
+    batch->numGlyphs = 0;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    static int indices[GLYPH_ATLAS_BATCH_SIZE * 6];
+    if (indices[1] == 0) {
+        // Two triangles per glyph quad.
+        int i;
+        for (i = 0; i < GLYPH_ATLAS_BATCH_SIZE; i++) {
+            indices[i * 6] = i * 4;
+            indices[i * 6 + 1] = i * 4 + 1;
+            indices[i * 6 + 2] = i * 4 + 2;
+            indices[i * 6 + 3] = i * 4 + 2;
+            indices[i * 6 + 4] = i * 4 + 1;
+            indices[i * 6 + 5] = i * 4 + 3;
+        }
+    }
+    if (SDL_RenderGeometry(batch->renderer, texture, batch->vertices, numGlyphs * 4, indices, numGlyphs * 6) != 0) {
+        LOG("SDL_RenderGeometry failed in %s: %s\n", __func__, SDL_GetError());
+        return False;
+    }
+#else
+    int i;
+    SDL_SetTextureColorMod(texture, batch->color.r, batch->color.g, batch->color.b);
+    SDL_SetTextureAlphaMod(texture, batch->color.a);
+    for (i = 0; i < numGlyphs; i++) {
+        if (SDL_RenderCopy(batch->renderer, texture, &batch->srcRects[i], &batch->destRects[i]) != 0) {
+            LOG("SDL_RenderCopy failed in %s: %s\n", __func__, SDL_GetError());
+            return False;
+        }
+    }
+#endif
+    return True;
+}
+
+static Bool addToGlyphBatch(GlyphBatch* batch, const AtlasGlyph* glyph, float x, float y, float scale) {
+    if ((batch->numGlyphs > 0 && batch->page != glyph->page) || batch->numGlyphs == GLYPH_ATLAS_BATCH_SIZE) {
+        if (!flushGlyphBatch(batch)) return False;
+    }
+    batch->page = glyph->page;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    SDL_Vertex* vertex = &batch->vertices[batch->numGlyphs * 4];
+    float left = x, top = y, right = x + glyph->rect.w * scale, bottom = y + glyph->rect.h * scale;
+    float textureLeft = (float) glyph->rect.x / GLYPH_ATLAS_PAGE_SIZE;
+    float textureTop = (float) glyph->rect.y / GLYPH_ATLAS_PAGE_SIZE;
+    float textureRight = (float) (glyph->rect.x + glyph->rect.w) / GLYPH_ATLAS_PAGE_SIZE;
+    float textureBottom = (float) (glyph->rect.y + glyph->rect.h) / GLYPH_ATLAS_PAGE_SIZE;
+    int i;
+    for (i = 0; i < 4; i++) {
+        vertex[i].position.x = i & 1 ? right : left;
+        vertex[i].position.y = i & 2 ? bottom : top;
+        vertex[i].tex_coord.x = i & 1 ? textureRight : textureLeft;
+        vertex[i].tex_coord.y = i & 2 ? textureBottom : textureTop;
+        vertex[i].color = batch->color;
+    }
+#else
+    SDL_Rect* destRect = &batch->destRects[batch->numGlyphs];
+    batch->srcRects[batch->numGlyphs] = glyph->rect;
+    destRect->x = (int) lroundf(x);
+    destRect->y = (int) lroundf(y);
+    destRect->w = (int) lroundf(glyph->rect.w * scale);
+    destRect->h = (int) lroundf(glyph->rect.h * scale);
+#endif
+    batch->numGlyphs++;
+    return True;
+}
+
+/*
+ * Walk over the glyphs of the text. If draw is False, the glyphs are only put into the atlas.
+ */
+static Bool drawAtlasGlyphs(SDL_Renderer* renderer, TTF_Font* font, const char* text, float x, float y,
+                            float scale, GlyphBatch* batch, Bool draw) {
+    Bool kerning = TTF_GetFontKerning(font) != 0;
+    Uint32 previous = 0;
+    int penX = 0;
+    while (*text != '\0') {
+        Uint32 codepoint = decodeUtf8(&text);
+        if (codepoint == INVALID_CODEPOINT) {
+            return False;
+        }
+        AtlasGlyph* glyph = getAtlasGlyph(renderer, font, codepoint);
+        if (glyph == NULL) {
+            return False;
+        }
+        if (kerning && previous != 0) {
+            penX += TTF_GetFontKerningSizeGlyphs(font, (Uint16) previous, (Uint16) codepoint);
+        }
+        if (draw && glyph->page != -1
+            && !addToGlyphBatch(batch, glyph, x + (penX + glyph->offsetX) * scale, y, scale)) {
+            return False;
+        }
+        penX += glyph->advance;
+        previous = codepoint;
+    }
+    return True;
+}
+
+/*
+ * Draw the UTF-8 text with the top left corner of its line at the position. The glyphs of the font
+ * are multiplied by the scale, which converts the pixels of the font into the coordinates of the renderer.
+ * If the glyphs can't be stored in the atlas, nothing is drawn and False is returned.
+ */
+Bool drawAtlasText(SDL_Renderer* renderer, TTF_Font* font, const char* text, float x, float y, float scale,
+                   SDL_Color color) {
+    static GlyphBatch batch;
+    // All glyphs are put into the atlas first, so nothing is drawn if one of them does not fit.
+    useCounter++;
+    if (!drawAtlasGlyphs(renderer, font, text, x, y, scale, &batch, False)) {
+        return False;
+    }
+    batch.renderer = renderer;
+    batch.color = color;
+    batch.numGlyphs = 0;
+    return drawAtlasGlyphs(renderer, font, text, x, y, scale, &batch, True) && flushGlyphBatch(&batch);
+}
+
+/*
+ * Remove the glyphs of the font, must be called before the font is closed.
+ */
+void freeGlyphAtlasFont(TTF_Font* font) {
+    removeAtlasGlyphs(NULL, font, -1);
+}
+
+/*
+ * Release the pages of the renderer. Must be called before the renderer is destroyed.
+ */
+void freeGlyphAtlas(SDL_Renderer* renderer) {
+    int i;
+    removeAtlasGlyphs(renderer, NULL, -1);
+    for (i = 0; i < GLYPH_ATLAS_MAX_PAGES; i++) {
+        if (pages[i].renderer == renderer) {
+            SDL_DestroyTexture(pages[i].texture);
+            pages[i].texture = NULL;
+            pages[i].renderer = NULL;
+        }
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef _GLYPH_ATLAS_H_
+#define _GLYPH_ATLAS_H_
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <X11/Xlib.h>
+
+/*
+ * Cache of rasterized glyphs for drawing text into textures. Every glyph is rasterized once per
+ * renderer and font (which includes the size) in white with its coverage as alpha, and is packed into
+ * a page texture of the renderer. Text is then drawn as one batch of textured quads per page, colored
+ * by the vertex colors. If all pages are in use, the least recently used page is cleared.
+ * Like the texture pool, the atlas must only be used on the thread that renders (see renderThread.h).
+ */
+
+/* The width and height of a page texture. */
+#define GLYPH_ATLAS_PAGE_SIZE 512
+/* The maximum number of pages of all renderers. */
+#define GLYPH_ATLAS_MAX_PAGES 8
+/* The number of hash buckets of the glyphs. */
+#define GLYPH_ATLAS_BUCKETS 1024
+/* The maximum number of glyphs which are drawn with a single call. */
+#define GLYPH_ATLAS_BATCH_SIZE 128
+
+Bool drawAtlasText(SDL_Renderer* renderer, TTF_Font* font, const char* text, float x, float y, float scale,
+                   SDL_Color color);
+void freeGlyphAtlasFont(TTF_Font* font);
+void freeGlyphAtlas(SDL_Renderer* renderer);
+
+#endif /* _GLYPH_ATLAS_H_ */
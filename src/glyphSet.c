@@ -0,0 +1,410 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "glyphSet.h"
+#include "picture.h"
+#include "extensions.h"
+#include "display.h"
+#include "errors.h"
+#include "renderThread.h"
+#include "util.h"
+
+/* The key of a glyph in the pixman glyph cache, pixman doesn't accept NULL keys. */
+#define GLYPH_CACHE_KEY(glyphId) ((void*) (uintptr_t) ((glyphId) + 1))
+
+/* A run of glyphs of a composite text request which all come from the same glyph set. */
+typedef struct {
+    GlyphSet glyphSet;
+    const void* chars;
+    int charSize;
+    int numChars;
+    int xOff, yOff;
+} GlyphRun;
+
+static pixman_format_code_t getGlyphImageFormat(const XRenderPictFormat* format) {
+    switch (format->depth) {
+        case 1: return PIXMAN_a1;
+        case 8: return PIXMAN_a8;
+        default: return PIXMAN_a8r8g8b8;
+    }
+}
+
+/*
+ * Get the number of bytes per row of a glyph in the image data of XRenderAddGlyphs.
+ */
+static int getGlyphRowStride(const XRenderPictFormat* format, int width) {
+    switch (format->depth) {
+        case 1: return ((width + 31) / 32) * 4;
+        case 8: return (width + 3) & ~3;
+        default: return width * 4;
+    }
+}
+
+/*
+ * Find the index of the glyph in the glyph set, or the index where it would have to be inserted.
+ */
+static size_t findGlyphIndex(const GlyphSetStruct* glyphSetStruct, Glyph id, Bool* found) {
+    size_t low = 0, high = glyphSetStruct->numGlyphs;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (glyphSetStruct->glyphs[middle].id < id) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    *found = low < glyphSetStruct->numGlyphs && glyphSetStruct->glyphs[low].id == id;
+    return low;
+}
+
+static GlyphEntry* findGlyph(const GlyphSetStruct* glyphSetStruct, Glyph id) {
+    Bool found;
+    size_t index = findGlyphIndex(glyphSetStruct, id, &found);
+    return found ? &glyphSetStruct->glyphs[index] : NULL;
+}
+
+static void removeCachedGlyph(GlyphSetStruct* glyphSetStruct, Glyph id) {
+    pixman_glyph_cache_freeze(glyphSetStruct->cache);
+    if (pixman_glyph_cache_lookup(glyphSetStruct->cache, glyphSetStruct, GLYPH_CACHE_KEY(id)) != NULL) {
+        pixman_glyph_cache_remove(glyphSetStruct->cache, glyphSetStruct, GLYPH_CACHE_KEY(id));
+    }
+    pixman_glyph_cache_thaw(glyphSetStruct->cache);
+}
+
+/*
+ * Add the glyph to the glyph set or replace the glyph with the same id.
+ * The glyph set takes the ownership of the image. Returns False if out of memory.
+ */
+static Bool storeGlyph(GlyphSetStruct* glyphSetStruct, Glyph id, const XGlyphInfo* info, pixman_image_t* image) {
+    Bool found;
+    size_t index = findGlyphIndex(glyphSetStruct, id, &found);
+    if (found) {
+        GlyphEntry* entry = &glyphSetStruct->glyphs[index];
+        removeCachedGlyph(glyphSetStruct, id);
+        pixman_image_unref(entry->image);
+        entry->info = *info;
+        entry->image = image;
+        return True;
+    }
+    if (glyphSetStruct->numGlyphs == glyphSetStruct->glyphCapacity) {
+        size_t capacity = MAX(glyphSetStruct->glyphCapacity * 2, 64);
+        GlyphEntry* glyphs = realloc(glyphSetStruct->glyphs, sizeof(GlyphEntry) * capacity);
+        if (glyphs == NULL) {
+            return False;
+        }
+        glyphSetStruct->glyphs = glyphs;
+        glyphSetStruct->glyphCapacity = capacity;
+    }
+    memmove(&glyphSetStruct->glyphs[index + 1], &glyphSetStruct->glyphs[index],
+            sizeof(GlyphEntry) * (glyphSetStruct->numGlyphs - index));
+    glyphSetStruct->glyphs[index].id = id;
+    glyphSetStruct->glyphs[index].info = *info;
+    glyphSetStruct->glyphs[index].image = image;
+    glyphSetStruct->numGlyphs++;
+    return True;
+}
+
+GlyphSet XRenderCreateGlyphSet(Display* display, _Xconst XRenderPictFormat* format) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    if (format != XRenderFindStandardFormat(display, PictStandardARGB32)
+        && format != XRenderFindStandardFormat(display, PictStandardA8)
+        && format != XRenderFindStandardFormat(display, PictStandardA1)) {
+        LOG("BadPictFormat: Got an unsupported glyph format in %s!\n", __func__);
+        handleError(0, display, None, 0, RENDER_FIRST_ERROR + BadPictFormat, X_RenderCreateGlyphSet);
+        return None;
+    }
+    GlyphSet glyphSet = ALLOC_XID();
+    GlyphSetStruct* glyphSetStruct = malloc(sizeof(GlyphSetStruct));
+    pixman_glyph_cache_t* cache = pixman_glyph_cache_create();
+    if (glyphSet == None || glyphSetStruct == NULL || cache == NULL) {
+        if (glyphSet != None) FREE_XID(glyphSet);
+        if (cache != NULL) pixman_glyph_cache_destroy(cache);
+        free(glyphSetStruct);
+        handleOutOfMemory(0, display, 0, X_RenderCreateGlyphSet);
+        return None;
+    }
+    glyphSetStruct->format = (XRenderPictFormat*) format;
+    glyphSetStruct->glyphs = NULL;
+    glyphSetStruct->numGlyphs = glyphSetStruct->glyphCapacity = 0;
+    glyphSetStruct->cache = cache;
+    glyphSetStruct->references = 1;
+    SET_XID_TYPE(glyphSet, GLYPH_SET);
+    SET_XID_VALUE(glyphSet, glyphSetStruct);
+    return glyphSet;
+}
+
+GlyphSet XRenderReferenceGlyphSet(Display* display, GlyphSet existing) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(existing, GLYPH_SET, display, None);
+    GlyphSet glyphSet = ALLOC_XID();
+    if (glyphSet == None) {
+        handleOutOfMemory(0, display, 0, X_RenderReferenceGlyphSet);
+        return None;
+    }
+    GlyphSetStruct* glyphSetStruct = GET_GLYPH_SET_STRUCT(existing);
+    glyphSetStruct->references++;
+    SET_XID_TYPE(glyphSet, GLYPH_SET);
+    SET_XID_VALUE(glyphSet, glyphSetStruct);
+    return glyphSet;
+}
+
+void XRenderFreeGlyphSet(Display* display, GlyphSet glyphset) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(glyphset, GLYPH_SET, display);
+    GlyphSetStruct* glyphSetStruct = GET_GLYPH_SET_STRUCT(glyphset);
+    FREE_XID(glyphset);
+    if (--glyphSetStruct->references > 0) return;
+    size_t i;
+    for (i = 0; i < glyphSetStruct->numGlyphs; i++) {
+        pixman_image_unref(glyphSetStruct->glyphs[i].image);
+    }
+    free(glyphSetStruct->glyphs);
+    pixman_glyph_cache_destroy(glyphSetStruct->cache);
+    free(glyphSetStruct);
+}
+
+void XRenderAddGlyphs(Display* display, GlyphSet glyphset, _Xconst Glyph* gids, _Xconst XGlyphInfo* glyphs,
+                      int nglyphs, _Xconst char* images, int nbyte_images) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(glyphset, GLYPH_SET, display);
+    GlyphSetStruct* glyphSetStruct = GET_GLYPH_SET_STRUCT(glyphset);
+    size_t totalSize = 0;
+    int i, y;
+    for (i = 0; i < nglyphs; i++) {
+        totalSize += (size_t) getGlyphRowStride(glyphSetStruct->format, glyphs[i].width) * glyphs[i].height;
+    }
+    if (totalSize > (size_t) MAX(nbyte_images, 0)) {
+        LOG("BadLength: The glyph images are too short in %s!\n", __func__);
+        handleError(0, display, None, 0, BadLength, X_RenderAddGlyphs);
+        return;
+    }
+    pixman_format_code_t imageFormat = getGlyphImageFormat(glyphSetStruct->format);
+    for (i = 0; i < nglyphs; i++) {
+        int width = glyphs[i].width, height = glyphs[i].height;
+        int rowStride = getGlyphRowStride(glyphSetStruct->format, width);
+        pixman_image_t* image = pixman_image_create_bits(imageFormat, MAX(width, 1), MAX(height, 1), NULL, 0);
+        if (image == NULL) {
+            handleOutOfMemory(0, display, 0, X_RenderAddGlyphs);
+            return;
+        }
+        Uint8* pixels = (Uint8*) pixman_image_get_data(image);
+        int stride = pixman_image_get_stride(image);
+        for (y = 0; y < height; y++) {
+            memcpy(pixels + y * stride, images + y * rowStride, (size_t) MIN(rowStride, stride));
+        }
+        images += rowStride * height;
+        if (imageFormat == PIXMAN_a8r8g8b8) {
+            pixman_image_set_component_alpha(image, True);
+        }
+        if (!storeGlyph(glyphSetStruct, gids[i], &glyphs[i], image)) {
+            pixman_image_unref(image);
+            handleOutOfMemory(0, display, 0, X_RenderAddGlyphs);
+            return;
+        }
+    }
+}
+
+void XRenderFreeGlyphs(Display* display, GlyphSet glyphset, _Xconst Glyph* gids, int nglyphs) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(glyphset, GLYPH_SET, display);
+    GlyphSetStruct* glyphSetStruct = GET_GLYPH_SET_STRUCT(glyphset);
+    int i;
+    for (i = 0; i < nglyphs; i++) {
+        Bool found;
+        size_t index = findGlyphIndex(glyphSetStruct, gids[i], &found);
+        if (!found) {
+            LOG("BadGlyph: Got unknown glyph %lu in %s!\n", gids[i], __func__);
+            handleError(0, display, gids[i], 0, RENDER_FIRST_ERROR + BadGlyph, X_RenderFreeGlyphs);
+            return;
+        }
+        removeCachedGlyph(glyphSetStruct, gids[i]);
+        pixman_image_unref(glyphSetStruct->glyphs[index].image);
+        memmove(&glyphSetStruct->glyphs[index], &glyphSetStruct->glyphs[index + 1],
+                sizeof(GlyphEntry) * (glyphSetStruct->numGlyphs - index - 1));
+        glyphSetStruct->numGlyphs--;
+    }
+}
+
+static Glyph getRunGlyph(const GlyphRun* run, int index) {
+    switch (run->charSize) {
+        case 1: return ((const unsigned char*) run->chars)[index];
+        case 2: return ((const unsigned short*) run->chars)[index];
+        default: return ((const unsigned int*) run->chars)[index];
+    }
+}
+
+/*
+ * Get the bounds of the glyphs of all runs in destination coordinates.
+ * Returns False if the glyphs don't cover anything.
+ */
+static Bool getGlyphBounds(const GlyphRun* runs, int numRuns, SDL_Rect* bounds, Bool* hasColorGlyphs) {
+    int penX = 0, penY = 0, i, j;
+    Bool hasBounds = False;
+    *hasColorGlyphs = False;
+    for (i = 0; i < numRuns; i++) {
+        GlyphSetStruct* glyphSetStruct = GET_GLYPH_SET_STRUCT(runs[i].glyphSet);
+        if (glyphSetStruct->format->depth == 32) {
+            *hasColorGlyphs = True;
+        }
+        penX += runs[i].xOff;
+        penY += runs[i].yOff;
+        for (j = 0; j < runs[i].numChars; j++) {
+            GlyphEntry* entry = findGlyph(glyphSetStruct, getRunGlyph(&runs[i], j));
+            if (entry == NULL) continue;
+            SDL_Rect glyphRect = {penX - entry->info.x, penY - entry->info.y, entry->info.width, entry->info.height};
+            penX += entry->info.xOff;
+            penY += entry->info.yOff;
+            if (glyphRect.w == 0 || glyphRect.h == 0) continue;
+            if (hasBounds) {
+                SDL_UnionRect(bounds, &glyphRect, bounds);
+            } else {
+                *bounds = glyphRect;
+                hasBounds = True;
+            }
+        }
+    }
+    return hasBounds;
+}
+
+/*
+ * Accumulate the coverage of the glyphs of all runs into the mask, which covers the bounds.
+ */
+static Bool rasterizeGlyphs(const GlyphRun* runs, int numRuns, pixman_image_t* mask, const SDL_Rect* bounds) {
+    pixman_color_t white = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+    pixman_image_t* source = pixman_image_create_solid_fill(&white);
+    int maxChars = 0, penX = 0, penY = 0, i, j;
+    for (i = 0; i < numRuns; i++) {
+        maxChars = MAX(maxChars, runs[i].numChars);
+    }
+    pixman_glyph_t* glyphs = malloc(sizeof(pixman_glyph_t) * MAX(maxChars, 1));
+    if (source == NULL || glyphs == NULL) {
+        if (source != NULL) pixman_image_unref(source);
+        free(glyphs);
+        return False;
+    }
+    for (i = 0; i < numRuns; i++) {
+        GlyphSetStruct* glyphSetStruct = GET_GLYPH_SET_STRUCT(runs[i].glyphSet);
+        int numGlyphs = 0;
+        penX += runs[i].xOff;
+        penY += runs[i].yOff;
+        pixman_glyph_cache_freeze(glyphSetStruct->cache);
+        for (j = 0; j < runs[i].numChars; j++) {
+            Glyph id = getRunGlyph(&runs[i], j);
+            GlyphEntry* entry = findGlyph(glyphSetStruct, id);
+            if (entry == NULL) {
+                LOG("Skipping unknown glyph %lu in %s\n", id, __func__);
+                continue;
+            }
+            const void* cachedGlyph = pixman_glyph_cache_lookup(glyphSetStruct->cache, glyphSetStruct,
+                                                                GLYPH_CACHE_KEY(id));
+            if (cachedGlyph == NULL) {
+                cachedGlyph = pixman_glyph_cache_insert(glyphSetStruct->cache, glyphSetStruct, GLYPH_CACHE_KEY(id),
+                                                        entry->info.x, entry->info.y, entry->image);
+            }
+            if (cachedGlyph != NULL && entry->info.width != 0 && entry->info.height != 0) {
+                glyphs[numGlyphs].x = penX;
+                glyphs[numGlyphs].y = penY;
+                glyphs[numGlyphs].glyph = cachedGlyph;
+                numGlyphs++;
+            }
+            penX += entry->info.xOff;
+            penY += entry->info.yOff;
+        }
+        pixman_composite_glyphs_no_mask(PIXMAN_OP_ADD, source, mask, 0, 0, -bounds->x, -bounds->y,
+                                        glyphSetStruct->cache, numGlyphs, glyphs);
+        pixman_glyph_cache_thaw(glyphSetStruct->cache);
+    }
+    free(glyphs);
+    pixman_image_unref(source);
+    return True;
+}
+
+static void compositeGlyphRuns(Display* display, int op, Picture src, Picture dst, int xSrc, int ySrc,
+                               const GlyphRun* runs, int numRuns, unsigned char minorCode) {
+    int i;
+    if (!checkCompositePictures(display, op, src, dst, minorCode)) return;
+    for (i = 0; i < numRuns; i++) {
+        TYPE_CHECK(runs[i].glyphSet, GLYPH_SET, display);
+    }
+    if (numRuns <= 0 || op == PictOpDst) return;
+    syncRenderThread();
+    SDL_Rect bounds;
+    Bool hasColorGlyphs;
+    CompositeArea area;
+    if (!getGlyphBounds(runs, numRuns, &bounds, &hasColorGlyphs) || !beginComposite(dst, &bounds, &area)) return;
+    // Glyphs are rasterized at their own resolution, the mask is scaled to the destination.
+    pixman_image_t* coverage = pixman_image_create_bits(hasColorGlyphs ? PIXMAN_a8r8g8b8 : PIXMAN_a8,
+                                                        area.bounds.w, area.bounds.h, NULL, 0);
+    if (coverage == NULL || !rasterizeGlyphs(runs, numRuns, coverage, &area.bounds)) {
+        if (coverage != NULL) pixman_image_unref(coverage);
+        handleOutOfMemory(0, display, 0, minorCode);
+        return;
+    }
+    if (hasColorGlyphs) {
+        pixman_image_set_component_alpha(coverage, True);
+    }
+    // The source is aligned to the origin of the first glyph.
+    compositeCoverage(display, op, src, xSrc - runs[0].xOff, ySrc - runs[0].yOff, coverage, 1.0f, &area);
+}
+
+#define COMPOSITE_TEXT(display, op, src, dst, xSrc, ySrc, elts, nelt, charType, minorCode) {\
+    GlyphRun* runs = malloc(sizeof(GlyphRun) * MAX(nelt, 1));\
+    int eltIndex;\
+    if (runs == NULL) {\
+        handleOutOfMemory(0, display, 0, minorCode);\
+        return;\
+    }\
+    for (eltIndex = 0; eltIndex < (nelt); eltIndex++) {\
+        runs[eltIndex].glyphSet = (elts)[eltIndex].glyphset;\
+        runs[eltIndex].chars = (elts)[eltIndex].chars;\
+        runs[eltIndex].charSize = sizeof(charType);\
+        runs[eltIndex].numChars = (elts)[eltIndex].nchars;\
+        runs[eltIndex].xOff = (elts)[eltIndex].xOff;\
+        runs[eltIndex].yOff = (elts)[eltIndex].yOff;\
+    }\
+    compositeGlyphRuns(display, op, src, dst, xSrc, ySrc, runs, nelt, minorCode);\
+    free(runs);\
+}
+
+void XRenderCompositeText8(Display* display, int op, Picture src, Picture dst, _Xconst XRenderPictFormat* maskFormat,
+                           int xSrc, int ySrc, int xDst, int yDst, _Xconst XGlyphElt8* elts, int nelt) {
+    // The glyphs start at the offset of the first element, xDst and yDst are not used by the protocol.
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    COMPOSITE_TEXT(display, op, src, dst, xSrc, ySrc, elts, nelt, char, X_RenderCompositeGlyphs8);
+}
+
+void XRenderCompositeText16(Display* display, int op, Picture src, Picture dst, _Xconst XRenderPictFormat* maskFormat,
+                            int xSrc, int ySrc, int xDst, int yDst, _Xconst XGlyphElt16* elts, int nelt) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    COMPOSITE_TEXT(display, op, src, dst, xSrc, ySrc, elts, nelt, unsigned short, X_RenderCompositeGlyphs16);
+}
+
+void XRenderCompositeText32(Display* display, int op, Picture src, Picture dst, _Xconst XRenderPictFormat* maskFormat,
+                            int xSrc, int ySrc, int xDst, int yDst, _Xconst XGlyphElt32* elts, int nelt) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    COMPOSITE_TEXT(display, op, src, dst, xSrc, ySrc, elts, nelt, unsigned int, X_RenderCompositeGlyphs32);
+}
+
+void XRenderCompositeString8(Display* display, int op, Picture src, Picture dst,
+                             _Xconst XRenderPictFormat* maskFormat, GlyphSet glyphset, int xSrc, int ySrc,
+                             int xDst, int yDst, _Xconst char* string, int nchar) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    GlyphRun run = {glyphset, string, sizeof(char), nchar, xDst, yDst};
+    compositeGlyphRuns(display, op, src, dst, xSrc, ySrc, &run, 1, X_RenderCompositeGlyphs8);
+}
+
+void XRenderCompositeString16(Display* display, int op, Picture src, Picture dst,
+                              _Xconst XRenderPictFormat* maskFormat, GlyphSet glyphset, int xSrc, int ySrc,
+                              int xDst, int yDst, _Xconst unsigned short* string, int nchar) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    GlyphRun run = {glyphset, string, sizeof(unsigned short), nchar, xDst, yDst};
+    compositeGlyphRuns(display, op, src, dst, xSrc, ySrc, &run, 1, X_RenderCompositeGlyphs16);
+}
+
+void XRenderCompositeString32(Display* display, int op, Picture src, Picture dst,
+                              _Xconst XRenderPictFormat* maskFormat, GlyphSet glyphset, int xSrc, int ySrc,
+                              int xDst, int yDst, _Xconst unsigned int* string, int nchar) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    GlyphRun run = {glyphset, string, sizeof(unsigned int), nchar, xDst, yDst};
+    compositeGlyphRuns(display, op, src, dst, xSrc, ySrc, &run, 1, X_RenderCompositeGlyphs32);
+}
@@ -0,0 +1,32 @@
+#ifndef _GLYPH_SET_H_
+#define _GLYPH_SET_H_
+
+#include <pixman.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/Xrender.h>
+
+/*
+ * A glyph set of the RENDER extension. The glyphs are kept sorted by their id, the pixman
+ * glyph cache of the set is only used to composite them and is refilled from the glyphs on a miss.
+ * Every XID that references the set (see XRenderReferenceGlyphSet) holds one reference.
+ */
+
+typedef struct {
+    Glyph id;
+    XGlyphInfo info;
+    /* The coverage (or the premultiplied color for ARGB32 sets) of the glyph. */
+    pixman_image_t* image;
+} GlyphEntry;
+
+typedef struct {
+    XRenderPictFormat* format;
+    GlyphEntry* glyphs;
+    size_t numGlyphs;
+    size_t glyphCapacity;
+    pixman_glyph_cache_t* cache;
+    int references;
+} GlyphSetStruct;
+
+#define GET_GLYPH_SET_STRUCT(glyphSet) ((GlyphSetStruct*) GET_XID_VALUE(glyphSet))
+
+#endif /* _GLYPH_SET_H_ */
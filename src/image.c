@@ -1,9 +1,21 @@
+#include <stddef.h>
+#include <string.h>
 #include "X11/Xlib.h"
+#include "image.h"
+#include "imageStream.h"
 #include "errors.h"
 #include "drawing.h"
+#include "bitmap.h"
+#include "colors.h"
+#include "gc.h"
+#include "pixelConversion.h"
+#include "visual.h"
 #include "resourceTypes.h"
 #include "window.h"
 #include "display.h"
+#include "renderThread.h"
+#include "texturePool.h"
+#include "util.h"
 
 // Inspired by https://github.com/csulmone/X11/blob/59029dc09211926a5c95ff1dd2b828574fefcde6/libX11-1.5.0/src/ImUtil.c
 
@@ -11,6 +23,12 @@ XImage* XCreateImage(Display* display, Visual* visual, unsigned int depth, int f
                      char* data, unsigned int width, unsigned int height, int bitmap_pad,
                      int bytes_per_line) {
     // https://tronche.com/gui/x/xlib/utilities/XCreateImage.html
+    if (depth == 0 || (format != XYBitmap && format != XYPixmap && format != ZPixmap)
+        || (format == XYBitmap && depth != 1)
+        || (bitmap_pad != 8 && bitmap_pad != 16 && bitmap_pad != 32) || offset < 0) {
+        LOG("Invalid argument: Got invalid parameters in %s\n", __func__);
+        return NULL;
+    }
     XImage* image = malloc(sizeof(XImage));
     if (image == NULL) {
         handleOutOfMemory(0, display, 0, 0);
@@ -19,21 +37,24 @@ XImage* XCreateImage(Display* display, Visual* visual, unsigned int depth, int f
     LOG("%s: w = %d, h = %d\n", __func__, (int) width, (int) height);
     image->width = width;
     image->height = height;
+    image->xoffset = offset;
     image->format = format;
     image->data = data;
-    image->byte_order = MSBFirst;
+    image->byte_order = ImageByteOrder(display);
     image->bitmap_unit = 8;
     #if SDL_BYTEORDER == SDL_BIG_ENDIAN
     image->bitmap_bit_order = MSBFirst;
     #else
     image->bitmap_bit_order = LSBFirst;
     #endif
+    image->bitmap_pad = bitmap_pad;
     image->depth = depth;
-    image->bytes_per_line = bytes_per_line;
     if (format != ZPixmap) {
         image->bits_per_pixel = 1;
     } else {
-        if (depth <= 4) {
+        if (depth == 1) {
+            image->bits_per_pixel = 1;
+        } else if (depth <= 4) {
             image->bits_per_pixel = 4;
         } else if (depth <= 8) {
             image->bits_per_pixel = 8;
@@ -43,66 +64,414 @@ XImage* XCreateImage(Display* display, Visual* visual, unsigned int depth, int f
             image->bits_per_pixel = 32;
         }
     }
+    if (visual != NULL) {
+        image->red_mask = visual->red_mask;
+        image->green_mask = visual->green_mask;
+        image->blue_mask = visual->blue_mask;
+    } else {
+        image->red_mask = image->green_mask = image->blue_mask = 0;
+    }
+    unsigned long bitsPerLine = format == ZPixmap ? (unsigned long) width * image->bits_per_pixel
+                                                  : (unsigned long) width + offset;
+    unsigned long minBytesPerLine = (bitsPerLine + bitmap_pad - 1) / bitmap_pad * (bitmap_pad / 8);
+    if (bytes_per_line == 0) {
+        image->bytes_per_line = (int) minBytesPerLine;
+    } else if ((unsigned long) bytes_per_line < minBytesPerLine) {
+        LOG("Invalid argument: bytes_per_line %d is too small in %s\n", bytes_per_line, __func__);
+        free(image);
+        return NULL;
+    } else {
+        image->bytes_per_line = bytes_per_line;
+    }
+    image->obdata = NULL;
+    _XInitImageFuncPtrs(image);
     return image;
 }
 
-char* getImageDataPointer(XImage* image, unsigned int x, unsigned int y) {
-    char* pointer = image->data;
-    pointer += image->bytes_per_line * y;
-    return pointer + (image->bits_per_pixel / 8) * x;
+/*
+ * The pixel accessors of the images. The fitting accessors for the format, depth and bit and byte order
+ * of an image are selected once by _XInitImageFuncPtrs, so getting and putting a pixel only has to
+ * compute the address of the pixel. Like in Xlib, the coordinates are not checked.
+ */
+
+#define IMAGE_ROW(image, y) ((Uint8*) (image)->data + (unsigned long) (y) * (image)->bytes_per_line)
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define HOST_BYTE_ORDER MSBFirst
+#else
+#define HOST_BYTE_ORDER LSBFirst
+#endif
+
+typedef unsigned long (*GetPixelFunction)(XImage* image, int x, int y);
+typedef int (*PutPixelFunction)(XImage* image, int x, int y, unsigned long pixel);
+
+/*
+ * Get the address of the byte that contains the bit of the pixel in a row of an XYBitmap,
+ * of a plane of an XYPixmap or of a depth 1 ZPixmap, and the mask of the bit in the byte.
+ */
+static Uint8* getImageBitAddress(const XImage* image, const Uint8* row, int x, Uint8* bitMask) {
+    int unit = image->bitmap_unit > 8 ? image->bitmap_unit : 8;
+    int bit = x + image->xoffset;
+    int significance = image->bitmap_bit_order == LSBFirst ? bit % unit : unit - 1 - bit % unit;
+    int byte = significance / 8;
+    if (image->byte_order == MSBFirst) {
+        byte = unit / 8 - 1 - byte;
+    }
+    *bitMask = (Uint8) (1 << (significance % 8));
+    return (Uint8*) row + bit / unit * (unit / 8) + byte;
 }
 
-int putPixel(XImage* image, int x, int y, unsigned long pixel) {
-    // https://tronche.com/gui/x/xlib/utilities/XPutPixel.html
-    LOG("%s on %p: %lu (%ld, %ld, %ld)\n", __func__, image, pixel,
-        (pixel >> 24) & 0xFF, (pixel >> 16) & 0xFF, (pixel >> 8) & 0xFF);
-    if (image->data == NULL) {
-        LOG("Invalid argument: Got image with NULL data in XPutPixel\n");
-        return 0;
+/*
+ * Get the bit of the pixel in the row of an XYBitmap, of a plane of an XYPixmap or of a depth 1 ZPixmap.
+ */
+static int getImageBit(const XImage* image, const Uint8* row, int x) {
+    Uint8 bitMask;
+    return (*getImageBitAddress(image, row, x, &bitMask) & bitMask) != 0;
+}
+
+static void setImageBit(const XImage* image, Uint8* row, int x, int value) {
+    Uint8 bitMask;
+    Uint8* pointer = getImageBitAddress(image, row, x, &bitMask);
+    *pointer = (Uint8) (value ? *pointer | bitMask : *pointer & ~bitMask);
+}
+
+/* Single bit images with a bitmap unit that does not reorder bytes, which are most of them. */
+static unsigned long getPixel1MSB(XImage* image, int x, int y) {
+    x += image->xoffset;
+    return (IMAGE_ROW(image, y)[x >> 3] >> (7 - (x & 7))) & 1;
+}
+
+static int putPixel1MSB(XImage* image, int x, int y, unsigned long pixel) {
+    x += image->xoffset;
+    Uint8* pointer = IMAGE_ROW(image, y) + (x >> 3);
+    Uint8 bitMask = (Uint8) (0x80 >> (x & 7));
+    *pointer = (Uint8) (pixel & 1 ? *pointer | bitMask : *pointer & ~bitMask);
+    return 1;
+}
+
+static unsigned long getPixel1LSB(XImage* image, int x, int y) {
+    x += image->xoffset;
+    return (IMAGE_ROW(image, y)[x >> 3] >> (x & 7)) & 1;
+}
+
+static int putPixel1LSB(XImage* image, int x, int y, unsigned long pixel) {
+    x += image->xoffset;
+    Uint8* pointer = IMAGE_ROW(image, y) + (x >> 3);
+    Uint8 bitMask = (Uint8) (1 << (x & 7));
+    *pointer = (Uint8) (pixel & 1 ? *pointer | bitMask : *pointer & ~bitMask);
+    return 1;
+}
+
+/* Single bit images with a bitmap unit whose byte order differs from its bit order. */
+static unsigned long getPixel1(XImage* image, int x, int y) {
+    return (unsigned long) getImageBit(image, IMAGE_ROW(image, y), x);
+}
+
+static int putPixel1(XImage* image, int x, int y, unsigned long pixel) {
+    setImageBit(image, IMAGE_ROW(image, y), x, (int) (pixel & 1));
+    return 1;
+}
+
+/* XYPixmap images with more than one plane. The planes are stored after each other, the most significant first. */
+static unsigned long getPixelXY(XImage* image, int x, int y) {
+    unsigned long planeSize = (unsigned long) image->bytes_per_line * image->height;
+    const Uint8* row = IMAGE_ROW(image, y);
+    unsigned long pixel = 0;
+    int plane;
+    for (plane = 0; plane < image->depth; plane++, row += planeSize) {
+        pixel = pixel << 1 | (unsigned long) getImageBit(image, row, x);
     }
-    char* pointer;
-    switch (image->format) {
-        case ZPixmap:
-        case XYBitmap:
-            pointer = getImageDataPointer(image, x, y);
-            if (image->bits_per_pixel == 32) {
-                *((unsigned long*) pointer) = pixel;
-            }
-            break;
-        case XYPixmap:
-            LOG("Warn: Got unimplemented format XYPixmap\n");
-            break;
-        default:
-            LOG("Warn: Got invalid format %d\n", image->format);
-            return 0;
+    return pixel;
+}
+
+static int putPixelXY(XImage* image, int x, int y, unsigned long pixel) {
+    unsigned long planeSize = (unsigned long) image->bytes_per_line * image->height;
+    Uint8* row = IMAGE_ROW(image, y);
+    int plane;
+    for (plane = image->depth - 1; plane >= 0; plane--, row += planeSize) {
+        setImageBit(image, row, x, (int) ((pixel >> plane) & 1));
     }
     return 1;
 }
 
-unsigned long getPixel(XImage* image, int x, int y) {
-    // https://tronche.com/gui/x/xlib/utilities/XGetPixel.html
-    LOG("%s from %p: x = %d, y = %d\n", __func__, image, x, y);
-    if (image->data == NULL) {
-        LOG("Invalid argument: Got image with NULL data in XGetPixel\n");
-        return 0; // TODO: throw error
-    }
-    char* pointer;
-    switch (image->format) {
-        case ZPixmap:
-        case XYBitmap:
-            pointer = getImageDataPointer(image, x, y);
-//            LOG("%s: bits_per_pixel = %d, value = %x (%d)\n", __func__, image->bits_per_pixel, *pointer & 0xFF, (int) *pointer & 0xFF);
-            if (image->bits_per_pixel == 32) {
-                return *((unsigned long*) pointer);
-            } else if (image->bits_per_pixel == 1) {
-                return 0x000000FF | (*pointer << 12) | (*pointer << 8) | (*pointer << 4);
-            }
+/* ZPixmap images with 4 bits per pixel, the byte order selects which nibble comes first. */
+static unsigned long getPixel4MSB(XImage* image, int x, int y) {
+    Uint8 byte = IMAGE_ROW(image, y)[x >> 1];
+    return x & 1 ? byte & 0x0F : byte >> 4;
+}
+
+static int putPixel4MSB(XImage* image, int x, int y, unsigned long pixel) {
+    Uint8* pointer = IMAGE_ROW(image, y) + (x >> 1);
+    *pointer = (Uint8) (x & 1 ? (*pointer & 0xF0) | (pixel & 0x0F) : (*pointer & 0x0F) | (pixel & 0x0F) << 4);
+    return 1;
+}
+
+static unsigned long getPixel4LSB(XImage* image, int x, int y) {
+    Uint8 byte = IMAGE_ROW(image, y)[x >> 1];
+    return x & 1 ? byte >> 4 : byte & 0x0F;
+}
+
+static int putPixel4LSB(XImage* image, int x, int y, unsigned long pixel) {
+    Uint8* pointer = IMAGE_ROW(image, y) + (x >> 1);
+    *pointer = (Uint8) (x & 1 ? (*pointer & 0x0F) | (pixel & 0x0F) << 4 : (*pointer & 0xF0) | (pixel & 0x0F));
+    return 1;
+}
+
+static unsigned long getPixel8(XImage* image, int x, int y) {
+    return IMAGE_ROW(image, y)[x];
+}
+
+static int putPixel8(XImage* image, int x, int y, unsigned long pixel) {
+    IMAGE_ROW(image, y)[x] = (Uint8) pixel;
+    return 1;
+}
+
+/* ZPixmap images with 16 or 32 bits per pixel in the byte order of the host. */
+static unsigned long getPixel16(XImage* image, int x, int y) {
+    Uint16 pixel;
+    memcpy(&pixel, IMAGE_ROW(image, y) + x * 2, sizeof(pixel));
+    return pixel;
+}
+
+static int putPixel16(XImage* image, int x, int y, unsigned long pixel) {
+    Uint16 value = (Uint16) pixel;
+    memcpy(IMAGE_ROW(image, y) + x * 2, &value, sizeof(value));
+    return 1;
+}
+
+static unsigned long getPixel32(XImage* image, int x, int y) {
+    Uint32 pixel;
+    memcpy(&pixel, IMAGE_ROW(image, y) + x * 4, sizeof(pixel));
+    return pixel;
+}
+
+static int putPixel32(XImage* image, int x, int y, unsigned long pixel) {
+    Uint32 value = (Uint32) pixel;
+    memcpy(IMAGE_ROW(image, y) + x * 4, &value, sizeof(value));
+    return 1;
+}
+
+/* ZPixmap images with 16 or 32 bits per pixel in the other byte order. */
+static unsigned long getPixel16Swapped(XImage* image, int x, int y) {
+    return SDL_Swap16((Uint16) getPixel16(image, x, y));
+}
+
+static int putPixel16Swapped(XImage* image, int x, int y, unsigned long pixel) {
+    return putPixel16(image, x, y, SDL_Swap16((Uint16) pixel));
+}
+
+static unsigned long getPixel32Swapped(XImage* image, int x, int y) {
+    return SDL_Swap32((Uint32) getPixel32(image, x, y));
+}
+
+static int putPixel32Swapped(XImage* image, int x, int y, unsigned long pixel) {
+    return putPixel32(image, x, y, SDL_Swap32((Uint32) pixel));
+}
+
+/* ZPixmap images with 24 bits per pixel. */
+static unsigned long getPixel24MSB(XImage* image, int x, int y) {
+    const Uint8* pointer = IMAGE_ROW(image, y) + x * 3;
+    return (unsigned long) pointer[0] << 16 | (unsigned long) pointer[1] << 8 | pointer[2];
+}
+
+static int putPixel24MSB(XImage* image, int x, int y, unsigned long pixel) {
+    Uint8* pointer = IMAGE_ROW(image, y) + x * 3;
+    pointer[0] = (Uint8) (pixel >> 16);
+    pointer[1] = (Uint8) (pixel >> 8);
+    pointer[2] = (Uint8) pixel;
+    return 1;
+}
+
+static unsigned long getPixel24LSB(XImage* image, int x, int y) {
+    const Uint8* pointer = IMAGE_ROW(image, y) + x * 3;
+    return (unsigned long) pointer[2] << 16 | (unsigned long) pointer[1] << 8 | pointer[0];
+}
+
+static int putPixel24LSB(XImage* image, int x, int y, unsigned long pixel) {
+    Uint8* pointer = IMAGE_ROW(image, y) + x * 3;
+    pointer[0] = (Uint8) pixel;
+    pointer[1] = (Uint8) (pixel >> 8);
+    pointer[2] = (Uint8) (pixel >> 16);
+    return 1;
+}
+
+/* Images with a pixel size that has no accessor. */
+static unsigned long getPixelUnsupported(XImage* image, int x, int y) {
+    return 0;
+}
+
+static int putPixelUnsupported(XImage* image, int x, int y, unsigned long pixel) {
+    return 0;
+}
+
+/*
+ * Select the pixel accessors for the layout of the image.
+ */
+static void getPixelFunctions(const XImage* image, GetPixelFunction* getPixel, PutPixelFunction* putPixel) {
+    Bool hostOrder = image->byte_order == HOST_BYTE_ORDER;
+    if (image->format == XYPixmap && image->depth > 1) {
+        *getPixel = getPixelXY;
+        *putPixel = putPixelXY;
+        return;
+    }
+    if (image->format != ZPixmap || image->bits_per_pixel == 1) {
+        if (image->bitmap_unit > 8 && image->byte_order != image->bitmap_bit_order) {
+            *getPixel = getPixel1;
+            *putPixel = putPixel1;
+        } else if (image->bitmap_bit_order == MSBFirst) {
+            *getPixel = getPixel1MSB;
+            *putPixel = putPixel1MSB;
+        } else {
+            *getPixel = getPixel1LSB;
+            *putPixel = putPixel1LSB;
+        }
+        return;
+    }
+    switch (image->bits_per_pixel) {
+        case 4:
+            *getPixel = image->byte_order == MSBFirst ? getPixel4MSB : getPixel4LSB;
+            *putPixel = image->byte_order == MSBFirst ? putPixel4MSB : putPixel4LSB;
+            break;
+        case 8:
+            *getPixel = getPixel8;
+            *putPixel = putPixel8;
+            break;
+        case 16:
+            *getPixel = hostOrder ? getPixel16 : getPixel16Swapped;
+            *putPixel = hostOrder ? putPixel16 : putPixel16Swapped;
             break;
-        case XYPixmap:
-            LOG("Warn: Got unimplemented format XYPixmap\n");
+        case 24:
+            *getPixel = image->byte_order == MSBFirst ? getPixel24MSB : getPixel24LSB;
+            *putPixel = image->byte_order == MSBFirst ? putPixel24MSB : putPixel24LSB;
+            break;
+        case 32:
+            *getPixel = hostOrder ? getPixel32 : getPixel32Swapped;
+            *putPixel = hostOrder ? putPixel32 : putPixel32Swapped;
             break;
         default:
-            LOG("Warn: Got invalid format %d\n", image->format);
+            *getPixel = getPixelUnsupported;
+            *putPixel = putPixelUnsupported;
+    }
+}
+
+/*
+ * Copy the area of the source image to the position in the destination image, which have the same layout.
+ * Rows of whole bytes are copied at once, everything else pixel by pixel.
+ */
+static void copyImageArea(XImage* source, int srcX, int srcY, XImage* dest, int destX, int destY,
+                          int width, int height) {
+    int x, y, plane;
+    int bitsPerPixel = source->format == ZPixmap ? source->bits_per_pixel : 1;
+    int planes = source->format == XYPixmap ? source->depth : 1;
+    unsigned long srcPlaneSize = (unsigned long) source->bytes_per_line * source->height;
+    unsigned long destPlaneSize = (unsigned long) dest->bytes_per_line * dest->height;
+    int srcBit = (srcX + (source->format == ZPixmap ? 0 : source->xoffset)) * bitsPerPixel;
+    int destBit = (destX + (dest->format == ZPixmap ? 0 : dest->xoffset)) * bitsPerPixel;
+    Bool byteAligned = srcBit % 8 == 0 && destBit % 8 == 0 && (width * bitsPerPixel % 8 == 0 || dest->width == width)
+                       && (bitsPerPixel >= 8 || source->bitmap_unit <= 8 || source->byte_order == source->bitmap_bit_order);
+    if (byteAligned) {
+        size_t rowSize = ((size_t) width * bitsPerPixel + 7) / 8;
+        for (plane = 0; plane < planes; plane++) {
+            const Uint8* srcRow = IMAGE_ROW(source, srcY) + plane * srcPlaneSize + srcBit / 8;
+            Uint8* destRow = IMAGE_ROW(dest, destY) + plane * destPlaneSize + destBit / 8;
+            for (y = 0; y < height; y++, srcRow += source->bytes_per_line, destRow += dest->bytes_per_line) {
+                memcpy(destRow, srcRow, rowSize);
+            }
+        }
+        return;
+    }
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < width; x++) {
+            dest->f.put_pixel(dest, destX + x, destY + y, source->f.get_pixel(source, srcX + x, srcY + y));
+        }
+    }
+}
+
+static XImage* subImage(XImage* image, int x, int y, unsigned int width, unsigned int height) {
+    // https://tronche.com/gui/x/xlib/utilities/XSubImage.html
+    XImage* subImage = malloc(sizeof(XImage));
+    if (subImage == NULL) {
+        return NULL;
+    }
+    *subImage = *image;
+    subImage->width = (int) width;
+    subImage->height = (int) height;
+    subImage->xoffset = 0;
+    subImage->obdata = NULL;
+    unsigned long bitsPerLine = (unsigned long) width * (image->format == ZPixmap ? image->bits_per_pixel : 1);
+    unsigned long bytesPerLine = (bitsPerLine + image->bitmap_pad - 1) / image->bitmap_pad * (image->bitmap_pad / 8);
+    unsigned long planes = image->format == XYPixmap ? (unsigned long) image->depth : 1;
+    subImage->bytes_per_line = (int) bytesPerLine;
+    subImage->data = NULL;
+    if (bytesPerLine * height * planes != 0) {
+        subImage->data = calloc(bytesPerLine * height * planes, 1);
+        if (subImage->data == NULL) {
+            free(subImage);
+            return NULL;
+        }
+    }
+    _XInitImageFuncPtrs(subImage);
+    // Only the part of the area which is inside the image is copied, the rest stays zero.
+    int srcX = x > 0 ? x : 0, srcY = y > 0 ? y : 0;
+    int right = x + (int) width < image->width ? x + (int) width : image->width;
+    int bottom = y + (int) height < image->height ? y + (int) height : image->height;
+    if (image->data != NULL && subImage->data != NULL && right > srcX && bottom > srcY) {
+        copyImageArea(image, srcX, srcY, subImage, srcX - x, srcY - y, right - srcX, bottom - srcY);
+    }
+    return subImage;
+}
+
+static int addPixel(XImage* image, long value) {
+    // https://tronche.com/gui/x/xlib/utilities/XAddPixel.html
+    int x, y;
+    if (value == 0 || image->data == NULL) {
+        return 0;
+    }
+    if (image->bits_per_pixel == 1 && image->format != XYPixmap) {
+        // Adding an odd value inverts the bit, an even one leaves it unchanged.
+        if (value & 1) {
+            size_t size = (size_t) image->bytes_per_line * image->height;
+            Uint8* pointer = (Uint8*) image->data;
+            for (; size > 0; size--, pointer++) {
+                *pointer = (Uint8) ~*pointer;
+            }
+        }
+        return 0;
+    }
+    if (image->format == ZPixmap && image->bits_per_pixel == 8) {
+        for (y = 0; y < image->height; y++) {
+            Uint8* row = IMAGE_ROW(image, y);
+            for (x = 0; x < image->width; x++) {
+                row[x] = (Uint8) (row[x] + value);
+            }
+        }
+        return 0;
+    }
+    if (image->format == ZPixmap && image->byte_order == HOST_BYTE_ORDER
+        && (image->bits_per_pixel == 16 || image->bits_per_pixel == 32)) {
+        for (y = 0; y < image->height; y++) {
+            void* row = IMAGE_ROW(image, y);
+            if (image->bits_per_pixel == 16) {
+                for (x = 0; x < image->width; x++) {
+                    Uint16 pixel;
+                    memcpy(&pixel, (Uint16*) row + x, sizeof(pixel));
+                    pixel = (Uint16) (pixel + value);
+                    memcpy((Uint16*) row + x, &pixel, sizeof(pixel));
+                }
+            } else {
+                for (x = 0; x < image->width; x++) {
+                    Uint32 pixel;
+                    memcpy(&pixel, (Uint32*) row + x, sizeof(pixel));
+                    pixel = (Uint32) (pixel + value);
+                    memcpy((Uint32*) row + x, &pixel, sizeof(pixel));
+                }
+            }
+        }
+        return 0;
+    }
+    for (y = 0; y < image->height; y++) {
+        for (x = 0; x < image->width; x++) {
+            image->f.put_pixel(image, x, y, image->f.get_pixel(image, x, y) + value);
+        }
     }
     return 0;
 }
@@ -116,87 +485,672 @@ int destroyImage(XImage* image) {
     return 1;
 }
 
+/*
+ * Get the texture format which matches the pixel layout of a ZPixmap image,
+ * or SDL_PIXELFORMAT_UNKNOWN if there is none.
+ */
+Uint32 getImageTextureFormat(const XImage* image) {
+    #if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    int hostByteOrder = MSBFirst;
+    #else
+    int hostByteOrder = LSBFirst;
+    #endif
+    if (image->format != ZPixmap || image->bits_per_pixel < 16 || image->byte_order != hostByteOrder) {
+        return SDL_PIXELFORMAT_UNKNOWN;
+    }
+    Uint32 redMask = (Uint32) image->red_mask, greenMask = (Uint32) image->green_mask;
+    Uint32 blueMask = (Uint32) image->blue_mask;
+    if (redMask == 0 && greenMask == 0 && blueMask == 0) {
+        redMask = DEFAULT_RED_MASK;
+        greenMask = DEFAULT_GREEN_MASK;
+        blueMask = DEFAULT_BLUE_MASK;
+    }
+    // The unused bits of images without alpha are undefined, they must not make the pixels transparent.
+    Uint32 alphaMask = image->depth == 32 ? ~(redMask | greenMask | blueMask) : 0;
+    if (image->bits_per_pixel < 32) {
+        alphaMask &= (1u << image->bits_per_pixel) - 1;
+    }
+    return SDL_MasksToPixelFormatEnum(image->bits_per_pixel, redMask, greenMask, blueMask, alphaMask);
+}
+
+/*
+ * Get the layout of the pixels of a ZPixmap image for the pixel conversion (see pixelConversion.h).
+ * Pixel values of 32 bit images without masks are native pixel values. Returns False for images
+ * whose pixels can't be converted that way.
+ */
+Bool getImagePixelLayout(const XImage* image, PixelLayout* layout) {
+    if (image->format != ZPixmap || image->bits_per_pixel % 8 != 0 || image->bits_per_pixel > 32) {
+        return False;
+    }
+    if (image->red_mask == 0 && image->green_mask == 0 && image->blue_mask == 0) {
+        if (image->bits_per_pixel != 32) return False;
+        getNativePixelLayout(layout);
+    } else {
+        layout->redMask = (Uint32) image->red_mask;
+        layout->greenMask = (Uint32) image->green_mask;
+        layout->blueMask = (Uint32) image->blue_mask;
+    }
+    layout->bitsPerPixel = image->bits_per_pixel;
+    layout->byteOrder = image->byte_order;
+    layout->alphaMask = 0;
+    if (image->depth == 32) {
+        layout->alphaMask = ~(layout->redMask | layout->greenMask | layout->blueMask);
+        if (image->bits_per_pixel < 32) {
+            layout->alphaMask &= (1u << image->bits_per_pixel) - 1;
+        }
+    }
+    return True;
+}
+
+/*
+ * Check whether the image can be transferred from and to the drawable.
+ */
+Bool canTransferImage(Drawable drawable, const XImage* image) {
+    if (IS_BITMAP(drawable)) {
+        return image->depth == 1 && (image->format != ZPixmap || image->bits_per_pixel == 1);
+    }
+    PixelLayout layout;
+    return image->depth != 1 && (getImageTextureFormat(image) != SDL_PIXELFORMAT_UNKNOWN
+                                 || getImagePixelLayout(image, &layout));
+}
+
+/*
+ * Check whether the area is inside of the drawable and, for windows, whether the window is viewable,
+ * as required for reading it back.
+ */
+Bool isDrawableAreaReadable(Drawable drawable, const SDL_Rect* area) {
+    unsigned int width, height;
+    if (area->x < 0 || area->y < 0) return False;
+    if (IS_TYPE(drawable, PIXMAP)) {
+        width = GET_PIXMAP_STRUCT(drawable)->width;
+        height = GET_PIXMAP_STRUCT(drawable)->height;
+    } else {
+        Window window = IS_TYPE(drawable, BACK_BUFFER) ? GET_BACK_BUFFER(drawable)->window : drawable;
+        Window ancestor;
+        for (ancestor = window; ancestor != SCREEN_WINDOW; ancestor = GET_PARENT(ancestor)) {
+            if (GET_WINDOW_STRUCT(ancestor)->mapState != Mapped) return False;
+        }
+        GET_WINDOW_DIMS(window, width, height);
+    }
+    return (unsigned int) area->x + area->w <= width && (unsigned int) area->y + area->h <= height;
+}
+
+/*
+ * Set up an image with native pixel values (see colors.h) and no data. Only depth 32 images have alpha.
+ */
+static void initNativeImage(XImage* image, int width, int height, int depth) {
+    memset(image, 0, sizeof(XImage));
+    image->width = width;
+    image->height = height;
+    image->format = ZPixmap;
+    image->depth = depth == 32 ? 32 : 24;
+    image->bits_per_pixel = 32;
+    image->red_mask = DEFAULT_RED_MASK;
+    image->green_mask = DEFAULT_GREEN_MASK;
+    image->blue_mask = DEFAULT_BLUE_MASK;
+    image->bytes_per_line = width * 4;
+    image->bitmap_pad = 32;
+    #if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    image->byte_order = MSBFirst;
+    #else
+    image->byte_order = LSBFirst;
+    #endif
+}
+
+static void putConvertedImage(Display* display, Drawable drawable, GC gc, const XImage* image,
+                              const SDL_Rect* srcRect, int destX, int destY);
+
+/*
+ * Draw the source area of the image into the drawable at the destination position.
+ * The image must be transferable to the drawable (see canTransferImage) and the source area
+ * must be inside of the image.
+ */
+void putImage(Display* display, Drawable drawable, GC gc, const XImage* image, const SDL_Rect* srcRect,
+              int destX, int destY) {
+    if (IS_BITMAP(drawable)) {
+        putBitmapBits(drawable, (const Uint8*) image->data, image->bytes_per_line,
+                      image->bitmap_bit_order == MSBFirst, srcRect, destX, destY);
+        return;
+    }
+    Uint32 format = getImageTextureFormat(image);
+    if (format == SDL_PIXELFORMAT_UNKNOWN) {
+        putConvertedImage(display, drawable, gc, image, srcRect, destX, destY);
+        return;
+    }
+    const char* pixels = image->data + srcRect->y * image->bytes_per_line
+                         + srcRect->x * (image->bits_per_pixel / 8);
+    SDL_Rect uploadRect = {0, 0, srcRect->w, srcRect->h};
+    SDL_Rect destRect = {destX, destY, srcRect->w, srcRect->h};
+    SDL_Rect targetRect;
+    SDL_Texture* texture = NULL;
+    SDL_Texture* pooledTexture = NULL;
+    SDL_Renderer* textureRenderer = NULL;
+    DrawTarget target;
+    FOR_EACH_DRAW_TARGET(drawable, gc, &destRect, target) {
+        if (target.renderer == NULL) {
+            handleError(0, display, drawable, 0, BadAlloc, 0);
+            break;
+        }
+        if (target.renderer != textureRenderer) {
+            releaseTexture(textureRenderer, pooledTexture);
+            pooledTexture = NULL;
+            textureRenderer = target.renderer;
+            // Upload straight from the memory of the client, without an intermediate surface.
+            texture = getImageStreamTexture(drawable, target.renderer, format, &destRect);
+            if (texture != NULL) {
+                if (!writeImageStreamTexture(texture, pixels, image->bytes_per_line,
+                                             srcRect->w * SDL_BYTESPERPIXEL(format), srcRect->h)) {
+                    handleError(0, display, drawable, 0, BadAlloc, 0);
+                    break;
+                }
+            } else if ((texture = pooledTexture = acquireTexture(target.renderer, format, SDL_TEXTUREACCESS_STREAMING,
+                                                                 srcRect->w, srcRect->h)) == NULL
+                       || SDL_UpdateTexture(texture, &uploadRect, pixels, image->bytes_per_line) != 0) {
+                LOG("Failed to upload the image in %s: %s\n", __func__, SDL_GetError());
+                handleError(0, display, drawable, 0, BadAlloc, 0);
+                break;
+            }
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        }
+        targetRect = destRect;
+        targetRect.x -= target.offsetX;
+        targetRect.y -= target.offsetY;
+        if (SDL_RenderCopy(target.renderer, texture, &uploadRect, &targetRect) != 0) {
+            LOG("SDL_RenderCopy failed in %s: %s\n", __func__, SDL_GetError());
+            handleError(0, display, drawable, 0, BadMatch, 0);
+            break;
+        }
+    }
+    releaseTexture(textureRenderer, pooledTexture);
+}
+
+/*
+ * Draw the source area of an image without a matching texture format,
+ * by converting its pixels into native pixel values first.
+ */
+static void putConvertedImage(Display* display, Drawable drawable, GC gc, const XImage* image,
+                              const SDL_Rect* srcRect, int destX, int destY) {
+    PixelLayout imageLayout, nativeLayout;
+    PixelConversion conversion;
+    getNativePixelLayout(&nativeLayout);
+    if (!getImagePixelLayout(image, &imageLayout) || !initPixelConversion(&conversion, &imageLayout, &nativeLayout)) {
+        LOG("Got an image with an unsupported pixel layout in %s\n", __func__);
+        handleError(0, display, drawable, 0, BadMatch, 0);
+        return;
+    }
+    XImage nativeImage;
+    SDL_Rect nativeRect = {0, 0, srcRect->w, srcRect->h};
+    initNativeImage(&nativeImage, srcRect->w, srcRect->h, image->depth);
+    nativeImage.data = malloc((size_t) nativeImage.bytes_per_line * srcRect->h);
+    if (nativeImage.data == NULL) {
+        handleOutOfMemory(0, display, 0, 0);
+        return;
+    }
+    convertPixels(&conversion, image->data + srcRect->y * image->bytes_per_line
+                               + srcRect->x * (image->bits_per_pixel / 8), image->bytes_per_line,
+                  nativeImage.data, nativeImage.bytes_per_line, srcRect->w, srcRect->h);
+    putImage(display, drawable, gc, &nativeImage, &nativeRect, destX, destY);
+    free(nativeImage.data);
+}
+
+/*
+ * Read the area of the drawable into the image, starting at the origin of the image.
+ * The image must be transferable from the drawable (see canTransferImage) and large enough,
+ * the area must be inside of the drawable. Returns False if the drawable could not be read.
+ */
+Bool getImage(Drawable drawable, const SDL_Rect* area, XImage* image, unsigned long planeMask) {
+    if (IS_BITMAP(drawable)) {
+        getBitmapBits(drawable, area, (Uint8*) image->data, image->bytes_per_line,
+                      image->bitmap_bit_order == MSBFirst);
+        return True;
+    }
+    SDL_Surface* surface = getDrawableSurfaceArea(drawable, area, SDL_PIXELFORMAT_UNKNOWN);
+    if (surface == NULL) return False;
+    PixelLayout imageLayout, nativeLayout;
+    PixelConversion conversion;
+    getNativePixelLayout(&nativeLayout);
+    if (!getImagePixelLayout(image, &imageLayout) || !initPixelConversion(&conversion, &nativeLayout, &imageLayout)) {
+        LOG("Got an image with an unsupported pixel layout in %s\n", __func__);
+        SDL_FreeSurface(surface);
+        return False;
+    }
+    int result = 0;
+    if (surface->w != area->w || surface->h != area->h) {
+        // Scale the device pixels to logical pixels first.
+        SDL_Surface* scaledSurface = SDL_CreateRGBSurface(0, area->w, area->h, SDL_SURFACE_DEPTH,
+                                                          DEFAULT_RED_MASK, DEFAULT_GREEN_MASK,
+                                                          DEFAULT_BLUE_MASK, DEFAULT_ALPHA_MASK);
+        if (scaledSurface != NULL) {
+            SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+            result = SDL_BlitScaled(surface, NULL, scaledSurface, NULL);
+        }
+        if (scaledSurface == NULL || result != 0) {
+            LOG("Failed to scale the read pixels in %s: %s\n", __func__, SDL_GetError());
+            SDL_FreeSurface(scaledSurface);
+            SDL_FreeSurface(surface);
+            return False;
+        }
+        SDL_FreeSurface(surface);
+        surface = scaledSurface;
+    }
+    // Convert straight into the memory of the client.
+    convertPixels(&conversion, surface->pixels, surface->pitch, image->data, image->bytes_per_line,
+                  area->w, area->h);
+    SDL_FreeSurface(surface);
+    if ((planeMask & AllPlanes) != AllPlanes) {
+        // The pixels are stored in the byte order of the image, so is the mask for them.
+        Uint32 mask32 = image->byte_order == nativeLayout.byteOrder ? (Uint32) planeMask
+                                                                    : SDL_Swap32((Uint32) planeMask);
+        Uint16 mask16 = image->byte_order == nativeLayout.byteOrder ? (Uint16) planeMask
+                                                                    : SDL_Swap16((Uint16) planeMask);
+        int x, y;
+        for (y = 0; y < area->h; y++) {
+            char* row = image->data + y * image->bytes_per_line;
+            for (x = 0; x < area->w; x++) {
+                if (image->bits_per_pixel == 32) {
+                    ((Uint32*) row)[x] &= mask32;
+                } else if (image->bits_per_pixel == 16) {
+                    ((Uint16*) row)[x] &= mask16;
+                } else if (image->bits_per_pixel == 8) {
+                    ((Uint8*) row)[x] &= (Uint8) planeMask;
+                }
+            }
+        }
+    }
+    return True;
+}
+
+typedef struct {
+    /* The mask, position and number of bits of a color channel in the pixel values of an image. */
+    unsigned long mask;
+    int shift;
+    int width;
+} ImageChannel;
+
+typedef struct {
+    /* The uploaded image, its data are the pixels below. */
+    XImage image;
+    SDL_Rect srcRect;
+    int destX, destY;
+    Uint32 pixels[];
+} PutImageArgs;
+
+static void initImageChannel(ImageChannel* channel, unsigned long mask) {
+    channel->mask = mask;
+    channel->shift = 0;
+    channel->width = 0;
+    while (mask != 0 && (mask & 1) == 0) {
+        mask >>= 1;
+        channel->shift++;
+    }
+    while ((mask & 1) != 0) {
+        mask >>= 1;
+        channel->width++;
+    }
+}
+
+/*
+ * Get the 8 bit value of the channel in the pixel value.
+ */
+static Uint8 getChannelValue(const ImageChannel* channel, unsigned long pixel, Uint8 defaultValue) {
+    if (channel->width == 0) return defaultValue;
+    unsigned long value = (pixel & channel->mask) >> channel->shift;
+    if (channel->width >= 8) {
+        return (Uint8) (value >> (channel->width - 8));
+    }
+    return (Uint8) (value * 0xFF / ((1ul << channel->width) - 1));
+}
+
+/*
+ * Convert the source area of the image into native pixel values (see colors.h) in the pixels,
+ * which have the given number of pixels per row. The pixel values of images with color masks
+ * are converted with them, the values of images without masks already are native pixel values.
+ * The bits of XYBitmap images select the foreground or background of the graphic context.
+ */
+static void convertImageToNative(const XImage* image, const SDL_Rect* srcRect, GC gc, Uint32* pixels,
+                                 int pixelsPerRow) {
+    ImageChannel red, green, blue, alpha;
+    Bool hasMasks = image->red_mask != 0 || image->green_mask != 0 || image->blue_mask != 0;
+    GetPixelFunction getPixel;
+    PutPixelFunction putPixel;
+    int x, y;
+    getPixelFunctions(image, &getPixel, &putPixel);
+    initImageChannel(&red, image->red_mask);
+    initImageChannel(&green, image->green_mask);
+    initImageChannel(&blue, image->blue_mask);
+    initImageChannel(&alpha, image->depth == 32 ?
+                             ~(image->red_mask | image->green_mask | image->blue_mask) & 0xFFFFFFFF : 0);
+    for (y = 0; y < srcRect->h; y++) {
+        Uint32* destRow = pixels + y * pixelsPerRow;
+        for (x = 0; x < srcRect->w; x++) {
+            unsigned long pixel = getPixel((XImage*) image, srcRect->x + x, srcRect->y + y);
+            if (image->format == XYBitmap) {
+                destRow[x] = (Uint32) (pixel ? GET_GC(gc)->foreground : GET_GC(gc)->background);
+            } else {
+                destRow[x] = hasMasks ? (Uint32) colorToPixel(getChannelValue(&red, pixel, 0),
+                                                              getChannelValue(&green, pixel, 0),
+                                                              getChannelValue(&blue, pixel, 0),
+                                                              getChannelValue(&alpha, pixel, 0xFF))
+                                      : (Uint32) pixel;
+            }
+        }
+    }
+}
+
+/*
+ * Convert the source area of a depth 1 image into packed bits with the most significant bit first,
+ * with the given number of bytes per row. The bits of XYBitmap images are mapped to the lowest bit
+ * of the foreground or background of the graphic context.
+ */
+static void convertImageToBits(const XImage* image, const SDL_Rect* srcRect, GC gc, Uint8* bits,
+                               int bytesPerRow) {
+    int x, y;
+    int setBit = image->format == XYBitmap ? (int) (GET_GC(gc)->foreground & 1) : 1;
+    int clearBit = image->format == XYBitmap ? (int) (GET_GC(gc)->background & 1) : 0;
+    memset(bits, 0, (size_t) bytesPerRow * srcRect->h);
+    for (y = 0; y < srcRect->h; y++) {
+        const Uint8* row = (const Uint8*) image->data + (srcRect->y + y) * image->bytes_per_line;
+        Uint8* destRow = bits + y * bytesPerRow;
+        for (x = 0; x < srcRect->w; x++) {
+            if (getImageBit(image, row, srcRect->x + x) ? setBit : clearBit) {
+                destRow[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+    }
+}
+
+/*
+ * Check whether the pixels of the image can be uploaded to the drawable unchanged.
+ * If so, the upload image is set to the image with a pixel layout that putImage understands.
+ */
+static Bool getDirectUploadImage(const XImage* image, Drawable drawable, GC gc, XImage* uploadImage) {
+    *uploadImage = *image;
+    if (IS_BITMAP(drawable)) {
+        if (image->format == XYBitmap && ((GET_GC(gc)->foreground & 1) != 1 || (GET_GC(gc)->background & 1) != 0)) {
+            return False;
+        }
+        // Bytes are only independent of the byte order for bitmap units of one byte.
+        return image->bitmap_unit <= 8 || image->byte_order == image->bitmap_bit_order;
+    }
+    #if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    int hostByteOrder = MSBFirst;
+    #else
+    int hostByteOrder = LSBFirst;
+    #endif
+    if (image->format != ZPixmap || image->xoffset != 0) return False;
+    if (image->byte_order != hostByteOrder && (image->red_mask != 0 || image->green_mask != 0
+                                               || image->blue_mask != 0)) {
+        // A different byte order of 24 and 32 bit pixels only moves the channels.
+        if (image->bits_per_pixel == 32) {
+            uploadImage->red_mask = SDL_Swap32((Uint32) image->red_mask);
+            uploadImage->green_mask = SDL_Swap32((Uint32) image->green_mask);
+            uploadImage->blue_mask = SDL_Swap32((Uint32) image->blue_mask);
+        } else if (image->bits_per_pixel == 24) {
+            uploadImage->red_mask = SDL_Swap32((Uint32) image->red_mask) >> 8;
+            uploadImage->green_mask = SDL_Swap32((Uint32) image->green_mask) >> 8;
+            uploadImage->blue_mask = SDL_Swap32((Uint32) image->blue_mask) >> 8;
+        } else {
+            return False;
+        }
+        uploadImage->byte_order = hostByteOrder;
+    } else if (image->byte_order != hostByteOrder && image->bits_per_pixel != 8) {
+        return False;
+    }
+    return getImageTextureFormat(uploadImage) != SDL_PIXELFORMAT_UNKNOWN;
+}
+
+/*
+ * Set up the image which holds the converted source area of the image, see convertPixels,
+ * convertImageToNative and convertImageToBits. Returns the size of its data.
+ */
+static size_t initConvertedImage(const XImage* image, Drawable drawable, int width, int height,
+                                 XImage* convertedImage) {
+    if (!IS_BITMAP(drawable)) {
+        initNativeImage(convertedImage, width, height, image->depth);
+        return (size_t) convertedImage->bytes_per_line * height;
+    }
+    memset(convertedImage, 0, sizeof(XImage));
+    convertedImage->width = width;
+    convertedImage->height = height;
+    convertedImage->format = XYBitmap;
+    convertedImage->depth = 1;
+    convertedImage->bits_per_pixel = 1;
+    convertedImage->bitmap_unit = 8;
+    convertedImage->bitmap_bit_order = MSBFirst;
+    convertedImage->bytes_per_line = (width + 7) / 8;
+    return (size_t) convertedImage->bytes_per_line * height;
+}
+
+static void putDeferredImage(Display* display, Drawable d, GC gc, void* args) {
+    PutImageArgs* put = args;
+    put->image.data = (char*) put->pixels;
+    putImage(display, d, gc, &put->image, &put->srcRect, put->destX, put->destY);
+}
+
 int XPutImage(Display* display, Drawable drawable, GC gc, XImage* image, int src_x, int src_y,
                int dest_x, int dest_y, unsigned int width, unsigned int height) {
     // https://tronche.com/gui/x/xlib/graphics/XPutImage.html
     SET_X_SERVER_REQUEST(display, X_PutImage);
     TYPE_CHECK(drawable, DRAWABLE, display, 0);
     LOG("%s: Drawing %p on %lu\n", __func__, image, drawable);
-    // TODO: Implement this: Create Uint32* data, Create Texture from data, rendercopy
-//    LOCK_SURFACE(surface);
-//    unsigned int x, y;
-//    if (image->format == XYBitmap && 0) {
-//        for (x = 0; x < width; x++) {
-//            for (y = 0; y < height; y++) {
-//                unsigned long color = gc->background;
-//                if (XGetPixel(image, src_x + x, src_y + y)) {
-//                    color = gc->foreground;
-//                }
-//                putPixel(surface, dest_x + x, dest_y + y, color);
-//            }
-//        }
-//    } else {
-//        for (x = 0; x < width; x++) {
-//            for (y = 0; y < height; y++) {
-//                unsigned long color = XGetPixel(image, src_x + x, src_y + y);
-////                LOG("%s: %lu (%ld, %ld, %ld)\n", __func__, color, (color >> 24) & 0xFF, (color >> 16) & 0xFF, (color >> 8) & 0xFF);
-//                putPixel(surface, dest_x + x, dest_y + y, XGetPixel(image, src_x + x, src_y + y));
-//            }
-//        }
-//    }
-//    UNLOCK_SURFACE(surface);
+    if (IS_BITMAP(drawable) ? image->depth != 1 : image->depth == 1 && image->format != XYBitmap) {
+        LOG("BadMatch: Got an image with depth %d for drawable %lu in %s\n", image->depth, drawable, __func__);
+        handleError(0, display, drawable, 0, BadMatch, 0);
+        return 0;
+    }
+    // Like Xlib, only draw the part of the source area that is inside of the image.
+    SDL_Rect imageRect = {0, 0, image->width, image->height};
+    SDL_Rect srcRect = {src_x, src_y, (int) width, (int) height};
+    if (!SDL_IntersectRect(&srcRect, &imageRect, &srcRect)) return 1;
+    dest_x += srcRect.x - src_x;
+    dest_y += srcRect.y - src_y;
+    XImage uploadImage;
+    PutImageArgs* args;
+    if (getDirectUploadImage(image, drawable, gc, &uploadImage)) {
+        // Only bitmaps accept images with an offset, see getDirectUploadImage.
+        srcRect.x += uploadImage.xoffset;
+        uploadImage.xoffset = 0;
+        Bool isZPixmap = uploadImage.format == ZPixmap && uploadImage.bits_per_pixel >= 8;
+        size_t bytesPerRow = isZPixmap ? (size_t) srcRect.w * (uploadImage.bits_per_pixel / 8)
+                                       : (size_t) (srcRect.x % 8 + srcRect.w + 7) / 8;
+        args = beginDeferredDraw(display, drawable, gc, putDeferredImage,
+                                 offsetof(PutImageArgs, pixels) + bytesPerRow * srcRect.h);
+        if (args == NULL) {
+            // Upload straight from the memory of the client.
+            putImage(display, drawable, gc, &uploadImage, &srcRect, dest_x, dest_y);
+            return 1;
+        }
+        // The client may reuse the image as soon as we return, copy the rows of the source area.
+        const char* source = image->data + srcRect.y * image->bytes_per_line
+                             + (isZPixmap ? srcRect.x * (uploadImage.bits_per_pixel / 8) : srcRect.x / 8);
+        int y;
+        for (y = 0; y < srcRect.h; y++) {
+            memcpy((char*) args->pixels + y * bytesPerRow, source + y * image->bytes_per_line, bytesPerRow);
+        }
+        srcRect.x = isZPixmap ? 0 : srcRect.x % 8;
+        srcRect.y = 0;
+        uploadImage.width = srcRect.x + srcRect.w;
+        uploadImage.height = srcRect.h;
+        uploadImage.bytes_per_line = (int) bytesPerRow;
+    } else {
+        size_t dataSize = initConvertedImage(image, drawable, srcRect.w, srcRect.h, &uploadImage);
+        args = beginDeferredDraw(display, drawable, gc, putDeferredImage, offsetof(PutImageArgs, pixels) + dataSize);
+        char* data = args != NULL ? (char*) args->pixels : malloc(dataSize);
+        if (data == NULL) {
+            handleOutOfMemory(0, display, 0, 0);
+            return 0;
+        }
+        PixelLayout imageLayout, nativeLayout;
+        PixelConversion conversion;
+        getNativePixelLayout(&nativeLayout);
+        if (uploadImage.format == ZPixmap && getImagePixelLayout(image, &imageLayout)
+            && initPixelConversion(&conversion, &imageLayout, &nativeLayout)) {
+            convertPixels(&conversion, image->data + srcRect.y * image->bytes_per_line
+                                       + srcRect.x * (image->bits_per_pixel / 8), image->bytes_per_line,
+                          data, uploadImage.bytes_per_line, srcRect.w, srcRect.h);
+        } else if (uploadImage.format == ZPixmap) {
+            convertImageToNative(image, &srcRect, gc, (Uint32*) data, srcRect.w);
+        } else {
+            convertImageToBits(image, &srcRect, gc, (Uint8*) data, uploadImage.bytes_per_line);
+        }
+        srcRect.x = srcRect.y = 0;
+        if (args == NULL) {
+            uploadImage.data = data;
+            putImage(display, drawable, gc, &uploadImage, &srcRect, dest_x, dest_y);
+            free(data);
+            return 1;
+        }
+    }
+    args->image = uploadImage;
+    args->srcRect = srcRect;
+    args->destX = dest_x;
+    args->destY = dest_y;
+    submitDeferredDraw(args);
     return 1;
 }
 
-XImage* XGetImage(Display* display, Drawable drawable, int x, int y, unsigned int width,
-                  unsigned int height, unsigned long plane_mask, int format) {
-    // https://tronche.com/gui/x/xlib/graphics/XGetImage.html
-    SET_X_SERVER_REQUEST(display, X_GetImage);
-    LOG("%s: From %lu\n", __func__, drawable);
-    if (IS_TYPE(drawable, WINDOW) && drawable == SCREEN_WINDOW) {
-        LOG("XGetImage called with SCREEN_WINDOW as argument!\n");
-        // TODO: Handle error and check INPUTONLY
+/*
+ * Split the native pixel values into the planes of the XYPixmap image, the most significant plane first.
+ * Planes which are not in the plane mask stay zero.
+ */
+static void splitIntoPlanes(const XImage* pixels, XImage* image, unsigned long planeMask) {
+    unsigned long planeSize = (unsigned long) image->bytes_per_line * image->height;
+    int x, y, plane;
+    for (plane = 0; plane < image->depth; plane++) {
+        int bit = image->depth - 1 - plane;
+        if (bit >= 32 || (planeMask & (1ul << bit)) == 0) continue;
+        for (y = 0; y < image->height; y++) {
+            const Uint32* row = (const Uint32*) (pixels->data + y * pixels->bytes_per_line);
+            Uint8* planeRow = (Uint8*) image->data + plane * planeSize + y * image->bytes_per_line;
+            for (x = 0; x < image->width; x++) {
+                if ((row[x] >> bit) & 1) {
+                    planeRow[x / 8] |= image->bitmap_bit_order == MSBFirst ? 0x80 >> (x % 8) : 1 << (x % 8);
+                }
+            }
+        }
+    }
+}
+
+static void readImageNow(void* data) {
+    ImageRead* read = data;
+    XImage* image = read->image;
+    if (IS_BITMAP(read->drawable)) {
+        // Both formats of depth 1 images store the single plane as packed bits.
+        if ((read->planeMask & 1) != 0) {
+            read->failed = !getImage(read->drawable, &read->area, image, AllPlanes);
+        }
+    } else if (image->format == XYPixmap) {
+        XImage pixels;
+        initNativeImage(&pixels, read->area.w, read->area.h, 32);
+        pixels.data = malloc((size_t) pixels.bytes_per_line * pixels.height);
+        read->failed = pixels.data == NULL || !getImage(read->drawable, &read->area, &pixels, AllPlanes);
+        if (!read->failed) {
+            splitIntoPlanes(&pixels, image, read->planeMask);
+        }
+        free(pixels.data);
+    } else {
+        read->failed = !getImage(read->drawable, &read->area, image, read->planeMask);
+    }
+}
+
+/*
+ * Start reading the area of the drawable into a new image, after all queued drawing requests.
+ * Windows are read with the content of their inferiors, like the real window shows it.
+ * The read is finished by finishImageRead, which waits for it if isImageReadDone is not True yet,
+ * so clients can overlap the readback with their drawing. Returns NULL on error.
+ */
+ImageRead* startImageRead(Display* display, Drawable drawable, int x, int y, unsigned int width,
+                          unsigned int height, unsigned long planeMask, int format) {
+    TYPE_CHECK(drawable, DRAWABLE, display, NULL);
+    if (format != XYPixmap && format != ZPixmap) {
+        LOG("BadValue: Got invalid image format %d in %s\n", format, __func__);
+        handleError(0, display, None, 0, BadValue, 0);
+        return NULL;
+    }
+    SDL_Rect area = {x, y, (int) width, (int) height};
+    if (width == 0 || height == 0 || !isDrawableAreaReadable(drawable, &area)) {
+        LOG("BadMatch: Can't read {x = %d, y = %d, w = %u, h = %u} from drawable %lu in %s\n",
+            x, y, width, height, drawable, __func__);
+        handleError(0, display, drawable, 0, BadMatch, 0);
         return NULL;
     }
-    // TODO: Figure this out
-    int depth = 8;
-//    if (drawable->type == PIXMAP) {
-//
-//    }
-    int bytes_per_line = (depth / 8) * width;
-    char* data = malloc(sizeof(char) * width * height);
-    if (data == NULL) {
+    int depth;
+    Visual* visual;
+    if (IS_TYPE(drawable, PIXMAP)) {
+        depth = (int) GET_PIXMAP_STRUCT(drawable)->depth;
+        visual = depth == 1 ? NULL : getDefaultVisual(0);
+    } else {
+        // Like XGetWindowAttributes reports it.
+        Window window = IS_TYPE(drawable, BACK_BUFFER) ? GET_BACK_BUFFER(drawable)->window : drawable;
+        depth = SDL_SURFACE_DEPTH;
+        visual = GET_VISUAL(window) != NULL ? GET_VISUAL(window) : getDefaultVisual(0);
+    }
+    ImageRead* read = malloc(sizeof(ImageRead));
+    XImage* image = XCreateImage(display, visual, (unsigned int) depth, format, 0, NULL, width, height, 32, 0);
+    if (read == NULL || image == NULL) {
+        free(read);
+        if (image != NULL) XDestroyImage(image);
         handleOutOfMemory(0, display, 0, 0);
         return NULL;
     }
-    // FIXME: The NULL will cause problems.
-    XImage* image = XCreateImage(display, NULL, depth, format, 0, data, width, height,
-                                 (int) NULL, bytes_per_line);
-    if (image == NULL) {
-        free(data);
+    size_t dataSize = (size_t) image->bytes_per_line * height * (image->format == XYPixmap ? depth : 1);
+    image->data = calloc(1, dataSize);
+    if (image->data == NULL) {
+        free(read);
+        XDestroyImage(image);
+        handleOutOfMemory(0, display, 0, 0);
         return NULL;
     }
-    //TODO: Implement: Read from Textur into data and Convert from data to image type
-//    SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_RGBA8888, GET_SURFACE(drawable)->pixels, GET_SURFACE(drawable)->pitch);
-
-//    unsigned int currX, currY;
-//    // TODO: Worry about XYPixmap
-////    if (format == XYPixmap) {
-//    for (currX = 0; currX < width; currX++) {
-//        for (currY = 0; currY < height; currY++) {
-//            data[currY * width + currX] = plane_mask & getPixel(drawableSurface, x + currX, y + currY);
-//        }
-//    }
+    read->display = display;
+    read->drawable = drawable;
+    read->area = area;
+    read->planeMask = planeMask;
+    read->image = image;
+    read->failed = False;
+    enqueueRenderCommand(readImageNow, read);
+    read->fence = insertRenderFence();
+    return read;
+}
+
+/*
+ * Check whether the read started by startImageRead is done, so finishImageRead will not block.
+ */
+Bool isImageReadDone(const ImageRead* read) {
+    return isRenderFenceCompleted(read->fence);
+}
+
+/*
+ * Wait for the read started by startImageRead and return its image, or NULL on error.
+ * The read is freed.
+ */
+XImage* finishImageRead(ImageRead* read) {
+    waitForRenderFence(read->fence);
+    XImage* image = read->image;
+    if (read->failed) {
+        LOG("BadMatch: Failed to read from drawable %lu in %s\n", read->drawable, __func__);
+        handleError(0, read->display, read->drawable, 0, BadMatch, 0);
+        XDestroyImage(image);
+        image = NULL;
+    }
+    free(read);
     return image;
 }
 
+XImage* XGetImage(Display* display, Drawable drawable, int x, int y, unsigned int width,
+                  unsigned int height, unsigned long plane_mask, int format) {
+    // https://tronche.com/gui/x/xlib/graphics/XGetImage.html
+    SET_X_SERVER_REQUEST(display, X_GetImage);
+    LOG("%s: From %lu\n", __func__, drawable);
+    ImageRead* read = startImageRead(display, drawable, x, y, width, height, plane_mask, format);
+    return read != NULL ? finishImageRead(read) : NULL;
+}
+
 Status _XInitImageFuncPtrs(XImage *image) {
-    image->f.put_pixel = putPixel;
-    image->f.get_pixel = getPixel;
+    getPixelFunctions(image, &image->f.get_pixel, &image->f.put_pixel);
     image->f.create_image = XCreateImage;
     image->f.destroy_image = destroyImage;
-    image->f.add_pixel = NULL; // TODO
-    image->f.sub_image = NULL; // TODO
+    image->f.add_pixel = addPixel;
+    image->f.sub_image = subImage;
     return 1;
 }
 
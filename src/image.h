@@ -0,0 +1,42 @@
+#ifndef _IMAGE_H_
+#define _IMAGE_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+#include "pixelConversion.h"
+
+/*
+ * Transfers between client images and drawables. Images are uploaded straight from the memory
+ * of the client into streaming textures, and read back directly into the memory of the client.
+ * ZPixmap images need 8, 16, 24 or 32 bits per pixel, their pixel values are interpreted with the
+ * masks of the image (or the native masks, if a 32 bit image has none); only depth 32 images have alpha.
+ * Pixels that have no matching texture format are converted (see pixelConversion.h).
+ * Depth 1 images can only be transferred from and to bitmaps.
+ */
+
+typedef struct {
+    Display* display;
+    Drawable drawable;
+    SDL_Rect area;
+    unsigned long planeMask;
+    /* The image which receives the pixels. */
+    XImage* image;
+    /* Whether reading the pixels failed. Only valid once the fence was passed. */
+    Bool failed;
+    Uint32 fence;
+} ImageRead;
+
+Status _XInitImageFuncPtrs(XImage* image);
+Uint32 getImageTextureFormat(const XImage* image);
+Bool getImagePixelLayout(const XImage* image, PixelLayout* layout);
+Bool canTransferImage(Drawable drawable, const XImage* image);
+Bool isDrawableAreaReadable(Drawable drawable, const SDL_Rect* area);
+void putImage(Display* display, Drawable drawable, GC gc, const XImage* image, const SDL_Rect* srcRect,
+              int destX, int destY);
+Bool getImage(Drawable drawable, const SDL_Rect* area, XImage* image, unsigned long planeMask);
+ImageRead* startImageRead(Display* display, Drawable drawable, int x, int y, unsigned int width,
+                          unsigned int height, unsigned long planeMask, int format);
+Bool isImageReadDone(const ImageRead* read);
+XImage* finishImageRead(ImageRead* read);
+
+#endif /* _IMAGE_H_ */
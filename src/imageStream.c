@@ -0,0 +1,131 @@
+#include <string.h>
+#include "imageStream.h"
+#include "util.h"
+
+typedef struct {
+    Drawable drawable;
+    SDL_Renderer* renderer;
+    Uint32 format;
+    /* The area of the drawable which receives the uploads. */
+    SDL_Rect area;
+    unsigned int uploads;
+    Uint32 lastUploadTicks;
+    /* The textures of the stream, NULL until the area is streamed. */
+    SDL_Texture* textures[2];
+    int nextTexture;
+} ImageStream;
+
+static ImageStream streams[IMAGE_STREAM_MAX_STREAMS];
+static size_t numStreams = 0;
+
+static void removeImageStream(size_t index) {
+    int i;
+    for (i = 0; i < 2; i++) {
+        if (streams[index].textures[i] != NULL) {
+            SDL_DestroyTexture(streams[index].textures[i]);
+        }
+    }
+    streams[index] = streams[--numStreams];
+}
+
+/*
+ * Get the texture to which the next upload of an image of the format to the area of the drawable
+ * should be written, or NULL if the area is not (yet) streamed and the upload should use a pooled texture.
+ */
+SDL_Texture* getImageStreamTexture(Drawable drawable, SDL_Renderer* renderer, Uint32 format,
+                                   const SDL_Rect* area) {
+    ImageStream* stream = NULL;
+    size_t i;
+    int textureIndex;
+    releaseIdleImageStreams();
+    for (i = 0; i < numStreams; i++) {
+        if (streams[i].drawable == drawable && streams[i].renderer == renderer && streams[i].format == format
+            && SDL_RectEquals(&streams[i].area, area)) {
+            stream = &streams[i];
+            break;
+        }
+    }
+    if (stream == NULL) {
+        // Start tracking the area, in place of the least recently used one if necessary.
+        if (numStreams == IMAGE_STREAM_MAX_STREAMS) {
+            size_t oldest = 0;
+            for (i = 1; i < numStreams; i++) {
+                if (SDL_TICKS_PASSED(streams[oldest].lastUploadTicks, streams[i].lastUploadTicks)) {
+                    oldest = i;
+                }
+            }
+            removeImageStream(oldest);
+        }
+        stream = &streams[numStreams++];
+        memset(stream, 0, sizeof(ImageStream));
+        stream->drawable = drawable;
+        stream->renderer = renderer;
+        stream->format = format;
+        stream->area = *area;
+    }
+    stream->lastUploadTicks = SDL_GetTicks();
+    if (stream->uploads < IMAGE_STREAM_MIN_UPLOADS) {
+        stream->uploads++;
+    }
+    if (stream->uploads < IMAGE_STREAM_MIN_UPLOADS) {
+        return NULL;
+    }
+    textureIndex = stream->nextTexture;
+    if (stream->textures[textureIndex] == NULL) {
+        stream->textures[textureIndex] = SDL_CreateTexture(renderer, format, SDL_TEXTUREACCESS_STREAMING,
+                                                           area->w, area->h);
+        if (stream->textures[textureIndex] == NULL) {
+            LOG("SDL_CreateTexture failed in %s: %s\n", __func__, SDL_GetError());
+            return NULL;
+        }
+        SDL_SetTextureBlendMode(stream->textures[textureIndex], SDL_BLENDMODE_NONE);
+    }
+    stream->nextTexture = 1 - textureIndex;
+    return stream->textures[textureIndex];
+}
+
+/*
+ * Write the rows of pixels into the whole texture of a stream.
+ */
+Bool writeImageStreamTexture(SDL_Texture* texture, const char* pixels, int pitch, int bytesPerRow, int rows) {
+    void* texturePixels;
+    int texturePitch, y;
+    if (SDL_LockTexture(texture, NULL, &texturePixels, &texturePitch) != 0) {
+        LOG("SDL_LockTexture failed in %s: %s\n", __func__, SDL_GetError());
+        return False;
+    }
+    if (pitch == texturePitch && pitch == bytesPerRow) {
+        memcpy(texturePixels, pixels, (size_t) bytesPerRow * rows);
+    } else {
+        for (y = 0; y < rows; y++) {
+            memcpy((char*) texturePixels + y * texturePitch, pixels + y * pitch, (size_t) bytesPerRow);
+        }
+    }
+    SDL_UnlockTexture(texture);
+    return True;
+}
+
+/*
+ * Release the streams which were not used for the idle timeout.
+ */
+void releaseIdleImageStreams() {
+    Uint32 now = SDL_GetTicks();
+    size_t i;
+    for (i = numStreams; i-- > 0;) {
+        if (SDL_TICKS_PASSED(now, streams[i].lastUploadTicks + IMAGE_STREAM_IDLE_TIMEOUT)) {
+            removeImageStream(i);
+        }
+    }
+}
+
+/*
+ * Release all streams of the renderer. Must be called before the renderer is destroyed.
+ */
+void freeImageStreams(SDL_Renderer* renderer) {
+    size_t i;
+    for (i = numStreams; i-- > 0;) {
+        if (streams[i].renderer == renderer) {
+            removeImageStream(i);
+        }
+    }
+}
@@ -0,0 +1,30 @@
+#ifndef _IMAGE_STREAM_H_
+#define _IMAGE_STREAM_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+
+/*
+ * Streams for clients which upload an image of the same size to the same area of a drawable again
+ * and again, like animations and live plots. Once an area received IMAGE_STREAM_MIN_UPLOADS uploads
+ * in a row, it gets two persistent streaming textures of its size, which are written alternately
+ * with SDL_LockTexture. An upload then neither allocates a texture nor overwrites the texture
+ * of the previous frame while the renderer may still use it.
+ * Streams which were not used for IMAGE_STREAM_IDLE_TIMEOUT milliseconds are released.
+ * Like the texture pool, streams must only be used on the thread that renders (see renderThread.h).
+ */
+
+/* The number of uploads to the same area after which the area is streamed. */
+#define IMAGE_STREAM_MIN_UPLOADS 3
+/* The time in milliseconds after which an unused stream is released. */
+#define IMAGE_STREAM_IDLE_TIMEOUT 2000
+/* The maximum number of areas which are tracked or streamed at once. */
+#define IMAGE_STREAM_MAX_STREAMS 16
+
+SDL_Texture* getImageStreamTexture(Drawable drawable, SDL_Renderer* renderer, Uint32 format,
+                                   const SDL_Rect* area);
+Bool writeImageStreamTexture(SDL_Texture* texture, const char* pixels, int pitch, int bytesPerRow, int rows);
+void releaseIdleImageStreams(void);
+void freeImageStreams(SDL_Renderer* renderer);
+
+#endif /* _IMAGE_STREAM_H_ */
@@ -60,7 +60,9 @@
 #define _NET_WM_USER_TIME ((Atom) 124)
 #define _NET_WM_USER_TIME_WINDOW ((Atom) 125)
 #define _NET_FRAME_EXTENTS ((Atom) 126)
+#define _NET_WM_SYNC_REQUEST ((Atom) 127)
+#define _NET_WM_SYNC_REQUEST_COUNTER ((Atom) 128)
 
-#define _NET_LAST_PREDEFINED ((Atom) 126)
+#define _NET_LAST_PREDEFINED ((Atom) 128)
 
 #endif /* _NET_ATOMS_H_ */
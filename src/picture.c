@@ -0,0 +1,985 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <X11/extensions/Xrender.h>
+#include "picture.h"
+#include "extensions.h"
+#include "window.h"
+#include "drawing.h"
+#include "pixmap.h"
+#include "bitmap.h"
+#include "display.h"
+#include "errors.h"
+#include "renderThread.h"
+#include "texturePool.h"
+#include "util.h"
+
+#define HAS_ALPHA(format) ((format)->direct.alphaMask != 0)
+
+static XRenderPictFormat pictFormats[PictStandardNUM] = {
+    {PictStandardARGB32 + 1, PictTypeDirect, 32, {16, 0xFF, 8, 0xFF, 0, 0xFF, 24, 0xFF}, None},
+    {PictStandardRGB24 + 1, PictTypeDirect, 24, {16, 0xFF, 8, 0xFF, 0, 0xFF, 0, 0x00}, None},
+    {PictStandardA8 + 1, PictTypeDirect, 8, {0, 0x00, 0, 0x00, 0, 0x00, 0, 0xFF}, None},
+    {PictStandardA4 + 1, PictTypeDirect, 4, {0, 0x00, 0, 0x00, 0, 0x00, 0, 0x0F}, None},
+    {PictStandardA1 + 1, PictTypeDirect, 1, {0, 0x00, 0, 0x00, 0, 0x00, 0, 0x01}, None},
+};
+
+static Bool isValidPictOp(int op) {
+    return (op >= PictOpMinimum && op <= PictOpMaximum)
+           || (op >= PictOpDisjointMinimum && op <= PictOpDisjointMaximum)
+           || (op >= PictOpConjointMinimum && op <= PictOpConjointMaximum)
+           || (op >= PictOpBlendMinimum && op <= PictOpBlendMaximum);
+}
+
+/*
+ * Check the operator and the pictures of a composite request, the destination must not be a solid fill.
+ */
+Bool checkCompositePictures(Display* display, int op, Picture src, Picture dst, unsigned char minorCode) {
+    TYPE_CHECK(src, PICTURE, display, False);
+    TYPE_CHECK(dst, PICTURE, display, False);
+    if (!isValidPictOp(op)) {
+        LOG("BadPictOp: Got invalid operator %d in request %d of %s!\n", op, minorCode, RENDER_NAME);
+        handleError(0, display, None, 0, RENDER_FIRST_ERROR + BadPictOp, minorCode);
+        return False;
+    }
+    if (GET_PICTURE_STRUCT(dst)->drawable == None) {
+        LOG("BadMatch: Got a solid fill picture as the destination in request %d of %s!\n",
+            minorCode, RENDER_NAME);
+        handleError(0, display, dst, 0, BadMatch, minorCode);
+        return False;
+    }
+    return True;
+}
+
+/*
+ * Get the size of the drawable and the number of its device pixels per logical pixel.
+ * Returns False if the drawable has no content, e.g. the back buffer of a destroyed window.
+ */
+static Bool getDrawableGeometry(Drawable drawable, int* width, int* height, float* scale) {
+    if (IS_TYPE(drawable, PIXMAP)) {
+        *width = (int) GET_PIXMAP_STRUCT(drawable)->width;
+        *height = (int) GET_PIXMAP_STRUCT(drawable)->height;
+        *scale = IS_BITMAP(drawable) ? 1.0f : DEVICE_SCALE;
+        return True;
+    }
+    Window window = IS_TYPE(drawable, BACK_BUFFER) ? GET_BACK_BUFFER(drawable)->window : drawable;
+    if (window == None) return False;
+    GET_WINDOW_DIMS(window, *width, *height);
+    SDL_Renderer* renderer = NULL;
+    GET_RENDERER(drawable, renderer);
+    if (renderer == NULL) return False;
+    SDL_RenderGetScale(renderer, scale, NULL);
+    return True;
+}
+
+static void freeImageSurface(pixman_image_t* image, void* surface) {
+    (void) image;
+    SDL_FreeSurface(surface);
+}
+
+/*
+ * Create a pixman image which uses the pixels of the surface and frees it once it is destroyed.
+ * If opaque is set, the alpha channel of the surface is ignored.
+ */
+static pixman_image_t* createSurfaceImage(SDL_Surface* surface, Bool opaque) {
+    pixman_format_code_t format;
+    switch (surface->format->format) {
+        case SDL_PIXELFORMAT_ARGB8888:
+            format = opaque ? PIXMAN_x8r8g8b8 : PIXMAN_a8r8g8b8;
+            break;
+        case SDL_PIXELFORMAT_RGB888:
+            format = PIXMAN_x8r8g8b8;
+            break;
+        case SDL_PIXELFORMAT_ABGR8888:
+            format = opaque ? PIXMAN_x8b8g8r8 : PIXMAN_a8b8g8r8;
+            break;
+        case SDL_PIXELFORMAT_BGR888:
+            format = PIXMAN_x8b8g8r8;
+            break;
+        case SDL_PIXELFORMAT_RGBA8888:
+            format = opaque ? PIXMAN_r8g8b8x8 : PIXMAN_r8g8b8a8;
+            break;
+        case SDL_PIXELFORMAT_BGRA8888:
+            format = opaque ? PIXMAN_b8g8r8x8 : PIXMAN_b8g8r8a8;
+            break;
+        default: {
+            SDL_Surface* convertedSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+            SDL_FreeSurface(surface);
+            if (convertedSurface == NULL) {
+                LOG("SDL_ConvertSurfaceFormat failed in %s: %s\n", __func__, SDL_GetError());
+                return NULL;
+            }
+            return createSurfaceImage(convertedSurface, opaque);
+        }
+    }
+    pixman_image_t* image = pixman_image_create_bits(format, surface->w, surface->h, surface->pixels,
+                                                     surface->pitch);
+    if (image == NULL) {
+        SDL_FreeSurface(surface);
+        return NULL;
+    }
+    pixman_image_set_destroy_function(image, freeImageSurface, surface);
+    return image;
+}
+
+static Bool createSolidImage(const XRenderColor* color, CompositeImage* image) {
+    pixman_color_t pixmanColor = {color->red, color->green, color->blue, color->alpha};
+    image->image = pixman_image_create_solid_fill(&pixmanColor);
+    image->scale = 0;
+    image->originX = image->originY = 0;
+    return image->image != NULL;
+}
+
+/*
+ * Get the image of the picture for the composite area. A destination point (x, y) is
+ * the point (x + offsetX, y + offsetY) of the picture. Only the used part of the drawable
+ * of the picture is read, unless the picture repeats. Returns False on failure.
+ */
+Bool getPictureImage(Picture picture, int offsetX, int offsetY, const CompositeArea* area, CompositeImage* image) {
+    static const pixman_repeat_t repeatModes[] = {
+        PIXMAN_REPEAT_NONE, PIXMAN_REPEAT_NORMAL, PIXMAN_REPEAT_PAD, PIXMAN_REPEAT_REFLECT
+    };
+    PictureStruct* pictureStruct = GET_PICTURE_STRUCT(picture);
+    if (pictureStruct->drawable == None) {
+        return createSolidImage(&pictureStruct->color, image);
+    }
+    int width, height;
+    if (!getDrawableGeometry(pictureStruct->drawable, &width, &height, &image->scale)) {
+        return False;
+    }
+    SDL_Rect readRect = {0, 0, width, height};
+    if (pictureStruct->repeat == RepeatNone) {
+        SDL_Rect usedRect = {area->bounds.x + offsetX, area->bounds.y + offsetY, area->bounds.w, area->bounds.h};
+        if (!SDL_IntersectRect(&usedRect, &readRect, &readRect)) {
+            // Pictures are transparent outside of their drawable.
+            XRenderColor transparent = {0, 0, 0, 0};
+            return createSolidImage(&transparent, image);
+        }
+    }
+    SDL_Surface* surface = getDrawableSurfaceArea(pictureStruct->drawable, &readRect, SDL_PIXELFORMAT_UNKNOWN);
+    if (surface == NULL) {
+        return False;
+    }
+    image->image = createSurfaceImage(surface, !HAS_ALPHA(pictureStruct->format));
+    if (image->image == NULL) {
+        return False;
+    }
+    image->originX = readRect.x - offsetX;
+    image->originY = readRect.y - offsetY;
+    pixman_image_set_repeat(image->image, repeatModes[pictureStruct->repeat]);
+    pixman_image_set_component_alpha(image->image, pictureStruct->componentAlpha);
+    return True;
+}
+
+/*
+ * Scale the image to the resolution of the composite area and get the position of the area in the image.
+ */
+static void placeImage(CompositeImage* image, const CompositeArea* area, int* x, int* y) {
+    if (image->scale == 0) {
+        *x = *y = 0;
+        return;
+    }
+    *x = (int) lroundf((area->bounds.x - image->originX) * area->scale);
+    *y = (int) lroundf((area->bounds.y - image->originY) * area->scale);
+    if (image->scale != area->scale) {
+        pixman_transform_t transform;
+        pixman_fixed_t factor = pixman_double_to_fixed((double) image->scale / area->scale);
+        pixman_transform_init_scale(&transform, factor, factor);
+        pixman_image_set_transform(image->image, &transform);
+        pixman_image_set_filter(image->image, PIXMAN_FILTER_BILINEAR, NULL, 0);
+    }
+}
+
+/*
+ * Start a composite operation onto the bounds of the destination picture.
+ * Returns False if nothing of the destination is affected.
+ */
+Bool beginComposite(Picture dst, const SDL_Rect* bounds, CompositeArea* area) {
+    PictureStruct* dstStruct = GET_PICTURE_STRUCT(dst);
+    int width, height;
+    if (IS_BITMAP(dstStruct->drawable)) {
+        LOG("%s: Compositing onto depth 1 pixmaps is not supported\n", __func__);
+        return False;
+    }
+    if (!getDrawableGeometry(dstStruct->drawable, &width, &height, &area->scale)) {
+        return False;
+    }
+    SDL_Rect drawableRect = {0, 0, width, height};
+    if (!SDL_IntersectRect(bounds, &drawableRect, &area->bounds)) {
+        return False;
+    }
+    if (dstStruct->hasClip) {
+        pixman_box16_t* extents = pixman_region_extents(&dstStruct->clipRegion);
+        SDL_Rect clipRect = {extents->x1 + dstStruct->clipXOrigin, extents->y1 + dstStruct->clipYOrigin,
+                             extents->x2 - extents->x1, extents->y2 - extents->y1};
+        if (!SDL_IntersectRect(&area->bounds, &clipRect, &area->bounds)) {
+            return False;
+        }
+    }
+    area->dst = dst;
+    area->width = MAX((int) ceilf(area->bounds.w * area->scale), 1);
+    area->height = MAX((int) ceilf(area->bounds.h * area->scale), 1);
+    return True;
+}
+
+/*
+ * Create the image the composite operation is done in. It is transparent if the result is blended
+ * onto the destination, otherwise it contains the current content of the destination area.
+ */
+static pixman_image_t* createResultImage(const CompositeArea* area, Bool blend) {
+    pixman_image_t* result = pixman_image_create_bits(PIXMAN_a8r8g8b8, area->width, area->height, NULL, 0);
+    if (result == NULL || blend) {
+        return result;
+    }
+    PictureStruct* dstStruct = GET_PICTURE_STRUCT(area->dst);
+    SDL_Surface* surface = getDrawableSurfaceArea(dstStruct->drawable, &area->bounds, SDL_PIXELFORMAT_UNKNOWN);
+    pixman_image_t* content = surface != NULL ? createSurfaceImage(surface, !HAS_ALPHA(dstStruct->format)) : NULL;
+    if (content == NULL) {
+        pixman_image_unref(result);
+        return NULL;
+    }
+    pixman_image_composite32(PIXMAN_OP_SRC, content, NULL, result, 0, 0, 0, 0, 0, 0,
+                             area->width, area->height);
+    pixman_image_unref(content);
+    return result;
+}
+
+/*
+ * Restrict the composite operation to the clip region of the destination.
+ */
+static void setResultClip(pixman_image_t* result, const CompositeArea* area) {
+    PictureStruct* dstStruct = GET_PICTURE_STRUCT(area->dst);
+    int numBoxes, i;
+    pixman_box16_t* boxes = pixman_region_rectangles(&dstStruct->clipRegion, &numBoxes);
+    pixman_box16_t* scaledBoxes = malloc(sizeof(pixman_box16_t) * MAX(numBoxes, 1));
+    if (scaledBoxes == NULL) {
+        LOG("Out of memory: Failed to allocate the clip region in %s\n", __func__);
+        return;
+    }
+    int offsetX = dstStruct->clipXOrigin - area->bounds.x;
+    int offsetY = dstStruct->clipYOrigin - area->bounds.y;
+    for (i = 0; i < numBoxes; i++) {
+        scaledBoxes[i].x1 = (int16_t) floorf((boxes[i].x1 + offsetX) * area->scale);
+        scaledBoxes[i].y1 = (int16_t) floorf((boxes[i].y1 + offsetY) * area->scale);
+        scaledBoxes[i].x2 = (int16_t) ceilf((boxes[i].x2 + offsetX) * area->scale);
+        scaledBoxes[i].y2 = (int16_t) ceilf((boxes[i].y2 + offsetY) * area->scale);
+    }
+    pixman_region16_t region;
+    pixman_region_init_rects(&region, scaledBoxes, numBoxes);
+    pixman_image_set_clip_region(result, &region);
+    pixman_region_fini(&region);
+    free(scaledBoxes);
+}
+
+static void setImageOpaque(pixman_image_t* image) {
+    Uint8* row = (Uint8*) pixman_image_get_data(image);
+    int stride = pixman_image_get_stride(image);
+    int width = pixman_image_get_width(image);
+    int height = pixman_image_get_height(image);
+    int x, y;
+    for (y = 0; y < height; y++, row += stride) {
+        Uint32* pixels = (Uint32*) row;
+        for (x = 0; x < width; x++) {
+            pixels[x] |= 0xFF000000;
+        }
+    }
+}
+
+/*
+ * Convert the premultiplied ARGB pixels of the surface to straight alpha.
+ */
+static void unpremultiplySurface(SDL_Surface* surface) {
+    Uint8* row = surface->pixels;
+    int x, y;
+    for (y = 0; y < surface->h; y++, row += surface->pitch) {
+        Uint32* pixels = (Uint32*) row;
+        for (x = 0; x < surface->w; x++) {
+            Uint32 alpha = pixels[x] >> 24;
+            if (alpha == 0 || alpha == 0xFF) continue;
+            Uint32 red = MIN(((pixels[x] >> 16) & 0xFF) * 0xFF / alpha, 0xFF);
+            Uint32 green = MIN(((pixels[x] >> 8) & 0xFF) * 0xFF / alpha, 0xFF);
+            Uint32 blue = MIN((pixels[x] & 0xFF) * 0xFF / alpha, 0xFF);
+            pixels[x] = alpha << 24 | red << 16 | green << 8 | blue;
+        }
+    }
+}
+
+/*
+ * Blend the premultiplied texture of the surface onto the render target. If the renderer doesn't
+ * support premultiplied blending, the surface is converted to straight alpha and uploaded again.
+ */
+static void setPremultipliedBlendMode(SDL_Texture* texture, SDL_Surface* surface, Bool* isStraightAlpha) {
+    if (!*isStraightAlpha) {
+        #if SDL_VERSION_ATLEAST(2, 0, 6)
+        SDL_BlendMode blendMode = SDL_ComposeCustomBlendMode(
+                SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+                SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+        if (SDL_SetTextureBlendMode(texture, blendMode) == 0) {
+            return;
+        }
+        #endif
+        unpremultiplySurface(surface);
+        *isStraightAlpha = True;
+        SDL_Rect rect = {0, 0, surface->w, surface->h};
+        SDL_UpdateTexture(texture, &rect, surface->pixels, surface->pitch);
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+}
+
+/*
+ * Draw the result of the composite operation onto the destination, either blended or replacing it.
+ */
+static void drawResultImage(Display* display, pixman_image_t* result, Bool blend, const CompositeArea* area) {
+    Drawable drawable = GET_PICTURE_STRUCT(area->dst)->drawable;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormatFrom(pixman_image_get_data(result), area->width,
+                                                              area->height, 32, pixman_image_get_stride(result),
+                                                              SDL_PIXELFORMAT_ARGB8888);
+    if (surface == NULL) {
+        LOG("SDL_CreateRGBSurfaceWithFormatFrom failed in %s: %s\n", __func__, SDL_GetError());
+        handleOutOfMemory(0, display, 0, 0);
+        return;
+    }
+    SDL_Rect srcRect = {0, 0, area->width, area->height};
+    SDL_Rect destRect;
+    SDL_Texture* texture = NULL;
+    SDL_Renderer* textureRenderer = NULL;
+    Bool isStraightAlpha = False;
+    DrawTarget target;
+    FOR_EACH_DRAW_TARGET(drawable, NULL, &area->bounds, target) {
+        if (target.renderer == NULL) {
+            handleError(0, display, drawable, 0, BadAlloc, 0);
+            break;
+        }
+        if (target.renderer != textureRenderer) {
+            releaseTexture(textureRenderer, texture);
+            texture = acquireSurfaceTexture(target.renderer, surface);
+            textureRenderer = target.renderer;
+            if (texture == NULL) {
+                handleError(0, display, drawable, 0, BadAlloc, 0);
+                break;
+            }
+            if (blend) {
+                setPremultipliedBlendMode(texture, surface, &isStraightAlpha);
+            } else {
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+            }
+        }
+        destRect = area->bounds;
+        destRect.x -= target.offsetX;
+        destRect.y -= target.offsetY;
+        if (SDL_RenderCopy(target.renderer, texture, &srcRect, &destRect) != 0) {
+            LOG("SDL_RenderCopy failed in %s: %s\n", __func__, SDL_GetError());
+        }
+    }
+    releaseTexture(textureRenderer, texture);
+    SDL_FreeSurface(surface);
+}
+
+/*
+ * Composite the source through the mask (which may be NULL) onto the composite area
+ * of the destination with the operator. The images are freed.
+ */
+void finishComposite(Display* display, int op, CompositeImage* source, CompositeImage* mask,
+                     const CompositeArea* area) {
+    PictureStruct* dstStruct = GET_PICTURE_STRUCT(area->dst);
+    // Over is the only operator which can be done by blending, all others need the destination content.
+    Bool blend = op == PictOpOver;
+    pixman_image_t* result = createResultImage(area, blend);
+    if (result == NULL) {
+        LOG("Failed to create the result image in %s\n", __func__);
+        handleOutOfMemory(0, display, 0, 0);
+    } else {
+        int srcX, srcY, maskX = 0, maskY = 0;
+        placeImage(source, area, &srcX, &srcY);
+        if (mask != NULL) {
+            placeImage(mask, area, &maskX, &maskY);
+        }
+        if (dstStruct->hasClip) {
+            setResultClip(result, area);
+        }
+        pixman_image_composite32((pixman_op_t) op, source->image, mask != NULL ? mask->image : NULL, result,
+                                 srcX, srcY, maskX, maskY, 0, 0, area->width, area->height);
+        if (!blend && !HAS_ALPHA(dstStruct->format)) {
+            setImageOpaque(result);
+        }
+        drawResultImage(display, result, blend, area);
+        pixman_image_unref(result);
+    }
+    pixman_image_unref(source->image);
+    if (mask != NULL) {
+        pixman_image_unref(mask->image);
+    }
+}
+
+/*
+ * Composite the source picture onto the composite area through a coverage mask of the area.
+ * The coverage has coverageScale pixels per logical pixel and is freed.
+ */
+void compositeCoverage(Display* display, int op, Picture src, int srcOffsetX, int srcOffsetY,
+                       pixman_image_t* coverage, float coverageScale, const CompositeArea* area) {
+    CompositeImage source;
+    CompositeImage mask = {coverage, coverageScale, area->bounds.x, area->bounds.y};
+    if (!getPictureImage(src, srcOffsetX, srcOffsetY, area, &source)) {
+        LOG("Failed to get the source image in %s\n", __func__);
+        pixman_image_unref(coverage);
+        return;
+    }
+    finishComposite(display, op, &source, &mask, area);
+}
+
+/*
+ * Create a transparent coverage mask for the composite area in the format of the mask format.
+ * Antialiased coverage is used if no mask format is given.
+ */
+static pixman_image_t* createCoverageMask(const XRenderPictFormat* maskFormat, const CompositeArea* area) {
+    pixman_format_code_t format = maskFormat != NULL && maskFormat->depth == 1 ? PIXMAN_a1 : PIXMAN_a8;
+    return pixman_image_create_bits(format, area->width, area->height, NULL, 0);
+}
+
+/*
+ * Convert a fixed point coordinate to the device pixels of the composite area relative to the origin.
+ */
+static pixman_fixed_t toAreaFixed(XFixed value, int origin, const CompositeArea* area) {
+    return (pixman_fixed_t) (((double) value - origin * 65536.0) * area->scale);
+}
+
+static void toAreaPoint(const XPointFixed* point, pixman_point_fixed_t* result, const CompositeArea* area) {
+    result->x = toAreaFixed(point->x, area->bounds.x, area);
+    result->y = toAreaFixed(point->y, area->bounds.y, area);
+}
+
+static void addFixedBounds(SDL_Rect* bounds, Bool* hasBounds, double x1, double y1, double x2, double y2) {
+    SDL_Rect rect;
+    rect.x = (int) floor(x1 / 65536.0);
+    rect.y = (int) floor(y1 / 65536.0);
+    rect.w = (int) ceil(x2 / 65536.0) - rect.x;
+    rect.h = (int) ceil(y2 / 65536.0) - rect.y;
+    if (rect.w <= 0 || rect.h <= 0) return;
+    if (*hasBounds) {
+        SDL_UnionRect(bounds, &rect, bounds);
+    } else {
+        *bounds = rect;
+        *hasBounds = True;
+    }
+}
+
+static double getLineX(const XLineFixed* line, XFixed y) {
+    if (line->p1.y == line->p2.y) {
+        return line->p1.x;
+    }
+    return line->p1.x + ((double) y - line->p1.y) * ((double) line->p2.x - line->p1.x)
+                        / ((double) line->p2.y - line->p1.y);
+}
+
+static void compositeTriangles(Display* display, int op, Picture src, Picture dst,
+                               const XRenderPictFormat* maskFormat, int xSrc, int ySrc,
+                               const XTriangle* triangles, int numTriangles) {
+    SDL_Rect bounds;
+    Bool hasBounds = False;
+    int i;
+    for (i = 0; i < numTriangles; i++) {
+        const XTriangle* triangle = &triangles[i];
+        addFixedBounds(&bounds, &hasBounds,
+                       MIN(MIN(triangle->p1.x, triangle->p2.x), triangle->p3.x),
+                       MIN(MIN(triangle->p1.y, triangle->p2.y), triangle->p3.y),
+                       MAX(MAX(triangle->p1.x, triangle->p2.x), triangle->p3.x),
+                       MAX(MAX(triangle->p1.y, triangle->p2.y), triangle->p3.y));
+    }
+    CompositeArea area;
+    if (!hasBounds || !beginComposite(dst, &bounds, &area)) return;
+    pixman_image_t* coverage = createCoverageMask(maskFormat, &area);
+    pixman_triangle_t* areaTriangles = malloc(sizeof(pixman_triangle_t) * numTriangles);
+    if (coverage == NULL || areaTriangles == NULL) {
+        if (coverage != NULL) pixman_image_unref(coverage);
+        free(areaTriangles);
+        handleOutOfMemory(0, display, 0, 0);
+        return;
+    }
+    for (i = 0; i < numTriangles; i++) {
+        toAreaPoint(&triangles[i].p1, &areaTriangles[i].p1, &area);
+        toAreaPoint(&triangles[i].p2, &areaTriangles[i].p2, &area);
+        toAreaPoint(&triangles[i].p3, &areaTriangles[i].p3, &area);
+    }
+    pixman_add_triangles(coverage, 0, 0, numTriangles, areaTriangles);
+    free(areaTriangles);
+    // The source is aligned to the first point of the first triangle.
+    compositeCoverage(display, op, src, xSrc - (triangles[0].p1.x >> 16), ySrc - (triangles[0].p1.y >> 16),
+                      coverage, area.scale, &area);
+}
+
+/*
+ * Fill the rectangles of the composite area with the color using the renderer,
+ * for the operators that don't need the content of the destination.
+ */
+static void fillSolidRectangles(Display* display, int op, const XRenderColor* color, const XRectangle* rectangles,
+                                int numRectangles, const CompositeArea* area) {
+    PictureStruct* dstStruct = GET_PICTURE_STRUCT(area->dst);
+    Uint8 red = (Uint8) (color->red >> 8), green = (Uint8) (color->green >> 8);
+    Uint8 blue = (Uint8) (color->blue >> 8), alpha = (Uint8) (color->alpha >> 8);
+    SDL_BlendMode blendMode = SDL_BLENDMODE_NONE;
+    if (op == PictOpClear) {
+        red = green = blue = alpha = 0;
+    } else if (alpha != 0xFF && alpha != 0) {
+        // Render colors are premultiplied, the renderer uses straight alpha.
+        red = (Uint8) MIN(red * 0xFF / alpha, 0xFF);
+        green = (Uint8) MIN(green * 0xFF / alpha, 0xFF);
+        blue = (Uint8) MIN(blue * 0xFF / alpha, 0xFF);
+    }
+    if (op == PictOpOver && alpha != 0xFF) {
+        if (alpha == 0) return;
+        blendMode = SDL_BLENDMODE_BLEND;
+    }
+    if (blendMode == SDL_BLENDMODE_NONE && !HAS_ALPHA(dstStruct->format)) {
+        alpha = 0xFF;
+    }
+    int numClipBoxes = 1, i, j;
+    pixman_box16_t* clipBoxes = NULL;
+    if (dstStruct->hasClip) {
+        clipBoxes = pixman_region_rectangles(&dstStruct->clipRegion, &numClipBoxes);
+    }
+    SDL_Rect* rects = malloc(sizeof(SDL_Rect) * numRectangles * MAX(numClipBoxes, 1));
+    if (rects == NULL) {
+        handleOutOfMemory(0, display, 0, 0);
+        return;
+    }
+    int numRects = 0;
+    for (i = 0; i < numRectangles; i++) {
+        SDL_Rect rect = {rectangles[i].x, rectangles[i].y, rectangles[i].width, rectangles[i].height};
+        if (!SDL_IntersectRect(&rect, &area->bounds, &rect)) continue;
+        if (clipBoxes == NULL) {
+            rects[numRects++] = rect;
+            continue;
+        }
+        for (j = 0; j < numClipBoxes; j++) {
+            SDL_Rect clipRect = {clipBoxes[j].x1 + dstStruct->clipXOrigin, clipBoxes[j].y1 + dstStruct->clipYOrigin,
+                                 clipBoxes[j].x2 - clipBoxes[j].x1, clipBoxes[j].y2 - clipBoxes[j].y1};
+            if (SDL_IntersectRect(&rect, &clipRect, &rects[numRects])) {
+                numRects++;
+            }
+        }
+    }
+    DrawTarget target;
+    if (numRects > 0) {
+        FOR_EACH_DRAW_TARGET(dstStruct->drawable, NULL, &area->bounds, target) {
+            if (target.renderer == NULL) {
+                handleError(0, display, dstStruct->drawable, 0, BadAlloc, 0);
+                break;
+            }
+            for (i = 0; i < numRects; i++) {
+                rects[i].x -= target.offsetX;
+                rects[i].y -= target.offsetY;
+            }
+            SDL_SetRenderDrawBlendMode(target.renderer, blendMode);
+            SDL_SetRenderDrawColor(target.renderer, red, green, blue, alpha);
+            if (SDL_RenderFillRects(target.renderer, rects, numRects) != 0) {
+                LOG("SDL_RenderFillRects failed in %s: %s\n", __func__, SDL_GetError());
+            }
+            for (i = 0; i < numRects; i++) {
+                rects[i].x += target.offsetX;
+                rects[i].y += target.offsetY;
+            }
+        }
+    }
+    free(rects);
+}
+
+Bool XRenderQueryExtension(Display* display, int* event_basep, int* error_basep) {
+    *event_basep = 0;
+    *error_basep = RENDER_FIRST_ERROR;
+    return True;
+}
+
+Status XRenderQueryVersion(Display* display, int* major_versionp, int* minor_versionp) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    *major_versionp = RENDER_MAJOR;
+    *minor_versionp = RENDER_MINOR;
+    return 1;
+}
+
+Status XRenderQueryFormats(Display* display) {
+    // The formats are static.
+    return 1;
+}
+
+int XRenderQuerySubpixelOrder(Display* display, int screen) {
+    return SubPixelUnknown;
+}
+
+XRenderPictFormat* XRenderFindVisualFormat(Display* display, _Xconst Visual* visual) {
+    // Every visual is a true color visual without alpha.
+    return &pictFormats[PictStandardRGB24];
+}
+
+XRenderPictFormat* XRenderFindFormat(Display* display, unsigned long mask,
+                                     _Xconst XRenderPictFormat* templ, int count) {
+    size_t i;
+    for (i = 0; i < ARRAY_LENGTH(pictFormats); i++) {
+        XRenderPictFormat* format = &pictFormats[i];
+        if ((HAS_VALUE(mask, PictFormatID) && templ->id != format->id)
+            || (HAS_VALUE(mask, PictFormatType) && templ->type != format->type)
+            || (HAS_VALUE(mask, PictFormatDepth) && templ->depth != format->depth)
+            || (HAS_VALUE(mask, PictFormatRed) && templ->direct.red != format->direct.red)
+            || (HAS_VALUE(mask, PictFormatRedMask) && templ->direct.redMask != format->direct.redMask)
+            || (HAS_VALUE(mask, PictFormatGreen) && templ->direct.green != format->direct.green)
+            || (HAS_VALUE(mask, PictFormatGreenMask) && templ->direct.greenMask != format->direct.greenMask)
+            || (HAS_VALUE(mask, PictFormatBlue) && templ->direct.blue != format->direct.blue)
+            || (HAS_VALUE(mask, PictFormatBlueMask) && templ->direct.blueMask != format->direct.blueMask)
+            || (HAS_VALUE(mask, PictFormatAlpha) && templ->direct.alpha != format->direct.alpha)
+            || (HAS_VALUE(mask, PictFormatAlphaMask) && templ->direct.alphaMask != format->direct.alphaMask)
+            || (HAS_VALUE(mask, PictFormatColormap) && templ->colormap != format->colormap)) {
+            continue;
+        }
+        if (count-- == 0) {
+            return format;
+        }
+    }
+    return NULL;
+}
+
+XRenderPictFormat* XRenderFindStandardFormat(Display* display, int format) {
+    if (format < 0 || format >= PictStandardNUM) {
+        return NULL;
+    }
+    return &pictFormats[format];
+}
+
+/*
+ * Set the clip region of the picture to the set bits of the bitmap.
+ */
+static Bool setClipMask(PictureStruct* pictureStruct, Pixmap clipMask) {
+    PixmapStruct* bitmapStruct = GET_PIXMAP_STRUCT(clipMask);
+    int x, y, runStart;
+    pixman_region_clear(&pictureStruct->clipRegion);
+    for (y = 0; y < (int) bitmapStruct->height; y++) {
+        for (x = 0; x < (int) bitmapStruct->width; x++) {
+            if (!GET_BITMAP_BIT(bitmapStruct, x, y)) continue;
+            for (runStart = x; x < (int) bitmapStruct->width && GET_BITMAP_BIT(bitmapStruct, x, y); x++);
+            if (!pixman_region_union_rect(&pictureStruct->clipRegion, &pictureStruct->clipRegion,
+                                          runStart, y, (unsigned int) (x - runStart), 1)) {
+                return False;
+            }
+        }
+    }
+    pictureStruct->hasClip = True;
+    return True;
+}
+
+static void changePictureAttributes(Display* display, PictureStruct* pictureStruct, unsigned long valuemask,
+                                    _Xconst XRenderPictureAttributes* attributes, unsigned char minorCode) {
+    if (HAS_VALUE(valuemask, CPRepeat)) {
+        if (attributes->repeat < RepeatNone || attributes->repeat > RepeatReflect) {
+            LOG("BadValue: Got invalid repeat %d in %s!\n", attributes->repeat, __func__);
+            handleError(0, display, None, 0, BadValue, minorCode);
+            return;
+        }
+        pictureStruct->repeat = attributes->repeat;
+    }
+    if (HAS_VALUE(valuemask, CPClipXOrigin)) {
+        pictureStruct->clipXOrigin = attributes->clip_x_origin;
+    }
+    if (HAS_VALUE(valuemask, CPClipYOrigin)) {
+        pictureStruct->clipYOrigin = attributes->clip_y_origin;
+    }
+    if (HAS_VALUE(valuemask, CPClipMask)) {
+        if (attributes->clip_mask == None) {
+            pixman_region_clear(&pictureStruct->clipRegion);
+            pictureStruct->hasClip = False;
+        } else if (!IS_BITMAP(attributes->clip_mask)) {
+            LOG("BadMatch: The clip mask is not a bitmap in %s!\n", __func__);
+            handleError(0, display, attributes->clip_mask, 0, BadMatch, minorCode);
+        } else if (!setClipMask(pictureStruct, attributes->clip_mask)) {
+            handleOutOfMemory(0, display, 0, minorCode);
+        }
+    }
+    if (HAS_VALUE(valuemask, CPComponentAlpha)) {
+        pictureStruct->componentAlpha = attributes->component_alpha;
+    }
+    if (HAS_VALUE(valuemask, CPAlphaMap) && attributes->alpha_map != None) {
+        LOG("%s: Alpha maps are not supported\n", __func__);
+    }
+    // Graphics exposures, the subwindow mode, the polygon modes and dithering don't change the result here.
+}
+
+static Picture createPicture(Display* display, Drawable drawable, XRenderPictFormat* format,
+                             const XRenderColor* color, unsigned char minorCode) {
+    Picture picture = ALLOC_XID();
+    PictureStruct* pictureStruct = malloc(sizeof(PictureStruct));
+    if (picture == None || pictureStruct == NULL) {
+        if (picture != None) FREE_XID(picture);
+        free(pictureStruct);
+        handleOutOfMemory(0, display, 0, minorCode);
+        return None;
+    }
+    pictureStruct->drawable = drawable;
+    pictureStruct->format = format;
+    pictureStruct->repeat = drawable == None ? RepeatNormal : RepeatNone;
+    pictureStruct->componentAlpha = False;
+    pixman_region_init(&pictureStruct->clipRegion);
+    pictureStruct->hasClip = False;
+    pictureStruct->clipXOrigin = pictureStruct->clipYOrigin = 0;
+    if (color != NULL) {
+        pictureStruct->color = *color;
+    } else {
+        memset(&pictureStruct->color, 0, sizeof(XRenderColor));
+    }
+    SET_XID_TYPE(picture, PICTURE);
+    SET_XID_VALUE(picture, pictureStruct);
+    return picture;
+}
+
+Picture XRenderCreatePicture(Display* display, Drawable drawable, _Xconst XRenderPictFormat* format,
+                             unsigned long valuemask, _Xconst XRenderPictureAttributes* attributes) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(drawable, DRAWABLE, display, None);
+    if (format == NULL || format < pictFormats || format >= pictFormats + PictStandardNUM) {
+        LOG("BadPictFormat: Got an unknown picture format in %s!\n", __func__);
+        handleError(0, display, None, 0, RENDER_FIRST_ERROR + BadPictFormat, X_RenderCreatePicture);
+        return None;
+    }
+    if (IS_BITMAP(drawable) != (format->depth == 1)) {
+        LOG("BadMatch: The depth of the picture format doesn't match the drawable in %s!\n", __func__);
+        handleError(0, display, drawable, 0, BadMatch, X_RenderCreatePicture);
+        return None;
+    }
+    Picture picture = createPicture(display, drawable, (XRenderPictFormat*) format, NULL, X_RenderCreatePicture);
+    if (picture != None && attributes != NULL) {
+        changePictureAttributes(display, GET_PICTURE_STRUCT(picture), valuemask, attributes,
+                                X_RenderCreatePicture);
+    }
+    return picture;
+}
+
+Picture XRenderCreateSolidFill(Display* display, const XRenderColor* color) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    return createPicture(display, None, &pictFormats[PictStandardARGB32], color, X_RenderCreateSolidFill);
+}
+
+void XRenderChangePicture(Display* display, Picture picture, unsigned long valuemask,
+                          _Xconst XRenderPictureAttributes* attributes) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(picture, PICTURE, display);
+    syncRenderThread();
+    changePictureAttributes(display, GET_PICTURE_STRUCT(picture), valuemask, attributes, X_RenderChangePicture);
+}
+
+void XRenderSetPictureClipRectangles(Display* display, Picture picture, int xOrigin, int yOrigin,
+                                     _Xconst XRectangle* rects, int n) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(picture, PICTURE, display);
+    syncRenderThread();
+    PictureStruct* pictureStruct = GET_PICTURE_STRUCT(picture);
+    pixman_box16_t* boxes = malloc(sizeof(pixman_box16_t) * MAX(n, 1));
+    if (boxes == NULL) {
+        handleOutOfMemory(0, display, 0, X_RenderSetPictureClipRectangles);
+        return;
+    }
+    int i;
+    for (i = 0; i < n; i++) {
+        boxes[i].x1 = rects[i].x;
+        boxes[i].y1 = rects[i].y;
+        boxes[i].x2 = (int16_t) (rects[i].x + rects[i].width);
+        boxes[i].y2 = (int16_t) (rects[i].y + rects[i].height);
+    }
+    pixman_region_fini(&pictureStruct->clipRegion);
+    if (!pixman_region_init_rects(&pictureStruct->clipRegion, boxes, n)) {
+        handleOutOfMemory(0, display, 0, X_RenderSetPictureClipRectangles);
+    }
+    free(boxes);
+    pictureStruct->hasClip = True;
+    pictureStruct->clipXOrigin = xOrigin;
+    pictureStruct->clipYOrigin = yOrigin;
+}
+
+void XRenderSetPictureClipRegion(Display* display, Picture picture, Region r) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(picture, PICTURE, display);
+    syncRenderThread();
+    PictureStruct* pictureStruct = GET_PICTURE_STRUCT(picture);
+    if (!pixman_region_copy(&pictureStruct->clipRegion, (pixman_region16_t*) (void*) r)) {
+        handleOutOfMemory(0, display, 0, X_RenderSetPictureClipRectangles);
+        return;
+    }
+    pictureStruct->hasClip = True;
+    pictureStruct->clipXOrigin = pictureStruct->clipYOrigin = 0;
+}
+
+void XRenderFreePicture(Display* display, Picture picture) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    TYPE_CHECK(picture, PICTURE, display);
+    syncRenderThread();
+    PictureStruct* pictureStruct = GET_PICTURE_STRUCT(picture);
+    pixman_region_fini(&pictureStruct->clipRegion);
+    free(pictureStruct);
+    FREE_XID(picture);
+}
+
+void XRenderComposite(Display* display, int op, Picture src, Picture mask, Picture dst, int src_x, int src_y,
+                      int mask_x, int mask_y, int dst_x, int dst_y, unsigned int width, unsigned int height) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    if (!checkCompositePictures(display, op, src, dst, X_RenderComposite)) return;
+    if (mask != None) {
+        TYPE_CHECK(mask, PICTURE, display);
+    }
+    if (op == PictOpDst) return;
+    syncRenderThread();
+    SDL_Rect bounds = {dst_x, dst_y, (int) width, (int) height};
+    CompositeArea area;
+    if (!beginComposite(dst, &bounds, &area)) return;
+    CompositeImage source, maskImage;
+    if (!getPictureImage(src, src_x - dst_x, src_y - dst_y, &area, &source)) {
+        LOG("Failed to get the source image in %s\n", __func__);
+        return;
+    }
+    if (mask != None && !getPictureImage(mask, mask_x - dst_x, mask_y - dst_y, &area, &maskImage)) {
+        LOG("Failed to get the mask image in %s\n", __func__);
+        pixman_image_unref(source.image);
+        return;
+    }
+    finishComposite(display, op, &source, mask != None ? &maskImage : NULL, &area);
+}
+
+void XRenderFillRectangle(Display* display, int op, Picture dst, _Xconst XRenderColor* color,
+                          int x, int y, unsigned int width, unsigned int height) {
+    XRectangle rectangle = {(short) x, (short) y, (unsigned short) width, (unsigned short) height};
+    XRenderFillRectangles(display, op, dst, color, &rectangle, 1);
+}
+
+void XRenderFillRectangles(Display* display, int op, Picture dst, _Xconst XRenderColor* color,
+                           _Xconst XRectangle* rectangles, int n_rects) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    if (!checkCompositePictures(display, op, dst, dst, X_RenderFillRectangles)) return;
+    if (n_rects <= 0 || op == PictOpDst) return;
+    syncRenderThread();
+    SDL_Rect bounds = {0, 0, 0, 0}, rect;
+    int i;
+    for (i = 0; i < n_rects; i++) {
+        rect.x = rectangles[i].x;
+        rect.y = rectangles[i].y;
+        rect.w = rectangles[i].width;
+        rect.h = rectangles[i].height;
+        SDL_UnionRect(&bounds, &rect, &bounds);
+    }
+    CompositeArea area;
+    if (!beginComposite(dst, &bounds, &area)) return;
+    if (op == PictOpClear || op == PictOpSrc || op == PictOpOver) {
+        fillSolidRectangles(display, op, color, rectangles, n_rects, &area);
+        return;
+    }
+    pixman_image_t* coverage = createCoverageMask(NULL, &area);
+    pixman_box32_t* boxes = malloc(sizeof(pixman_box32_t) * n_rects);
+    if (coverage == NULL || boxes == NULL) {
+        if (coverage != NULL) pixman_image_unref(coverage);
+        free(boxes);
+        handleOutOfMemory(0, display, 0, X_RenderFillRectangles);
+        return;
+    }
+    for (i = 0; i < n_rects; i++) {
+        boxes[i].x1 = (int32_t) floorf((rectangles[i].x - area.bounds.x) * area.scale);
+        boxes[i].y1 = (int32_t) floorf((rectangles[i].y - area.bounds.y) * area.scale);
+        boxes[i].x2 = (int32_t) ceilf((rectangles[i].x + rectangles[i].width - area.bounds.x) * area.scale);
+        boxes[i].y2 = (int32_t) ceilf((rectangles[i].y + rectangles[i].height - area.bounds.y) * area.scale);
+    }
+    pixman_color_t opaque = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+    pixman_image_fill_boxes(PIXMAN_OP_SRC, coverage, &opaque, n_rects, boxes);
+    free(boxes);
+    CompositeImage source;
+    CompositeImage mask = {coverage, area.scale, area.bounds.x, area.bounds.y};
+    if (!createSolidImage(color, &source)) {
+        pixman_image_unref(coverage);
+        handleOutOfMemory(0, display, 0, X_RenderFillRectangles);
+        return;
+    }
+    finishComposite(display, op, &source, &mask, &area);
+}
+
+void XRenderCompositeTrapezoids(Display* display, int op, Picture src, Picture dst,
+                                _Xconst XRenderPictFormat* maskFormat, int xSrc, int ySrc,
+                                _Xconst XTrapezoid* traps, int ntrap) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    if (!checkCompositePictures(display, op, src, dst, X_RenderTrapezoids)) return;
+    if (ntrap <= 0 || op == PictOpDst) return;
+    syncRenderThread();
+    SDL_Rect bounds;
+    Bool hasBounds = False;
+    int i;
+    for (i = 0; i < ntrap; i++) {
+        const XTrapezoid* trap = &traps[i];
+        if (trap->top >= trap->bottom) continue;
+        addFixedBounds(&bounds, &hasBounds,
+                       MIN(getLineX(&trap->left, trap->top), getLineX(&trap->left, trap->bottom)), trap->top,
+                       MAX(getLineX(&trap->right, trap->top), getLineX(&trap->right, trap->bottom)), trap->bottom);
+    }
+    CompositeArea area;
+    if (!hasBounds || !beginComposite(dst, &bounds, &area)) return;
+    pixman_image_t* coverage = createCoverageMask(maskFormat, &area);
+    pixman_trapezoid_t* areaTraps = malloc(sizeof(pixman_trapezoid_t) * ntrap);
+    if (coverage == NULL || areaTraps == NULL) {
+        if (coverage != NULL) pixman_image_unref(coverage);
+        free(areaTraps);
+        handleOutOfMemory(0, display, 0, X_RenderTrapezoids);
+        return;
+    }
+    for (i = 0; i < ntrap; i++) {
+        areaTraps[i].top = toAreaFixed(traps[i].top, area.bounds.y, &area);
+        areaTraps[i].bottom = toAreaFixed(traps[i].bottom, area.bounds.y, &area);
+        toAreaPoint(&traps[i].left.p1, &areaTraps[i].left.p1, &area);
+        toAreaPoint(&traps[i].left.p2, &areaTraps[i].left.p2, &area);
+        toAreaPoint(&traps[i].right.p1, &areaTraps[i].right.p1, &area);
+        toAreaPoint(&traps[i].right.p2, &areaTraps[i].right.p2, &area);
+    }
+    pixman_add_trapezoids(coverage, 0, 0, ntrap, areaTraps);
+    free(areaTraps);
+    // The source is aligned to the first point of the left edge of the first trapezoid.
+    compositeCoverage(display, op, src, xSrc - (traps[0].left.p1.x >> 16), ySrc - (traps[0].left.p1.y >> 16),
+                      coverage, area.scale, &area);
+}
+
+void XRenderCompositeTriangles(Display* display, int op, Picture src, Picture dst,
+                               _Xconst XRenderPictFormat* maskFormat, int xSrc, int ySrc,
+                               _Xconst XTriangle* triangles, int ntriangle) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    if (!checkCompositePictures(display, op, src, dst, X_RenderTriangles)) return;
+    if (ntriangle <= 0 || op == PictOpDst) return;
+    syncRenderThread();
+    compositeTriangles(display, op, src, dst, maskFormat, xSrc, ySrc, triangles, ntriangle);
+}
+
+/*
+ * Composite the triangles of a strip (fan is False) or a fan of points.
+ */
+static void compositePointTriangles(Display* display, int op, Picture src, Picture dst,
+                                    const XRenderPictFormat* maskFormat, int xSrc, int ySrc,
+                                    const XPointFixed* points, int numPoints, Bool fan, unsigned char minorCode) {
+    if (!checkCompositePictures(display, op, src, dst, minorCode)) return;
+    if (numPoints < 3 || op == PictOpDst) return;
+    syncRenderThread();
+    XTriangle* triangles = malloc(sizeof(XTriangle) * (numPoints - 2));
+    if (triangles == NULL) {
+        handleOutOfMemory(0, display, 0, minorCode);
+        return;
+    }
+    int i;
+    for (i = 0; i < numPoints - 2; i++) {
+        triangles[i].p1 = fan ? points[0] : points[i];
+        triangles[i].p2 = points[i + 1];
+        triangles[i].p3 = points[i + 2];
+    }
+    compositeTriangles(display, op, src, dst, maskFormat, xSrc, ySrc, triangles, numPoints - 2);
+    free(triangles);
+}
+
+void XRenderCompositeTriStrip(Display* display, int op, Picture src, Picture dst,
+                              _Xconst XRenderPictFormat* maskFormat, int xSrc, int ySrc,
+                              _Xconst XPointFixed* points, int npoint) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    compositePointTriangles(display, op, src, dst, maskFormat, xSrc, ySrc, points, npoint, False,
+                            X_RenderTriStrip);
+}
+
+void XRenderCompositeTriFan(Display* display, int op, Picture src, Picture dst,
+                            _Xconst XRenderPictFormat* maskFormat, int xSrc, int ySrc,
+                            _Xconst XPointFixed* points, int npoint) {
+    SET_X_SERVER_REQUEST(display, RENDER_MAJOR_OPCODE);
+    compositePointTriangles(display, op, src, dst, maskFormat, xSrc, ySrc, points, npoint, True,
+                            X_RenderTriFan);
+}
@@ -0,0 +1,62 @@
+#ifndef _PICTURE_H_
+#define _PICTURE_H_
+
+#include <SDL2/SDL.h>
+#include <pixman.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/Xrender.h>
+
+/*
+ * The RENDER extension: A picture is a drawable (or a solid color) with a picture format and
+ * compositing attributes. Requests are composited by pixman in the device pixels of the destination,
+ * the coverage of geometry and glyphs is rasterized into a mask first. For the Over operator the result
+ * is composited into a transparent image which is blended onto the destination by the renderer,
+ * every other operator needs the current content of the destination, which is read back and replaced.
+ * Solid rectangle fills are drawn by the renderer directly. Glyph sets are described in glyphSet.h.
+ */
+
+typedef struct {
+    /* The drawable of the picture, None for solid fill pictures. */
+    Drawable drawable;
+    XRenderPictFormat* format;
+    int repeat;
+    Bool componentAlpha;
+    /* The clip region relative to the clip origin, only used if hasClip is set. */
+    pixman_region16_t clipRegion;
+    Bool hasClip;
+    int clipXOrigin, clipYOrigin;
+    /* The premultiplied color of solid fill pictures. */
+    XRenderColor color;
+} PictureStruct;
+
+#define GET_PICTURE_STRUCT(picture) ((PictureStruct*) GET_XID_VALUE(picture))
+
+/* The destination area of a composite operation. */
+typedef struct {
+    Picture dst;
+    /* The area in destination coordinates, clipped to the drawable and the clip region. */
+    SDL_Rect bounds;
+    /* The device pixels of the destination per logical pixel. */
+    float scale;
+    /* The size of the area in device pixels. */
+    int width, height;
+} CompositeArea;
+
+/* An image used as the source or mask of a composite operation. */
+typedef struct {
+    pixman_image_t* image;
+    /* The pixels of the image per logical pixel, 0 if it doesn't depend on the resolution. */
+    float scale;
+    /* The position of the top left pixel of the image in destination coordinates. */
+    int originX, originY;
+} CompositeImage;
+
+Bool checkCompositePictures(Display* display, int op, Picture src, Picture dst, unsigned char minorCode);
+Bool beginComposite(Picture dst, const SDL_Rect* bounds, CompositeArea* area);
+Bool getPictureImage(Picture picture, int offsetX, int offsetY, const CompositeArea* area, CompositeImage* image);
+void finishComposite(Display* display, int op, CompositeImage* source, CompositeImage* mask,
+                     const CompositeArea* area);
+void compositeCoverage(Display* display, int op, Picture src, int srcOffsetX, int srcOffsetY,
+                       pixman_image_t* coverage, float coverageScale, const CompositeArea* area);
+
+#endif /* _PICTURE_H_ */
@@ -0,0 +1,460 @@
+#include <string.h>
+#include "pixelConversion.h"
+#include "drawing.h"
+#include "util.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define HAVE_SSE2_KERNELS
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && SDL_VERSION_ATLEAST(2, 0, 4)
+/* The AVX2 kernels are compiled for AVX2 regardless of the compiler flags and only used if the CPU has it. */
+#define HAVE_AVX2_KERNELS
+#include <immintrin.h>
+#define AVX2_FUNCTION __attribute__((target("avx2")))
+#endif
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && SDL_VERSION_ATLEAST(2, 0, 6)
+#define HAVE_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define HOST_BYTE_ORDER MSBFirst
+#else
+#define HOST_BYTE_ORDER LSBFirst
+#endif
+
+static InstructionSet instructionSet = SCALAR;
+static Bool instructionSetDetected = False;
+
+/*
+ * The layout of the pixels of the native pixel format (see colors.h).
+ */
+void getNativePixelLayout(PixelLayout* layout) {
+    layout->bitsPerPixel = 32;
+    layout->byteOrder = HOST_BYTE_ORDER;
+    layout->redMask = DEFAULT_RED_MASK;
+    layout->greenMask = DEFAULT_GREEN_MASK;
+    layout->blueMask = DEFAULT_BLUE_MASK;
+    layout->alphaMask = DEFAULT_ALPHA_MASK;
+}
+
+/*
+ * Get the layout of the packed SDL pixel format. Returns False for formats without such a layout.
+ */
+Bool getFormatPixelLayout(Uint32 format, PixelLayout* layout) {
+    int bitsPerPixel;
+    if (SDL_ISPIXELFORMAT_FOURCC(format) || SDL_ISPIXELFORMAT_INDEXED(format)
+        || !SDL_PixelFormatEnumToMasks(format, &bitsPerPixel, &layout->redMask, &layout->greenMask,
+                                       &layout->blueMask, &layout->alphaMask)) {
+        return False;
+    }
+    // SDL pads 15 and 12 bit formats to the whole bytes of the pixel.
+    layout->bitsPerPixel = SDL_BYTESPERPIXEL(format) * 8;
+    layout->byteOrder = HOST_BYTE_ORDER;
+    return layout->bitsPerPixel >= 8;
+}
+
+static void getMaskRange(Uint32 mask, int* shift, int* width) {
+    *shift = 0;
+    *width = 0;
+    while (mask != 0 && (mask & 1) == 0) {
+        mask >>= 1;
+        (*shift)++;
+    }
+    while ((mask & 1) != 0) {
+        mask >>= 1;
+        (*width)++;
+    }
+}
+
+static Uint32 shiftMask(Uint32 mask, int shift) {
+    return shift >= 0 ? mask << shift : mask >> -shift;
+}
+
+/*
+ * Add the term which moves the masked bits by the shift, merging it with a term of the same shift.
+ */
+static Bool addTerm(ConversionTerm* terms, int* numTerms, Uint32 mask, int shift) {
+    int i;
+    if (mask == 0) return True;
+    for (i = 0; i < *numTerms; i++) {
+        if (terms[i].leftShift - terms[i].rightShift == shift) {
+            terms[i].mask |= mask;
+            return True;
+        }
+    }
+    if (*numTerms == MAX_CONVERSION_TERMS) return False;
+    terms[*numTerms].mask = mask;
+    terms[*numTerms].leftShift = shift > 0 ? shift : 0;
+    terms[*numTerms].rightShift = shift < 0 ? -shift : 0;
+    (*numTerms)++;
+    return True;
+}
+
+/*
+ * Add the terms which move the source channel into the destination channel. Narrower destination
+ * channels get the most significant bits, wider ones are filled by repeating the source bits,
+ * so the maximum value stays the maximum value.
+ */
+static Bool addChannelTerms(PixelConversion* conversion, Uint32 srcMask, Uint32 destMask) {
+    int srcShift, srcWidth, destShift, destWidth;
+    getMaskRange(srcMask, &srcShift, &srcWidth);
+    getMaskRange(destMask, &destShift, &destWidth);
+    if (srcWidth == 0 || destWidth == 0) return True;
+    int position = destWidth;
+    while (position > 0) {
+        position -= srcWidth;
+        int usedBits = position >= 0 ? srcWidth : srcWidth + position;
+        int usedShift = srcShift + srcWidth - usedBits;
+        Uint32 mask = (usedBits >= 32 ? 0xFFFFFFFF : (1u << usedBits) - 1) << usedShift;
+        int shift = destShift + (position > 0 ? position : 0) - usedShift;
+        if (!addTerm(conversion->terms, &conversion->numTerms, mask, shift)) return False;
+    }
+    return True;
+}
+
+/*
+ * Rewrite the terms for pixels whose bytes are stored in the reverse order: For the source, every byte
+ * of the mask moves to its mirrored position; for the destination, every byte of the result does.
+ */
+static Bool swapTerms(PixelConversion* conversion, int bytes, Bool swapDest) {
+    ConversionTerm terms[MAX_CONVERSION_TERMS];
+    int numTerms = 0, i, byte;
+    for (i = 0; i < conversion->numTerms; i++) {
+        int shift = conversion->terms[i].leftShift - conversion->terms[i].rightShift;
+        Uint32 bitsMask = swapDest ? shiftMask(conversion->terms[i].mask, shift) : conversion->terms[i].mask;
+        for (byte = 0; byte < bytes; byte++) {
+            Uint32 byteBits = bitsMask & (0xFFu << (byte * 8));
+            int moved = (bytes - 1 - 2 * byte) * 8;
+            if (byteBits == 0) continue;
+            if (swapDest ? !addTerm(terms, &numTerms, shiftMask(byteBits, -shift), shift + moved)
+                         : !addTerm(terms, &numTerms, shiftMask(byteBits, moved), shift - moved)) {
+                return False;
+            }
+        }
+    }
+    memcpy(conversion->terms, terms, sizeof(terms));
+    conversion->numTerms = numTerms;
+    return True;
+}
+
+static Uint32 swapPixel(Uint32 pixel, int bytes) {
+    return SDL_Swap32(pixel) >> ((4 - bytes) * 8);
+}
+
+static inline Uint32 applyTerms(const PixelConversion* conversion, Uint32 pixel) {
+    Uint32 result = conversion->constant;
+    int i;
+    for (i = 0; i < conversion->numTerms; i++) {
+        result |= ((pixel & conversion->terms[i].mask) >> conversion->terms[i].rightShift)
+                  << conversion->terms[i].leftShift;
+    }
+    return result;
+}
+
+/*
+ * Load and store pixels as values in host byte order. The number of bytes is constant in every kernel,
+ * so the compiler reduces these to a single load or store.
+ */
+static inline Uint32 loadPixel(const Uint8* pointer, int bytes) {
+    Uint16 value16;
+    Uint32 value32;
+    switch (bytes) {
+        case 1:
+            return *pointer;
+        case 2:
+            memcpy(&value16, pointer, 2);
+            return value16;
+        case 3:
+            #if SDL_BYTEORDER == SDL_BIG_ENDIAN
+            return (Uint32) pointer[0] << 16 | (Uint32) pointer[1] << 8 | pointer[2];
+            #else
+            return (Uint32) pointer[2] << 16 | (Uint32) pointer[1] << 8 | pointer[0];
+            #endif
+        default:
+            memcpy(&value32, pointer, 4);
+            return value32;
+    }
+}
+
+static inline void storePixel(Uint8* pointer, int bytes, Uint32 value) {
+    Uint16 value16 = (Uint16) value;
+    switch (bytes) {
+        case 1:
+            *pointer = (Uint8) value;
+            break;
+        case 2:
+            memcpy(pointer, &value16, 2);
+            break;
+        case 3:
+            #if SDL_BYTEORDER == SDL_BIG_ENDIAN
+            pointer[0] = (Uint8) (value >> 16);
+            pointer[1] = (Uint8) (value >> 8);
+            pointer[2] = (Uint8) value;
+            #else
+            pointer[0] = (Uint8) value;
+            pointer[1] = (Uint8) (value >> 8);
+            pointer[2] = (Uint8) (value >> 16);
+            #endif
+            break;
+        default:
+            memcpy(pointer, &value, 4);
+    }
+}
+
+static void copyRow(const PixelConversion* conversion, const Uint8* src, Uint8* dest, int width) {
+    memcpy(dest, src, (size_t) width * conversion->srcBytes);
+}
+
+#define DEFINE_SCALAR_KERNEL(srcBytes, destBytes) \
+static void convertRowScalar##srcBytes##To##destBytes(const PixelConversion* conversion, const Uint8* src,\
+                                                      Uint8* dest, int width) {\
+    int x;\
+    for (x = 0; x < width; x++) {\
+        storePixel(dest + x * destBytes, destBytes, applyTerms(conversion, loadPixel(src + x * srcBytes, srcBytes)));\
+    }\
+}
+
+#define DEFINE_SCALAR_KERNELS(srcBytes) \
+DEFINE_SCALAR_KERNEL(srcBytes, 1) DEFINE_SCALAR_KERNEL(srcBytes, 2)\
+DEFINE_SCALAR_KERNEL(srcBytes, 3) DEFINE_SCALAR_KERNEL(srcBytes, 4)
+
+DEFINE_SCALAR_KERNELS(1)
+DEFINE_SCALAR_KERNELS(2)
+DEFINE_SCALAR_KERNELS(3)
+DEFINE_SCALAR_KERNELS(4)
+
+#define SCALAR_KERNELS(srcBytes) {convertRowScalar##srcBytes##To1, convertRowScalar##srcBytes##To2,\
+                                  convertRowScalar##srcBytes##To3, convertRowScalar##srcBytes##To4}
+
+static const ConversionKernel scalarKernels[4][4] = {
+    SCALAR_KERNELS(1), SCALAR_KERNELS(2), SCALAR_KERNELS(3), SCALAR_KERNELS(4),
+};
+
+/*
+ * The vector kernels only exist for sources with 1, 2 or 4 and destinations with 2 or 4 bytes per pixel.
+ * Each vector holds one pixel per 32 bit lane, the remaining pixels of a row are converted by the
+ * scalar kernel.
+ */
+#define VECTOR_KERNEL_INDEX(srcBytes, destBytes) (((srcBytes) == 4 ? 2 : (srcBytes) - 1) * 2 + (destBytes) / 2 - 1)
+
+#define DEFINE_VECTOR_KERNEL(isa, attribute, vectorType, lanes, srcBytes, destBytes) \
+static attribute void convertRow##isa##srcBytes##To##destBytes(const PixelConversion* conversion,\
+                                                               const Uint8* src, Uint8* dest, int width) {\
+    isa##_SETUP(conversion);\
+    int x;\
+    for (x = 0; x + lanes <= width; x += lanes) {\
+        vectorType pixels = isa##_LOAD##srcBytes(src + x * srcBytes);\
+        vectorType result = isa##_CONSTANT;\
+        int i;\
+        for (i = 0; i < conversion->numTerms; i++) {\
+            result = isa##_OR(result, isa##_TERM(pixels, i));\
+        }\
+        isa##_STORE##destBytes(dest + x * destBytes, result);\
+    }\
+    scalarKernels[srcBytes - 1][destBytes - 1](conversion, src + x * srcBytes, dest + x * destBytes, width - x);\
+}
+
+#define DEFINE_VECTOR_KERNELS(isa, attribute, vectorType, lanes) \
+DEFINE_VECTOR_KERNEL(isa, attribute, vectorType, lanes, 1, 2)\
+DEFINE_VECTOR_KERNEL(isa, attribute, vectorType, lanes, 1, 4)\
+DEFINE_VECTOR_KERNEL(isa, attribute, vectorType, lanes, 2, 2)\
+DEFINE_VECTOR_KERNEL(isa, attribute, vectorType, lanes, 2, 4)\
+DEFINE_VECTOR_KERNEL(isa, attribute, vectorType, lanes, 4, 2)\
+DEFINE_VECTOR_KERNEL(isa, attribute, vectorType, lanes, 4, 4)\
+static const ConversionKernel isa##Kernels[6] = {\
+    convertRow##isa##1To2, convertRow##isa##1To4, convertRow##isa##2To2,\
+    convertRow##isa##2To4, convertRow##isa##4To2, convertRow##isa##4To4,\
+};
+
+#ifdef HAVE_SSE2_KERNELS
+#define SSE2_SETUP(conversion) \
+    __m128i sse2Masks[MAX_CONVERSION_TERMS], sse2Left[MAX_CONVERSION_TERMS], sse2Right[MAX_CONVERSION_TERMS];\
+    const __m128i sse2Constant = _mm_set1_epi32((int) conversion->constant);\
+    const __m128i sse2Zero = _mm_setzero_si128();\
+    (void) sse2Zero;\
+    do {\
+        int term;\
+        for (term = 0; term < conversion->numTerms; term++) {\
+            sse2Masks[term] = _mm_set1_epi32((int) conversion->terms[term].mask);\
+            sse2Left[term] = _mm_cvtsi32_si128(conversion->terms[term].leftShift);\
+            sse2Right[term] = _mm_cvtsi32_si128(conversion->terms[term].rightShift);\
+        }\
+    } while (0)
+#define SSE2_CONSTANT sse2Constant
+#define SSE2_OR(a, b) _mm_or_si128(a, b)
+#define SSE2_TERM(pixels, i) \
+    _mm_sll_epi32(_mm_srl_epi32(_mm_and_si128(pixels, sse2Masks[i]), sse2Right[i]), sse2Left[i])
+#define SSE2_LOAD1(pointer) \
+    _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int) loadPixel(pointer, 4)), sse2Zero), sse2Zero)
+#define SSE2_LOAD2(pointer) _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*) (pointer)), sse2Zero)
+#define SSE2_LOAD4(pointer) _mm_loadu_si128((const __m128i*) (pointer))
+// SSE2 can only pack with signed saturation, so the 16 bit values are sign extended first.
+#define SSE2_STORE2(pointer, pixels) _mm_storel_epi64((__m128i*) (pointer), _mm_packs_epi32(\
+    _mm_srai_epi32(_mm_slli_epi32(pixels, 16), 16), sse2Zero))
+#define SSE2_STORE4(pointer, pixels) _mm_storeu_si128((__m128i*) (pointer), pixels)
+
+DEFINE_VECTOR_KERNELS(SSE2, , __m128i, 4)
+#endif /* HAVE_SSE2_KERNELS */
+
+#ifdef HAVE_AVX2_KERNELS
+#define AVX2_SETUP(conversion) \
+    __m256i avx2Masks[MAX_CONVERSION_TERMS];\
+    __m128i avx2Left[MAX_CONVERSION_TERMS], avx2Right[MAX_CONVERSION_TERMS];\
+    const __m256i avx2Constant = _mm256_set1_epi32((int) conversion->constant);\
+    do {\
+        int term;\
+        for (term = 0; term < conversion->numTerms; term++) {\
+            avx2Masks[term] = _mm256_set1_epi32((int) conversion->terms[term].mask);\
+            avx2Left[term] = _mm_cvtsi32_si128(conversion->terms[term].leftShift);\
+            avx2Right[term] = _mm_cvtsi32_si128(conversion->terms[term].rightShift);\
+        }\
+    } while (0)
+#define AVX2_CONSTANT avx2Constant
+#define AVX2_OR(a, b) _mm256_or_si256(a, b)
+#define AVX2_TERM(pixels, i) \
+    _mm256_sll_epi32(_mm256_srl_epi32(_mm256_and_si256(pixels, avx2Masks[i]), avx2Right[i]), avx2Left[i])
+#define AVX2_LOAD1(pointer) _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) (pointer)))
+#define AVX2_LOAD2(pointer) _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) (pointer)))
+#define AVX2_LOAD4(pointer) _mm256_loadu_si256((const __m256i*) (pointer))
+// Packing works within the 128 bit halves, the permutation moves both results into the lower half.
+#define AVX2_STORE2(pointer, pixels) _mm_storeu_si128((__m128i*) (pointer), _mm256_castsi256_si128(\
+    _mm256_permute4x64_epi64(_mm256_packus_epi32(pixels, pixels), 0x08)))
+#define AVX2_STORE4(pointer, pixels) _mm256_storeu_si256((__m256i*) (pointer), pixels)
+
+DEFINE_VECTOR_KERNELS(AVX2, AVX2_FUNCTION, __m256i, 8)
+#endif /* HAVE_AVX2_KERNELS */
+
+#ifdef HAVE_NEON_KERNELS
+#define NEON_SETUP(conversion) \
+    uint32x4_t neonMasks[MAX_CONVERSION_TERMS];\
+    int32x4_t neonShifts[MAX_CONVERSION_TERMS];\
+    const uint32x4_t neonConstant = vdupq_n_u32(conversion->constant);\
+    do {\
+        int term;\
+        for (term = 0; term < conversion->numTerms; term++) {\
+            neonMasks[term] = vdupq_n_u32(conversion->terms[term].mask);\
+            neonShifts[term] = vdupq_n_s32(conversion->terms[term].leftShift - conversion->terms[term].rightShift);\
+        }\
+    } while (0)
+#define NEON_CONSTANT neonConstant
+#define NEON_OR(a, b) vorrq_u32(a, b)
+// Negative shifts of vshlq shift to the right.
+#define NEON_TERM(pixels, i) vshlq_u32(vandq_u32(pixels, neonMasks[i]), neonShifts[i])
+#define NEON_LOAD1(pointer) vmovl_u16(vget_low_u16(vmovl_u8(vcreate_u8((uint64_t) loadPixel(pointer, 4)))))
+#define NEON_LOAD2(pointer) vmovl_u16(vld1_u16((const uint16_t*) (pointer)))
+#define NEON_LOAD4(pointer) vld1q_u32((const uint32_t*) (pointer))
+#define NEON_STORE2(pointer, pixels) vst1_u16((uint16_t*) (pointer), vmovn_u32(pixels))
+#define NEON_STORE4(pointer, pixels) vst1q_u32((uint32_t*) (pointer), pixels)
+
+DEFINE_VECTOR_KERNELS(NEON, , uint32x4_t, 4)
+#endif /* HAVE_NEON_KERNELS */
+
+static void detectInstructionSet(void) {
+    instructionSet = SCALAR;
+    #ifdef HAVE_SSE2_KERNELS
+    if (SDL_HasSSE2()) instructionSet = SSE2;
+    #endif
+    #ifdef HAVE_AVX2_KERNELS
+    if (SDL_HasAVX2()) instructionSet = AVX2;
+    #endif
+    #ifdef HAVE_NEON_KERNELS
+    if (SDL_HasNEON()) instructionSet = NEON;
+    #endif
+    instructionSetDetected = True;
+    LOG("Using the %s pixel conversion kernels\n", instructionSet == AVX2 ? "AVX2" : instructionSet == SSE2 ?
+        "SSE2" : instructionSet == NEON ? "NEON" : "scalar");
+}
+
+/*
+ * Use the kernels of the instruction set for all conversions prepared afterwards, e.g. to compare
+ * them with the scalar kernels. Returns False if the kernels are not compiled in or the CPU doesn't
+ * support the instruction set.
+ */
+Bool usePixelConversionKernels(InstructionSet set) {
+    switch (set) {
+        case SCALAR: break;
+        #ifdef HAVE_SSE2_KERNELS
+        case SSE2: if (SDL_HasSSE2()) break; return False;
+        #endif
+        #ifdef HAVE_AVX2_KERNELS
+        case AVX2: if (SDL_HasAVX2()) break; return False;
+        #endif
+        #ifdef HAVE_NEON_KERNELS
+        case NEON: if (SDL_HasNEON()) break; return False;
+        #endif
+        default: return False;
+    }
+    instructionSet = set;
+    instructionSetDetected = True;
+    return True;
+}
+
+static ConversionKernel getKernel(int srcBytes, int destBytes) {
+    if ((srcBytes == 3 || destBytes % 2 != 0)) {
+        return scalarKernels[srcBytes - 1][destBytes - 1];
+    }
+    switch (instructionSet) {
+        #ifdef HAVE_SSE2_KERNELS
+        case SSE2: return SSE2Kernels[VECTOR_KERNEL_INDEX(srcBytes, destBytes)];
+        #endif
+        #ifdef HAVE_AVX2_KERNELS
+        case AVX2: return AVX2Kernels[VECTOR_KERNEL_INDEX(srcBytes, destBytes)];
+        #endif
+        #ifdef HAVE_NEON_KERNELS
+        case NEON: return NEONKernels[VECTOR_KERNEL_INDEX(srcBytes, destBytes)];
+        #endif
+        default: return scalarKernels[srcBytes - 1][destBytes - 1];
+    }
+}
+
+/*
+ * Prepare the conversion of pixels from the source to the destination layout. Channels without
+ * a mask in the source are 0, except for alpha, which is opaque. Returns False if the layouts are
+ * not supported or need more terms than a conversion can have.
+ */
+Bool initPixelConversion(PixelConversion* conversion, const PixelLayout* src, const PixelLayout* dest) {
+    if (!instructionSetDetected) {
+        detectInstructionSet();
+    }
+    if (src->bitsPerPixel % 8 != 0 || src->bitsPerPixel < 8 || src->bitsPerPixel > 32
+        || dest->bitsPerPixel % 8 != 0 || dest->bitsPerPixel < 8 || dest->bitsPerPixel > 32) {
+        return False;
+    }
+    conversion->srcBytes = src->bitsPerPixel / 8;
+    conversion->destBytes = dest->bitsPerPixel / 8;
+    conversion->numTerms = 0;
+    conversion->constant = src->alphaMask == 0 ? dest->alphaMask : 0;
+    if (memcmp(src, dest, sizeof(PixelLayout)) == 0) {
+        conversion->kernel = copyRow;
+        return True;
+    }
+    if (!addChannelTerms(conversion, src->redMask, dest->redMask)
+        || !addChannelTerms(conversion, src->greenMask, dest->greenMask)
+        || !addChannelTerms(conversion, src->blueMask, dest->blueMask)
+        || !addChannelTerms(conversion, src->alphaMask, dest->alphaMask)) {
+        return False;
+    }
+    if (src->byteOrder != HOST_BYTE_ORDER && conversion->srcBytes > 1
+        && !swapTerms(conversion, conversion->srcBytes, False)) {
+        return False;
+    }
+    if (dest->byteOrder != HOST_BYTE_ORDER && conversion->destBytes > 1) {
+        if (!swapTerms(conversion, conversion->destBytes, True)) return False;
+        conversion->constant = swapPixel(conversion->constant, conversion->destBytes);
+    }
+    conversion->kernel = getKernel(conversion->srcBytes, conversion->destBytes);
+    return True;
+}
+
+/*
+ * Convert the pixels of the source rows into the destination rows.
+ */
+void convertPixels(const PixelConversion* conversion, const void* src, int srcPitch, void* dest, int destPitch,
+                   int width, int height) {
+    int y;
+    for (y = 0; y < height; y++) {
+        conversion->kernel(conversion, (const Uint8*) src + y * srcPitch, (Uint8*) dest + y * destPitch, width);
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef _PIXEL_CONVERSION_H_
+#define _PIXEL_CONVERSION_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+
+/*
+ * Conversion of packed pixels between layouts with arbitrary channel masks, bits per pixel and
+ * byte orders, shared by all image paths. A conversion is prepared once for a pair of layouts:
+ * Every channel is compiled into a few mask and shift terms (byte swaps included, so no pixel is
+ * ever swapped separately), and the row kernel for the pixel sizes and the best instruction set
+ * of the CPU is picked. The kernels are specialized at compile time for each pair of pixel sizes;
+ * SSE2, AVX2 and NEON kernels convert 4 or 8 pixels at once, everything else uses the scalar ones.
+ */
+
+/* The instruction sets with specialized kernels. */
+typedef enum {SCALAR, SSE2, AVX2, NEON} InstructionSet;
+
+/* The maximum number of terms of a conversion. */
+#define MAX_CONVERSION_TERMS 24
+
+typedef struct {
+    /* 8, 16, 24 or 32. */
+    int bitsPerPixel;
+    /* The order of the bytes of a pixel in memory, LSBFirst or MSBFirst. */
+    int byteOrder;
+    Uint32 redMask, greenMask, blueMask;
+    /* 0 if the pixels have no alpha channel, they are opaque then. */
+    Uint32 alphaMask;
+} PixelLayout;
+
+typedef struct PixelConversion PixelConversion;
+typedef void (*ConversionKernel)(const PixelConversion* conversion, const Uint8* src, Uint8* dest, int width);
+
+typedef struct {
+    /* The bits of the source pixel which are moved by the shifts. */
+    Uint32 mask;
+    int rightShift, leftShift;
+} ConversionTerm;
+
+struct PixelConversion {
+    ConversionTerm terms[MAX_CONVERSION_TERMS];
+    int numTerms;
+    /* Bits which are set in every destination pixel. */
+    Uint32 constant;
+    int srcBytes, destBytes;
+    ConversionKernel kernel;
+};
+
+void getNativePixelLayout(PixelLayout* layout);
+Bool getFormatPixelLayout(Uint32 format, PixelLayout* layout);
+Bool initPixelConversion(PixelConversion* conversion, const PixelLayout* src, const PixelLayout* dest);
+Bool usePixelConversionKernels(InstructionSet set);
+void convertPixels(const PixelConversion* conversion, const void* src, int srcPitch, void* dest, int destPitch,
+                   int width, int height);
+
+#endif /* _PIXEL_CONVERSION_H_ */
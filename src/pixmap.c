@@ -1,8 +1,116 @@
+#include <string.h>
 #include "X11/Xlib.h"
+#include "pixmap.h"
+#include "bitmap.h"
 #include "drawing.h"
 #include "errors.h"
 #include "resourceTypes.h"
 #include "display.h"
+#include "scale.h"
+#include "renderThread.h"
+#include "texturePool.h"
+#include "damage.h"
+
+static void getMaxTextureSize(SDL_Renderer* renderer, int* maxWidth, int* maxHeight) {
+	SDL_RendererInfo info;
+	*maxWidth = *maxHeight = 0;
+	if (renderer != NULL && SDL_GetRendererInfo(renderer, &info) == 0) {
+		*maxWidth = info.max_texture_width;
+		*maxHeight = info.max_texture_height;
+	}
+}
+
+void getPixmapTileRect(Pixmap pixmap, int column, int row, SDL_Rect* rect) {
+	PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(pixmap);
+	rect->x = column * pixmapStruct->tileWidth;
+	rect->y = row * pixmapStruct->tileHeight;
+	rect->w = MIN(pixmapStruct->tileWidth, (int) pixmapStruct->width - rect->x);
+	rect->h = MIN(pixmapStruct->tileHeight, (int) pixmapStruct->height - rect->y);
+}
+
+/*
+ * Get the texture of a tile of the pixmap. If the tile was never drawn onto,
+ * it is only created if allocate is True, otherwise NULL is returned.
+ */
+SDL_Texture* getPixmapTile(Pixmap pixmap, int column, int row, Bool allocate) {
+	PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(pixmap);
+	if (pixmapStruct->depth == 1) {
+		return getBitmapTexture(pixmap, GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer);
+	}
+	SDL_Texture** tile = &pixmapStruct->tiles[row * pixmapStruct->columns + column];
+	if (*tile != NULL || !allocate) {
+		return *tile;
+	}
+	SDL_Rect rect;
+	SDL_Renderer* renderer = GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer;
+	getPixmapTileRect(pixmap, column, row, &rect);
+	// The tile may be larger than requested, reading is always limited to the tile rectangle.
+	*tile = acquireTexture(renderer, DEFAULT_TEXTURE_FORMAT, SDL_TEXTUREACCESS_TARGET,
+						   TO_DEVICE(rect.w), TO_DEVICE(rect.h));
+	if (*tile == NULL) {
+		LOG("acquireTexture failed in %s: %s\n", __func__, SDL_GetError());
+	}
+	return *tile;
+}
+
+/*
+ * Read the given area of the pixmap into a new surface, in device pixels (see scale.h).
+ * Tiles which were never drawn onto are not allocated and read as transparent black.
+ */
+SDL_Surface* getPixmapSurface(Pixmap pixmap, const SDL_Rect* area) {
+	PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(pixmap);
+	if (pixmapStruct->depth == 1) {
+		return getBitmapSurface(pixmap, area);
+	}
+	SDL_Renderer* renderer = GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer;
+	SDL_Rect pixmapRect = {0, 0, (int) pixmapStruct->width, (int) pixmapStruct->height};
+	SDL_Rect readRect, tileRect, intersection;
+	if (area == NULL) {
+		readRect = pixmapRect;
+	} else if (!SDL_IntersectRect(area, &pixmapRect, &readRect)) {
+		return NULL;
+	}
+	SDL_Rect deviceReadRect = readRect;
+	scaleRect(&deviceReadRect, DEVICE_SCALE);
+	SDL_Surface* surface = SDL_CreateRGBSurface(0, deviceReadRect.w, deviceReadRect.h, SDL_SURFACE_DEPTH,
+												DEFAULT_RED_MASK, DEFAULT_GREEN_MASK,
+												DEFAULT_BLUE_MASK, DEFAULT_ALPHA_MASK);
+	if (surface == NULL) {
+		LOG("SDL_CreateRGBSurface failed in %s: %s\n", __func__, SDL_GetError());
+		return NULL;
+	}
+	SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+	int column, row;
+	for (row = readRect.y / pixmapStruct->tileHeight;
+		 row < pixmapStruct->rows && row * pixmapStruct->tileHeight < readRect.y + readRect.h; row++) {
+		for (column = readRect.x / pixmapStruct->tileWidth; column < pixmapStruct->columns
+			 && column * pixmapStruct->tileWidth < readRect.x + readRect.w; column++) {
+			SDL_Texture* tile = getPixmapTile(pixmap, column, row, False);
+			getPixmapTileRect(pixmap, column, row, &tileRect);
+			if (tile == NULL || !SDL_IntersectRect(&readRect, &tileRect, &intersection)) {
+				continue;
+			}
+			scaleRect(&intersection, DEVICE_SCALE);
+			scaleRect(&tileRect, DEVICE_SCALE);
+			// Rounding to device pixels must neither leave the surface nor the tile.
+			if (!SDL_IntersectRect(&intersection, &deviceReadRect, &intersection)
+				|| !SDL_IntersectRect(&intersection, &tileRect, &intersection)) {
+				continue;
+			}
+			Uint8* pixels = (Uint8*) surface->pixels + (intersection.y - deviceReadRect.y) * surface->pitch
+							+ (intersection.x - deviceReadRect.x) * surface->format->BytesPerPixel;
+			intersection.x -= tileRect.x;
+			intersection.y -= tileRect.y;
+			SDL_SetRenderTarget(renderer, tile);
+			if (SDL_RenderReadPixels(renderer, &intersection, DEFAULT_TEXTURE_FORMAT,
+									 pixels, surface->pitch) != 0) {
+				LOG("SDL_RenderReadPixels failed in %s: %s\n", __func__, SDL_GetError());
+			}
+		}
+	}
+	SDL_SetRenderTarget(renderer, previousTarget);
+	return surface;
+}
 
 Pixmap XCreatePixmap(Display* display, Drawable drawable, unsigned int width, unsigned int height,
                      unsigned int depth) {
@@ -27,22 +135,55 @@ Pixmap XCreatePixmap(Display* display, Drawable drawable, unsigned int width, un
 		return None;
 	}
 	LOG("%s: addr= %lu, w = %d, h = %d\n", __func__, pixmap, width, height);
-	SDL_Texture* texture = SDL_CreateTexture(getWindowRenderer(SCREEN_WINDOW),
-											 SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
-											 (int) width, (int) height);
-	if (texture == NULL) {
-		fprintf(stderr, "SDL_CreateTexture failed in XCreatePixmap: %s\n", SDL_GetError());
+	PixmapStruct* pixmapStruct = malloc(sizeof(PixmapStruct));
+	if (pixmapStruct == NULL) {
+		LOG("Out of memory: Could not allocate the pixmap struct in XCreatePixmap!\n");
 		FREE_XID(pixmap);
 		handleOutOfMemory(0, display, 0, 0);
-		return NULL;
+		return None;
+	}
+	pixmapStruct->width = width;
+	pixmapStruct->height = height;
+	pixmapStruct->depth = depth;
+	pixmapStruct->tileWidth = (int) width;
+	pixmapStruct->tileHeight = (int) height;
+	pixmapStruct->tiles = NULL;
+	pixmapStruct->bits = NULL;
+	pixmapStruct->bitsTextures = NULL;
+	if (depth == 1) {
+		// Bitmaps are stored as packed bits and never need to be split.
+		pixmapStruct->columns = pixmapStruct->rows = 1;
+		if (!initBitmapStorage(pixmapStruct)) {
+			LOG("Out of memory: Could not allocate the bitmap storage in XCreatePixmap!\n");
+			free(pixmapStruct);
+			FREE_XID(pixmap);
+			handleOutOfMemory(0, display, 0, 0);
+			return None;
+		}
+		SET_XID_TYPE(pixmap, PIXMAP);
+		SET_XID_VALUE(pixmap, pixmapStruct);
+		return pixmap;
+	}
+	// Split the pixmap into tiles if it does not fit into a single texture.
+	// The textures are allocated in device pixels, the tile sizes are logical.
+	int maxWidth, maxHeight;
+	getMaxTextureSize(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer, &maxWidth, &maxHeight);
+	if ((maxWidth > 0 && TO_DEVICE(width) > maxWidth) || (maxHeight > 0 && TO_DEVICE(height) > maxHeight)) {
+		pixmapStruct->tileWidth = (int) ((maxWidth > 0 ? MIN(PIXMAP_TILE_SIZE, maxWidth) : PIXMAP_TILE_SIZE) / DEVICE_SCALE);
+		pixmapStruct->tileHeight = (int) ((maxHeight > 0 ? MIN(PIXMAP_TILE_SIZE, maxHeight) : PIXMAP_TILE_SIZE) / DEVICE_SCALE);
+	}
+	pixmapStruct->columns = ((int) width + pixmapStruct->tileWidth - 1) / pixmapStruct->tileWidth;
+	pixmapStruct->rows = ((int) height + pixmapStruct->tileHeight - 1) / pixmapStruct->tileHeight;
+	pixmapStruct->tiles = calloc((size_t) (pixmapStruct->columns * pixmapStruct->rows), sizeof(SDL_Texture*));
+	if (pixmapStruct->tiles == NULL) {
+		LOG("Out of memory: Could not allocate the tile list in XCreatePixmap!\n");
+		free(pixmapStruct);
+		FREE_XID(pixmap);
+		handleOutOfMemory(0, display, 0, 0);
+		return None;
 	}
 	SET_XID_TYPE(pixmap, PIXMAP);
-	SET_XID_VALUE(pixmap, texture);
-
-	SDL_Renderer* renderer;
-	GET_RENDERER(pixmap, renderer);
-	SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-	SDL_RenderClear(renderer);
+	SET_XID_VALUE(pixmap, pixmapStruct);
 	return pixmap;
 }
 
@@ -50,9 +191,20 @@ int XFreePixmap(Display* display, Pixmap pixmap) {
 	// https://tronche.com/gui/x/xlib/pixmap-and-cursor/XFreePixmap.html
 	SET_X_SERVER_REQUEST(display, X_FreePixmap);
 	TYPE_CHECK(pixmap, PIXMAP, display, 0);
-	SDL_Texture* texture = GET_PIXMAP_TEXTURE(pixmap);
-	free(pixmap);
-	SDL_DestroyTexture(texture);
+	syncRenderThread();
+	PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(pixmap);
+	int i;
+	detachDamage(pixmap);
+	if (pixmapStruct->depth == 1) {
+		freeBitmapStorage(pixmapStruct);
+	} else {
+		for (i = 0; i < pixmapStruct->columns * pixmapStruct->rows; i++) {
+			releaseTexture(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer, pixmapStruct->tiles[i]);
+		}
+		free(pixmapStruct->tiles);
+	}
+	free(pixmapStruct);
+	FREE_XID(pixmap);
 	return 1;
 }
 
@@ -60,37 +212,12 @@ Pixmap XCreateBitmapFromData(Display* display, Drawable d, _Xconst char* data,
 							 unsigned int width, unsigned int height) {
 	// https://tronche.com/gui/x/xlib/utilities/XCreateBitmapFromData.html
 	SET_X_SERVER_REQUEST(display, X_CreatePixmap);
-	XID pixmap = ALLOC_XID();
-	if (pixmap == None) {
-		LOG("Out of memory: Could not allocate XID in %s!\n", __func__);
-		handleOutOfMemory(0, display, BadAlloc, 0);
+	Pixmap bitmap = XCreatePixmap(display, d, width, height, 1);
+	if (bitmap == None) {
 		return None;
 	}
-
-	SDL_Renderer* renderer = NULL;
-	GET_RENDERER(d, renderer);
-	if (renderer == NULL) {
-		LOG("Failed to create renderer in %s: %s\n", __func__, SDL_GetError());
-		handleError(0, display, d, 0, BadDrawable, 0);
-		return 0;
-	}
-
-	SDL_Texture *image = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
-	if (image == NULL) {
-		LOG("SDL_CreateTextureFromSurface failed in %s: %s\n", __func__, SDL_GetError());
-		FREE_XID(pixmap);
-		handleOutOfMemory(0, display, BadAlloc, 0);
-		return None;
-	}
-
-	if (SDL_SetRenderTarget(renderer, image) < 0) {
-		LOG("SDL_SetRenderTarget failed in %s: %s\n", __func__, SDL_GetError());
-		FREE_XID(pixmap);
-		SDL_DestroyTexture(image);
-		handleOutOfMemory(0, display, BadAlloc, 0);
-		return None;
-	}
-	SET_XID_TYPE(pixmap, PIXMAP);
-	SET_XID_VALUE(pixmap, image);
-	return pixmap;
+	// The data have the same layout as the bits of the bitmap.
+	PixmapStruct* pixmapStruct = GET_PIXMAP_STRUCT(bitmap);
+	memcpy(pixmapStruct->bits, data, (size_t) pixmapStruct->bitsPitch * height);
+	return bitmap;
 }
@@ -0,0 +1,41 @@
+#ifndef _PIXMAP_H_
+#define _PIXMAP_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+#include "resourceTypes.h"
+
+/*
+ * The size of the tiles of a pixmap which is larger than the maximum texture size of the renderer.
+ * Pixmaps that fit into a single texture always consist of exactly one tile of their own size.
+ */
+#define PIXMAP_TILE_SIZE 1024
+
+struct BitmapTexture;
+
+typedef struct {
+    unsigned int width;
+    unsigned int height;
+    unsigned int depth;
+    /* The dimensions of a single tile, tiles at the right and bottom edges may be smaller. */
+    int tileWidth, tileHeight;
+    int columns, rows;
+    /* columns * rows textures, a tile is NULL until something is drawn onto it. */
+    SDL_Texture** tiles;
+    /* Depth 1 pixmaps have no tiles, their content is stored in these packed bits instead. */
+    Uint8* bits;
+    int bitsPitch;
+    /* Cached textures of the bits, one per renderer, see getBitmapTexture. */
+    struct BitmapTexture* bitsTextures;
+    /* Incremented whenever the bits change, cached textures of an older version are outdated. */
+    Uint32 bitsVersion;
+} PixmapStruct;
+
+#define GET_PIXMAP_STRUCT(pixmap) ((PixmapStruct*) GET_XID_VALUE(pixmap))
+#define IS_TILED_PIXMAP(pixmap) (GET_PIXMAP_STRUCT(pixmap)->columns * GET_PIXMAP_STRUCT(pixmap)->rows > 1)
+
+void getPixmapTileRect(Pixmap pixmap, int column, int row, SDL_Rect* rect);
+SDL_Texture* getPixmapTile(Pixmap pixmap, int column, int row, Bool allocate);
+SDL_Surface* getPixmapSurface(Pixmap pixmap, const SDL_Rect* area);
+
+#endif /* _PIXMAP_H_ */
@@ -4,6 +4,7 @@
 #include "window.h"
 #include "events.h"
 #include "display.h"
+#include "scale.h"
 
 unsigned int currentEventMask = ~0;
 Bool mouseFrozen = False;
@@ -20,6 +21,8 @@ int XWarpPointer(Display* display, Window src_window, Window dest_window, int sr
         #else
         SDL_GetMouseState(&curr_x, &curr_y);
         #endif
+        curr_x = TO_LOGICAL(curr_x);
+        curr_y = TO_LOGICAL(curr_y);
     } else {
         if (src_window == None || !(curr_x < src_x || curr_x > src_x + src_width ||
                 curr_y < src_y || curr_y > src_y + src_height)) {
@@ -29,17 +32,19 @@ int XWarpPointer(Display* display, Window src_window, Window dest_window, int sr
                 #else
                 SDL_GetMouseState(&curr_x, &curr_y);
                 #endif
+                curr_x = TO_LOGICAL(curr_x);
+                curr_y = TO_LOGICAL(curr_y);
             } else {
                 XTranslateCoordinates(display, SCREEN_WINDOW, dest_window, 0, 0, &curr_x, &curr_y, NULL);
             }
         }
     }
     #if SDL_VERSION_ATLEAST(2, 0, 4)
-    if (SDL_WarpMouseGlobal(curr_x + dest_x, curr_y + dest_y) != 0) {
+    if (SDL_WarpMouseGlobal(TO_DEVICE(curr_x + dest_x), TO_DEVICE(curr_y + dest_y)) != 0) {
         LOG("Warning: SDL_WarpMouseGlobal failed: %s", SDL_GetError());
     }
     #else
-    SDL_WarpMouseInWindow(SDL_GetMouseFocus(), curr_x + dest_x, curr_y + dest_y);
+    SDL_WarpMouseInWindow(SDL_GetMouseFocus(), TO_DEVICE(curr_x + dest_x), TO_DEVICE(curr_y + dest_y));
     #endif
     return 1;
 }
@@ -50,7 +55,7 @@ Bool XQueryPointer(Display* display, Window window, Window* root_return, Window*
     // https://tronche.com/gui/x/xlib/window-information/XQueryPointer.html
     SET_X_SERVER_REQUEST(display, X_QueryPointer);
     *root_return = SCREEN_WINDOW;
-    SDL_GetMouseState(root_x_return, root_y_return);
+    getLogicalMouseState(root_x_return, root_y_return);
     XTranslateCoordinates(display, SCREEN_WINDOW, window, *root_x_return, *root_y_return,
                           win_x_return, win_y_return, child_return);
     *mask_return = convertModifierState(SDL_GetModState());
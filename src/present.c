@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "present.h"
+#include "renderThread.h"
+#include "capture.h"
+#include "imageStream.h"
+#include "window.h"
+
+static Uint32 presentInterval = 1000 / DEFAULT_MAX_PRESENT_RATE;
+static Bool presentVSync = False;
+
+void initPresentConfig() {
+    char* maxPresentRate = getenv(MAX_PRESENT_RATE_ENV);
+    if (maxPresentRate != NULL) {
+        long rate = strtol(maxPresentRate, NULL, 10);
+        presentInterval = rate > 0 ? (Uint32) (1000 / MIN(rate, 1000)) : 0;
+    }
+    char* vSync = getenv(PRESENT_VSYNC_ENV);
+    if (vSync != NULL) {
+        presentVSync = strcmp(vSync, "1") == 0;
+    }
+    LOG("Presenting with a minimum interval of %u ms, vsync %s\n", presentInterval,
+        presentVSync ? "enabled" : "disabled");
+}
+
+/*
+ * The default minimum time between two presents of a window in milliseconds.
+ */
+Uint32 getPresentInterval() {
+    return presentInterval;
+}
+
+/*
+ * Add the present flags to the flags for a new renderer of a window.
+ */
+Uint32 getRendererFlags(Uint32 flags) {
+    if (isRenderThreadRequested()) {
+        // Only software renderers can be used on the render thread, see renderThread.h.
+        flags = (flags & ~SDL_RENDERER_ACCELERATED) | SDL_RENDERER_SOFTWARE;
+    }
+    return presentVSync ? flags | SDL_RENDERER_PRESENTVSYNC : flags;
+}
+
+/*
+ * Enable or disable presenting synchronized to the vertical refresh.
+ * Existing renderers are only changed if the SDL version supports it,
+ * otherwise the setting only applies to windows mapped afterwards.
+ */
+void setPresentVSync(Bool enabled) {
+    syncRenderThread();
+    presentVSync = enabled;
+    #if SDL_VERSION_ATLEAST(2, 0, 18)
+    Window* children = GET_CHILDREN(SCREEN_WINDOW);
+    size_t i;
+    for (i = 0; i < GET_WINDOW_STRUCT(SCREEN_WINDOW)->children.length; i++) {
+        WindowStruct* windowStruct = GET_WINDOW_STRUCT(children[i]);
+        if (windowStruct->sdlWindow != NULL && windowStruct->sdlRenderer != NULL) {
+            SDL_RenderSetVSync(windowStruct->sdlRenderer, enabled ? 1 : 0);
+        }
+    }
+    #endif
+}
+
+void setMaxPresentRate(Window window, unsigned int presentsPerSecond) {
+    GET_WINDOW_STRUCT(window)->presentInterval = presentsPerSecond > 0 ?
+                                                 1000 / MIN(presentsPerSecond, 1000) : 0;
+}
+
+/*
+ * Mark the content of the real window the window is shown in as changed since the last present.
+ */
+void markWindowContentChanged(Window window) {
+    while (GET_PARENT(window) != None && GET_WINDOW_STRUCT(window)->sdlWindow == NULL
+           && GET_WINDOW_STRUCT(window)->mapState != UnMapped) {
+        window = GET_PARENT(window);
+    }
+    if (window != SCREEN_WINDOW && GET_WINDOW_STRUCT(window)->sdlWindow != NULL) {
+        GET_WINDOW_STRUCT(window)->contentChanged = True;
+    }
+}
+
+static void presentChangedWindowsNow(void* forceData) {
+    Bool force = (Bool) (uintptr_t) forceData;
+    Window* children = GET_CHILDREN(SCREEN_WINDOW);
+    Uint32 now = SDL_GetTicks();
+    size_t i;
+    releaseIdleImageStreams();
+    for (i = 0; i < GET_WINDOW_STRUCT(SCREEN_WINDOW)->children.length; i++) {
+        WindowStruct* windowStruct = GET_WINDOW_STRUCT(children[i]);
+        if (!windowStruct->contentChanged || windowStruct->sdlRenderer == NULL) continue;
+        if (!force && now - windowStruct->lastPresentTicks < windowStruct->presentInterval) continue;
+        dumpPresentedFrame(children[i]);
+        presentFrontBuffer(children[i]);
+        SDL_RenderPresent(windowStruct->sdlRenderer);
+        windowStruct->contentChanged = False;
+        windowStruct->lastPresentTicks = now;
+    }
+}
+
+/*
+ * Present all top level windows whose content changed since their last present.
+ * Windows which were presented less than their present interval ago are skipped,
+ * unless force is True. With the render thread, this happens after the queued drawing requests.
+ */
+void presentChangedWindows(Bool force) {
+    enqueueRenderCommand(presentChangedWindowsNow, (void*) (uintptr_t) force);
+}
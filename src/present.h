@@ -0,0 +1,29 @@
+#ifndef _PRESENT_H_
+#define _PRESENT_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+
+/*
+ * Drawing only marks the window that owns the renderer as changed, the content is presented
+ * when the client flushes its requests (XFlush, XSync or waiting for an event).
+ * Windows without changes are never presented, and changed windows are presented at most
+ * with their maximum present rate, unless the client is about to wait for events:
+ * XNextEvent with an empty queue and XEventsQueued finding no events present them immediately.
+ */
+
+/* Environment variable with the default maximum number of presents per second, 0 means unlimited. */
+#define MAX_PRESENT_RATE_ENV "SDL2X11_MAX_PRESENT_RATE"
+/* Environment variable which enables presenting synchronized to the vertical refresh if set to 1. */
+#define PRESENT_VSYNC_ENV "SDL2X11_VSYNC"
+#define DEFAULT_MAX_PRESENT_RATE 60
+
+void initPresentConfig(void);
+Uint32 getPresentInterval(void);
+Uint32 getRendererFlags(Uint32 flags);
+void setPresentVSync(Bool enabled);
+void setMaxPresentRate(Window window, unsigned int presentsPerSecond);
+void markWindowContentChanged(Window window);
+void presentChangedWindows(Bool force);
+
+#endif /* _PRESENT_H_ */
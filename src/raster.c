@@ -0,0 +1,478 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "raster.h"
+#include "util.h"
+
+/*
+ * A flushed frame being rasterized. The tiles are handed out to the calling thread and
+ * the workers one at a time through nextTile, so fast threads take over the remaining
+ * tiles of slow ones.
+ */
+typedef struct {
+    RasterFrame* frame;
+    int tilesPerRow;
+    int* tiles; // The indices of all tiles with at least one command.
+    int numTiles;
+    size_t* binStart; // The commands of tile i are binCommands[binStart[i]] to binCommands[binStart[i + 1] - 1].
+    size_t* binCommands;
+    SDL_atomic_t nextTile;
+} RasterJob;
+
+static int numThreads = 1;
+static SDL_Thread** workers = NULL;
+static int numWorkers = 0;
+static SDL_mutex* poolMutex = NULL;
+static SDL_cond* workCondition = NULL;
+static SDL_cond* doneCondition = NULL;
+static RasterJob* currentJob = NULL;
+static Uint32 jobGeneration = 0;
+static int pendingWorkers = 0;
+static Bool shuttingDown = False;
+
+void initRasterizer() {
+    char* threads = getenv(RASTER_THREADS_ENV);
+    long count = threads != NULL ? strtol(threads, NULL, 10) : 0;
+    numThreads = count > 0 ? (int) count : SDL_GetCPUCount();
+    if (numThreads < 1) {
+        numThreads = 1;
+    }
+    LOG("Rasterizing with %d thread(s)\n", numThreads);
+}
+
+int getRasterThreadCount() {
+    return numThreads;
+}
+
+static void runRasterJob(RasterJob* job);
+
+static int rasterWorker(void* data) {
+    Uint32 seenGeneration = 0;
+    (void) data;
+    SDL_LockMutex(poolMutex);
+    while (True) {
+        while (!shuttingDown && seenGeneration == jobGeneration) {
+            SDL_CondWait(workCondition, poolMutex);
+        }
+        if (shuttingDown) break;
+        seenGeneration = jobGeneration;
+        RasterJob* job = currentJob;
+        SDL_UnlockMutex(poolMutex);
+        runRasterJob(job);
+        SDL_LockMutex(poolMutex);
+        if (--pendingWorkers == 0) {
+            SDL_CondSignal(doneCondition);
+        }
+    }
+    SDL_UnlockMutex(poolMutex);
+    return 0;
+}
+
+/*
+ * Start the worker threads, if they are not running yet.
+ * Returns False if they are not available, everything is rasterized on the calling thread then.
+ */
+static Bool startRasterWorkers() {
+    if (workers != NULL) return True;
+    poolMutex = SDL_CreateMutex();
+    workCondition = SDL_CreateCond();
+    doneCondition = SDL_CreateCond();
+    workers = malloc(sizeof(SDL_Thread*) * (numThreads - 1));
+    if (poolMutex == NULL || workCondition == NULL || doneCondition == NULL || workers == NULL) {
+        LOG("Failed to create the rasterizer thread pool: %s\n", SDL_GetError());
+        shutdownRasterizer();
+        numThreads = 1;
+        return False;
+    }
+    shuttingDown = False;
+    for (numWorkers = 0; numWorkers < numThreads - 1; numWorkers++) {
+        workers[numWorkers] = SDL_CreateThread(rasterWorker, "rasterizer", NULL);
+        if (workers[numWorkers] == NULL) {
+            LOG("Failed to create a rasterizer thread: %s\n", SDL_GetError());
+            break;
+        }
+    }
+    if (numWorkers == 0) {
+        shutdownRasterizer();
+        numThreads = 1;
+        return False;
+    }
+    return True;
+}
+
+void shutdownRasterizer() {
+    int i;
+    if (poolMutex != NULL) {
+        SDL_LockMutex(poolMutex);
+        shuttingDown = True;
+        SDL_CondBroadcast(workCondition);
+        SDL_UnlockMutex(poolMutex);
+    }
+    for (i = 0; i < numWorkers; i++) {
+        SDL_WaitThread(workers[i], NULL);
+    }
+    numWorkers = 0;
+    free(workers);
+    workers = NULL;
+    if (poolMutex != NULL) SDL_DestroyMutex(poolMutex);
+    if (workCondition != NULL) SDL_DestroyCond(workCondition);
+    if (doneCondition != NULL) SDL_DestroyCond(doneCondition);
+    poolMutex = NULL;
+    workCondition = doneCondition = NULL;
+}
+
+void initRasterFrame(RasterFrame* frame, void* pixels, int pitch, int width, int height, Bool packedBits) {
+    frame->pixels = pixels;
+    frame->pitch = pitch;
+    frame->width = width;
+    frame->height = height;
+    frame->packedBits = packedBits;
+    frame->commands = NULL;
+    frame->numCommands = 0;
+    frame->capacity = 0;
+}
+
+/*
+ * Append a command clipped to the frame. Returns NULL if it is outside of the frame
+ * (in which case the bounds are left untouched) or if there is not enough memory.
+ */
+static RasterCommand* addRasterCommand(RasterFrame* frame, RasterCommandType type, const SDL_Rect* bounds,
+                                       Uint32 value, Bool* outOfMemory) {
+    SDL_Rect frameRect = {0, 0, frame->width, frame->height}, clippedBounds;
+    *outOfMemory = False;
+    if (!SDL_IntersectRect(bounds, &frameRect, &clippedBounds)) {
+        return NULL;
+    }
+    if (frame->numCommands == frame->capacity) {
+        size_t capacity = frame->capacity == 0 ? 16 : frame->capacity * 2;
+        RasterCommand* commands = realloc(frame->commands, sizeof(RasterCommand) * capacity);
+        if (commands == NULL) {
+            *outOfMemory = True;
+            return NULL;
+        }
+        frame->commands = commands;
+        frame->capacity = capacity;
+    }
+    RasterCommand* command = &frame->commands[frame->numCommands++];
+    command->type = type;
+    command->bounds = clippedBounds;
+    command->value = value;
+    return command;
+}
+
+Bool rasterFillRectangles(RasterFrame* frame, const SDL_Rect* rectangles, int numRectangles, Uint32 value) {
+    Bool outOfMemory;
+    int i;
+    for (i = 0; i < numRectangles; i++) {
+        addRasterCommand(frame, RASTER_FILL_RECTANGLE, &rectangles[i], value, &outOfMemory);
+        if (outOfMemory) return False;
+    }
+    return True;
+}
+
+/*
+ * Fill the polygon with the given fill rule (EvenOddRule or WindingRule).
+ * A pixel is inside the polygon if its center is, the points are copied.
+ */
+Bool rasterFillPolygon(RasterFrame* frame, const RasterPoint* points, int numPoints, int fillRule, Uint32 value) {
+    Bool outOfMemory;
+    if (numPoints < 3) return True;
+    float minX = points[0].x, maxX = points[0].x, minY = points[0].y, maxY = points[0].y;
+    int i;
+    for (i = 1; i < numPoints; i++) {
+        minX = MIN(minX, points[i].x);
+        maxX = MAX(maxX, points[i].x);
+        minY = MIN(minY, points[i].y);
+        maxY = MAX(maxY, points[i].y);
+    }
+    SDL_Rect bounds;
+    bounds.x = (int) floorf(minX);
+    bounds.y = (int) floorf(minY);
+    bounds.w = (int) ceilf(maxX) - bounds.x;
+    bounds.h = (int) ceilf(maxY) - bounds.y;
+    RasterCommand* command = addRasterCommand(frame, RASTER_FILL_POLYGON, &bounds, value, &outOfMemory);
+    if (command == NULL) return !outOfMemory;
+    command->polygon.points = malloc(sizeof(RasterPoint) * numPoints);
+    if (command->polygon.points == NULL) {
+        frame->numCommands--;
+        return False;
+    }
+    memcpy(command->polygon.points, points, sizeof(RasterPoint) * numPoints);
+    command->polygon.numPoints = numPoints;
+    command->polygon.fillRule = fillRule;
+    return True;
+}
+
+/*
+ * Composite the surface onto the frame at the given position. Into an ARGB frame, the surface
+ * is blended over the pixels, into a packed bits frame, every pixel of the surface which is
+ * at least half opaque sets the value. The surface must stay valid until the frame is flushed.
+ */
+Bool rasterCompositeSurface(RasterFrame* frame, SDL_Surface* surface, int x, int y, Uint32 value) {
+    Bool outOfMemory;
+    SDL_Rect bounds = {x, y, surface->w, surface->h};
+    if (!frame->packedBits && surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+        LOG("%s: Unsupported surface format %s\n", __func__, SDL_GetPixelFormatName(surface->format->format));
+        return False;
+    }
+    RasterCommand* command = addRasterCommand(frame, RASTER_COMPOSITE_SURFACE, &bounds, value, &outOfMemory);
+    if (command == NULL) return !outOfMemory;
+    command->composite.surface = surface;
+    command->composite.x = x;
+    command->composite.y = y;
+    return True;
+}
+
+static void fillSpan(RasterFrame* frame, int y, int startX, int endX, Uint32 value) {
+    Uint8* row = frame->pixels + y * frame->pitch;
+    int x = startX;
+    if (frame->packedBits) {
+        // Set single bits until we reach a byte boundary, then whole bytes at once.
+        for (; x < endX && (x & 7) != 0; x++) {
+            if (value) row[x >> 3] |= 1 << (x & 7); else row[x >> 3] &= ~(1 << (x & 7));
+        }
+        if (endX - x >= 8) {
+            memset(&row[x >> 3], value ? 0xFF : 0x00, (size_t) (endX - x) >> 3);
+            x += (endX - x) & ~7;
+        }
+        for (; x < endX; x++) {
+            if (value) row[x >> 3] |= 1 << (x & 7); else row[x >> 3] &= ~(1 << (x & 7));
+        }
+    } else {
+        Uint32* pixels = (Uint32*) row;
+        for (; x < endX; x++) {
+            pixels[x] = value;
+        }
+    }
+}
+
+typedef struct {
+    float x;
+    int direction;
+} EdgeCrossing;
+
+static void rasterizePolygon(RasterFrame* frame, const RasterCommand* command, const SDL_Rect* clip,
+                             EdgeCrossing* crossings) {
+    const RasterPoint* points = command->polygon.points;
+    int numPoints = command->polygon.numPoints;
+    int y, i, j;
+    for (y = clip->y; y < clip->y + clip->h; y++) {
+        float centerY = y + 0.5f;
+        int numCrossings = 0;
+        for (i = 0; i < numPoints; i++) {
+            const RasterPoint* start = &points[i];
+            const RasterPoint* end = &points[(i + 1) % numPoints];
+            if (start->y == end->y) continue;
+            int direction = end->y > start->y ? 1 : -1;
+            float top = direction > 0 ? start->y : end->y, bottom = direction > 0 ? end->y : start->y;
+            if (centerY < top || centerY >= bottom) continue;
+            float x = start->x + (centerY - start->y) * (end->x - start->x) / (end->y - start->y);
+            // Insertion sort, polygons usually only have a few crossings per row.
+            for (j = numCrossings; j > 0 && crossings[j - 1].x > x; j--) {
+                crossings[j] = crossings[j - 1];
+            }
+            crossings[j].x = x;
+            crossings[j].direction = direction;
+            numCrossings++;
+        }
+        int winding = 0;
+        for (i = 0; i + 1 < numCrossings; i++) {
+            winding += crossings[i].direction;
+            Bool inside = command->polygon.fillRule == WindingRule ? winding != 0 : (i & 1) == 0;
+            if (!inside) continue;
+            // Fill all pixels whose center is within [crossings[i].x, crossings[i + 1].x).
+            int startX = MAX((int) ceilf(crossings[i].x - 0.5f), clip->x);
+            int endX = MIN((int) ceilf(crossings[i + 1].x - 0.5f), clip->x + clip->w);
+            if (startX < endX) {
+                fillSpan(frame, y, startX, endX, command->value);
+            }
+        }
+    }
+}
+
+static void compositeSurface(RasterFrame* frame, const RasterCommand* command, const SDL_Rect* clip) {
+    SDL_Surface* surface = command->composite.surface;
+    int x, y;
+    Uint8 r, g, b, a;
+    for (y = clip->y; y < clip->y + clip->h; y++) {
+        Uint8* sourceRow = (Uint8*) surface->pixels + (y - command->composite.y) * surface->pitch;
+        Uint8* row = frame->pixels + y * frame->pitch;
+        for (x = clip->x; x < clip->x + clip->w; x++) {
+            Uint8* pixel = sourceRow + (x - command->composite.x) * surface->format->BytesPerPixel;
+            if (frame->packedBits) {
+                Uint32 color;
+                switch (surface->format->BytesPerPixel) {
+                    case 1: color = *pixel; break;
+                    case 2: color = *(Uint16*) pixel; break;
+                    case 4: color = *(Uint32*) pixel; break;
+                    default: color = 0; break;
+                }
+                SDL_GetRGBA(color, surface->format, &r, &g, &b, &a);
+                if (a < 0x80) continue;
+                if (command->value) row[x >> 3] |= 1 << (x & 7); else row[x >> 3] &= ~(1 << (x & 7));
+            } else {
+                // Straight alpha source over.
+                Uint32 source = *(Uint32*) pixel, dest = ((Uint32*) row)[x];
+                Uint32 alpha = source >> 24, inverse = 255 - alpha;
+                if (alpha == 0) continue;
+                Uint32 destAlpha = (dest >> 24) * inverse / 255;
+                Uint32 outAlpha = alpha + destAlpha, result = outAlpha << 24;
+                int shift;
+                for (shift = 0; shift < 24; shift += 8) {
+                    Uint32 channel = (((source >> shift) & 0xFF) * alpha + ((dest >> shift) & 0xFF) * destAlpha)
+                                     / outAlpha;
+                    result |= channel << shift;
+                }
+                ((Uint32*) row)[x] = result;
+            }
+        }
+    }
+}
+
+static void rasterizeTile(RasterJob* job, int tile, EdgeCrossing* crossings) {
+    RasterFrame* frame = job->frame;
+    SDL_Rect tileRect = {(tile % job->tilesPerRow) * RASTER_TILE_SIZE, (tile / job->tilesPerRow) * RASTER_TILE_SIZE,
+                         RASTER_TILE_SIZE, RASTER_TILE_SIZE}, clip;
+    size_t i;
+    for (i = job->binStart[tile]; i < job->binStart[tile + 1]; i++) {
+        const RasterCommand* command = &frame->commands[job->binCommands[i]];
+        if (!SDL_IntersectRect(&command->bounds, &tileRect, &clip)) continue;
+        switch (command->type) {
+            case RASTER_FILL_RECTANGLE: {
+                int y;
+                for (y = clip.y; y < clip.y + clip.h; y++) {
+                    fillSpan(frame, y, clip.x, clip.x + clip.w, command->value);
+                }
+                break;
+            }
+            case RASTER_FILL_POLYGON:
+                rasterizePolygon(frame, command, &clip, crossings);
+                break;
+            case RASTER_COMPOSITE_SURFACE:
+                compositeSurface(frame, command, &clip);
+                break;
+        }
+    }
+}
+
+static void runRasterJob(RasterJob* job) {
+    RasterFrame* frame = job->frame;
+    int maxPoints = 0, tile;
+    size_t i;
+    for (i = 0; i < frame->numCommands; i++) {
+        if (frame->commands[i].type == RASTER_FILL_POLYGON) {
+            maxPoints = MAX(maxPoints, frame->commands[i].polygon.numPoints);
+        }
+    }
+    EdgeCrossing* crossings = NULL;
+    if (maxPoints > 0 && (crossings = malloc(sizeof(EdgeCrossing) * maxPoints)) == NULL) {
+        LOG("Out of memory in %s\n", __func__);
+        return;
+    }
+    while ((tile = SDL_AtomicAdd(&job->nextTile, 1)) < job->numTiles) {
+        rasterizeTile(job, job->tiles[tile], crossings);
+    }
+    free(crossings);
+}
+
+/*
+ * Rasterize all commands recorded into the frame and remove them.
+ * Returns False if there was not enough memory to bin the commands.
+ */
+Bool flushRasterFrame(RasterFrame* frame) {
+    Bool res = True;
+    if (frame->numCommands == 0) return True;
+    RasterJob job;
+    job.frame = frame;
+    job.tilesPerRow = (frame->width + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE;
+    int totalTiles = job.tilesPerRow * ((frame->height + RASTER_TILE_SIZE - 1) / RASTER_TILE_SIZE);
+    int tile, column, row;
+    size_t i;
+    job.binStart = calloc((size_t) totalTiles + 1, sizeof(size_t));
+    job.tiles = malloc(sizeof(int) * totalTiles);
+    job.binCommands = NULL;
+    if (job.binStart == NULL || job.tiles == NULL) {
+        res = False;
+        goto cleanup;
+    }
+    // Count the commands of each tile, then place them in recording order,
+    // so every tile executes its commands in painter's order.
+    for (i = 0; i < frame->numCommands; i++) {
+        const SDL_Rect* bounds = &frame->commands[i].bounds;
+        for (row = bounds->y / RASTER_TILE_SIZE; row <= (bounds->y + bounds->h - 1) / RASTER_TILE_SIZE; row++) {
+            for (column = bounds->x / RASTER_TILE_SIZE;
+                 column <= (bounds->x + bounds->w - 1) / RASTER_TILE_SIZE; column++) {
+                job.binStart[row * job.tilesPerRow + column + 1]++;
+            }
+        }
+    }
+    job.numTiles = 0;
+    for (tile = 0; tile < totalTiles; tile++) {
+        if (job.binStart[tile + 1] != 0) {
+            job.tiles[job.numTiles++] = tile;
+        }
+        job.binStart[tile + 1] += job.binStart[tile];
+    }
+    job.binCommands = malloc(sizeof(size_t) * job.binStart[totalTiles]);
+    if (job.binCommands == NULL) {
+        res = False;
+        goto cleanup;
+    }
+    size_t* binEnd = job.binStart; // Reuse the start offsets as insert positions, shifted by one tile.
+    for (i = 0; i < frame->numCommands; i++) {
+        const SDL_Rect* bounds = &frame->commands[i].bounds;
+        for (row = bounds->y / RASTER_TILE_SIZE; row <= (bounds->y + bounds->h - 1) / RASTER_TILE_SIZE; row++) {
+            for (column = bounds->x / RASTER_TILE_SIZE;
+                 column <= (bounds->x + bounds->w - 1) / RASTER_TILE_SIZE; column++) {
+                job.binCommands[binEnd[row * job.tilesPerRow + column]++] = i;
+            }
+        }
+    }
+    // Every insert position now is the end of its tile, which is the start of the next one.
+    memmove(&job.binStart[1], &job.binStart[0], sizeof(size_t) * totalTiles);
+    job.binStart[0] = 0;
+    SDL_AtomicSet(&job.nextTile, 0);
+    if (numThreads > 1 && job.numTiles > 1 && startRasterWorkers()) {
+        SDL_LockMutex(poolMutex);
+        currentJob = &job;
+        jobGeneration++;
+        pendingWorkers = numWorkers;
+        SDL_CondBroadcast(workCondition);
+        SDL_UnlockMutex(poolMutex);
+        runRasterJob(&job);
+        SDL_LockMutex(poolMutex);
+        while (pendingWorkers > 0) {
+            SDL_CondWait(doneCondition, poolMutex);
+        }
+        currentJob = NULL;
+        SDL_UnlockMutex(poolMutex);
+    } else {
+        runRasterJob(&job);
+    }
+cleanup:
+    if (!res) {
+        LOG("Out of memory in %s\n", __func__);
+    }
+    free(job.binStart);
+    free(job.tiles);
+    free(job.binCommands);
+    for (i = 0; i < frame->numCommands; i++) {
+        if (frame->commands[i].type == RASTER_FILL_POLYGON) {
+            free(frame->commands[i].polygon.points);
+        }
+    }
+    frame->numCommands = 0;
+    return res;
+}
+
+void freeRasterFrame(RasterFrame* frame) {
+    size_t i;
+    for (i = 0; i < frame->numCommands; i++) {
+        if (frame->commands[i].type == RASTER_FILL_POLYGON) {
+            free(frame->commands[i].polygon.points);
+        }
+    }
+    free(frame->commands);
+    frame->commands = NULL;
+    frame->numCommands = frame->capacity = 0;
+}
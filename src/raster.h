@@ -0,0 +1,71 @@
+#ifndef _RASTER_H_
+#define _RASTER_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+
+/*
+ * Software rasterizer for drawing into system memory (bitmaps and temporary surfaces).
+ * Draw commands are recorded into a frame and rasterized when the frame is flushed:
+ * The target is split into tiles of RASTER_TILE_SIZE pixels, every command is binned
+ * into the tiles it touches and the tiles are rasterized in parallel by a pool of worker threads.
+ * Within a tile, the commands are executed in the order they were recorded.
+ */
+
+/* Environment variable with the number of rasterizer threads including the calling thread.
+ * 0 or unset uses one thread per CPU, 1 rasterizes everything deterministically on the calling thread. */
+#define RASTER_THREADS_ENV "SDL2X11_RASTER_THREADS"
+/* Must be a multiple of 8, so the tiles of a packed bits target never share a byte. */
+#define RASTER_TILE_SIZE 64
+
+typedef struct {
+    float x, y;
+} RasterPoint;
+
+typedef enum {
+    RASTER_FILL_RECTANGLE,
+    RASTER_FILL_POLYGON,
+    RASTER_COMPOSITE_SURFACE,
+} RasterCommandType;
+
+typedef struct {
+    RasterCommandType type;
+    SDL_Rect bounds;
+    Uint32 value;
+    union {
+        struct {
+            RasterPoint* points;
+            int numPoints;
+            int fillRule;
+        } polygon;
+        struct {
+            SDL_Surface* surface;
+            int x, y;
+        } composite;
+    };
+} RasterCommand;
+
+typedef struct {
+    Uint8* pixels;
+    int pitch;
+    int width;
+    int height;
+    // If True, the pixels are packed bits (see bitmap.h) and the values are 0 or 1,
+    // otherwise they are ARGB8888 pixels.
+    Bool packedBits;
+    RasterCommand* commands;
+    size_t numCommands;
+    size_t capacity;
+} RasterFrame;
+
+void initRasterizer(void);
+void shutdownRasterizer(void);
+int getRasterThreadCount(void);
+void initRasterFrame(RasterFrame* frame, void* pixels, int pitch, int width, int height, Bool packedBits);
+Bool rasterFillRectangles(RasterFrame* frame, const SDL_Rect* rectangles, int numRectangles, Uint32 value);
+Bool rasterFillPolygon(RasterFrame* frame, const RasterPoint* points, int numPoints, int fillRule, Uint32 value);
+Bool rasterCompositeSurface(RasterFrame* frame, SDL_Surface* surface, int x, int y, Uint32 value);
+Bool flushRasterFrame(RasterFrame* frame);
+void freeRasterFrame(RasterFrame* frame);
+
+#endif /* _RASTER_H_ */
@@ -17,6 +17,7 @@ typedef struct pixman_region16* pRegion;
 int XDestroyRegion(Region region) {
     // https://tronche.com/gui/x/xlib/utilities/regions/XDestroyRegion.html
     pixman_region_fini(GET_P_REGION(region));
+    free(region);
     return 1;
 }
 
@@ -69,6 +70,11 @@ int XIntersectRegion(Region sra, Region srb, Region dr_return) {
     return pixman_region_intersect(GET_P_REGION(dr_return), GET_P_REGION(sra), GET_P_REGION(srb)) ? 1 : 0;
 }
 
+int XUnionRegion(Region sra, Region srb, Region dr_return) {
+    // https://tronche.com/gui/x/xlib/utilities/regions/XUnionRegion.html
+    return pixman_region_union(GET_P_REGION(dr_return), GET_P_REGION(sra), GET_P_REGION(srb)) ? 1 : 0;
+}
+
 int XSubtractRegion(Region sra, Region srb, Region dr_return) {
     // https://tronche.com/gui/x/xlib/utilities/regions/XSubtractRegion.html
     return pixman_region_subtract(GET_P_REGION(dr_return), GET_P_REGION(sra), GET_P_REGION(srb)) ? 1 : 0;
@@ -80,6 +86,12 @@ int XUnionRectWithRegion(XRectangle *rectangle, Region src_region, Region dest_r
                                     rectangle->x, rectangle->y, rectangle->width, rectangle->height) ? 1 : 0;
 }
 
+int XOffsetRegion(Region region, int dx, int dy) {
+    // https://tronche.com/gui/x/xlib/utilities/regions/XOffsetRegion.html
+    pixman_region_translate(GET_P_REGION(region), dx, dy);
+    return 1;
+}
+
 int XSetRegion(Display* display, GC gc, Region region) {
     // https://tronche.com/gui/x/xlib/utilities/regions/XSetRegion.html
     pixman_box16_t* extends = pixman_region_extents(GET_P_REGION(region));
@@ -0,0 +1,240 @@
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "renderThread.h"
+#include "resourceTypes.h"
+#include "gc.h"
+#include "util.h"
+
+typedef struct {
+    RenderFunction function;
+    void* data;
+} RenderCommand;
+
+/*
+ * A queued drawing request. The graphic context is copied when the request is queued,
+ * so later changes of the client don't affect it. The arguments of the request follow.
+ */
+typedef struct {
+    DeferredDrawFunction function;
+    Display* display;
+    Drawable drawable;
+    struct _XGC gc;
+    XID_Struct gcId;
+    GraphicContext gcValues;
+    union {
+        long long integer;
+        double floatingPoint;
+        void* pointer;
+    } args[];
+} DeferredDraw;
+
+static Bool enabled = False;
+static SDL_Thread* renderThread = NULL;
+static SDL_threadID renderThreadId = 0;
+// Single producer (the client thread), single consumer (the render thread) ring.
+static RenderCommand queue[RENDER_QUEUE_SIZE];
+static Uint32 queueHead = 0;
+static Uint32 queueTail = 0;
+static SDL_sem* queuedCommands = NULL;
+static SDL_sem* freeSlots = NULL;
+static Uint32 lastFence = 0;
+static Uint32 completedFence = 0;
+static SDL_mutex* fenceMutex = NULL;
+static SDL_cond* fenceCondition = NULL;
+
+static int renderThreadMain(void* data) {
+    (void) data;
+    while (True) {
+        SDL_SemWait(queuedCommands);
+        RenderCommand command = queue[queueTail];
+        queueTail = (queueTail + 1) & (RENDER_QUEUE_SIZE - 1);
+        SDL_SemPost(freeSlots);
+        if (command.function == NULL) break;
+        command.function(command.data);
+    }
+    return 0;
+}
+
+/*
+ * Check if the render thread was requested. If so, all renderers must be software renderers.
+ */
+Bool isRenderThreadRequested() {
+    char* renderThreadEnv = getenv(RENDER_THREAD_ENV);
+    return renderThreadEnv != NULL && strcmp(renderThreadEnv, "1") == 0;
+}
+
+/*
+ * Start the render thread if it was requested and the renderer of the screen window,
+ * which renders all pixmaps, is a software renderer.
+ */
+void initRenderThread(SDL_Renderer* screenRenderer) {
+    if (!isRenderThreadRequested() || enabled) {
+        return;
+    }
+    SDL_RendererInfo info;
+    if (screenRenderer == NULL || SDL_GetRendererInfo(screenRenderer, &info) != 0
+        || (info.flags & SDL_RENDERER_SOFTWARE) == 0) {
+        LOG("The render thread requires the software renderer, rendering on the calling thread\n");
+        return;
+    }
+    queuedCommands = SDL_CreateSemaphore(0);
+    freeSlots = SDL_CreateSemaphore(RENDER_QUEUE_SIZE);
+    fenceMutex = SDL_CreateMutex();
+    fenceCondition = SDL_CreateCond();
+    if (queuedCommands != NULL && freeSlots != NULL && fenceMutex != NULL && fenceCondition != NULL) {
+        queueHead = queueTail = 0;
+        renderThread = SDL_CreateThread(renderThreadMain, "render", NULL);
+    }
+    if (renderThread == NULL) {
+        LOG("Failed to start the render thread, rendering on the calling thread: %s\n", SDL_GetError());
+        stopRenderThread();
+        return;
+    }
+    renderThreadId = SDL_GetThreadID(renderThread);
+    enabled = True;
+    LOG("Rendering on a separate thread\n");
+}
+
+/*
+ * Execute all queued requests and stop the render thread.
+ */
+void stopRenderThread() {
+    if (renderThread != NULL) {
+        SDL_SemWait(freeSlots);
+        queue[queueHead].function = NULL;
+        queueHead = (queueHead + 1) & (RENDER_QUEUE_SIZE - 1);
+        SDL_SemPost(queuedCommands);
+        SDL_WaitThread(renderThread, NULL);
+        renderThread = NULL;
+    }
+    enabled = False;
+    if (queuedCommands != NULL) SDL_DestroySemaphore(queuedCommands);
+    if (freeSlots != NULL) SDL_DestroySemaphore(freeSlots);
+    if (fenceMutex != NULL) SDL_DestroyMutex(fenceMutex);
+    if (fenceCondition != NULL) SDL_DestroyCond(fenceCondition);
+    queuedCommands = freeSlots = NULL;
+    fenceMutex = NULL;
+    fenceCondition = NULL;
+}
+
+Bool isRenderThreadEnabled() {
+    return enabled;
+}
+
+Bool isRenderThread() {
+    return enabled && SDL_ThreadID() == renderThreadId;
+}
+
+/*
+ * Execute the function with the data on the render thread, after all previously queued requests.
+ * The function is responsible for freeing the data. If the render thread is disabled, or this
+ * is called from the render thread, the function is executed immediately.
+ * Blocks if the queue is full.
+ */
+Bool enqueueRenderCommand(RenderFunction function, void* data) {
+    if (!enabled || isRenderThread()) {
+        function(data);
+        return True;
+    }
+    SDL_SemWait(freeSlots);
+    queue[queueHead].function = function;
+    queue[queueHead].data = data;
+    queueHead = (queueHead + 1) & (RENDER_QUEUE_SIZE - 1);
+    SDL_SemPost(queuedCommands);
+    return True;
+}
+
+static void signalRenderFence(void* fence) {
+    SDL_LockMutex(fenceMutex);
+    completedFence = (Uint32) (uintptr_t) fence;
+    SDL_CondBroadcast(fenceCondition);
+    SDL_UnlockMutex(fenceMutex);
+}
+
+/*
+ * Insert a fence after all queued requests. The returned fence can be passed to waitForRenderFence.
+ */
+Uint32 insertRenderFence() {
+    if (!enabled || isRenderThread()) {
+        return 0;
+    }
+    Uint32 fence = ++lastFence;
+    enqueueRenderCommand(signalRenderFence, (void*) (uintptr_t) fence);
+    return fence;
+}
+
+/*
+ * Block until the render thread executed all requests queued before the fence was inserted.
+ */
+void waitForRenderFence(Uint32 fence) {
+    if (fence == 0 || !enabled) return;
+    SDL_LockMutex(fenceMutex);
+    // The fence counter may wrap around, compare the distance instead of the values.
+    while ((Sint32) (completedFence - fence) < 0) {
+        SDL_CondWait(fenceCondition, fenceMutex);
+    }
+    SDL_UnlockMutex(fenceMutex);
+}
+
+/*
+ * Check whether the render thread executed all requests queued before the fence was inserted.
+ */
+Bool isRenderFenceCompleted(Uint32 fence) {
+    if (fence == 0 || !enabled) return True;
+    SDL_LockMutex(fenceMutex);
+    Bool completed = (Sint32) (completedFence - fence) >= 0;
+    SDL_UnlockMutex(fenceMutex);
+    return completed;
+}
+
+/*
+ * Wait until all queued requests have been executed. Must be called before anything that uses
+ * the renderers, reads pixels or changes state the queued requests depend on.
+ */
+void syncRenderThread() {
+    waitForRenderFence(insertRenderFence());
+}
+
+static void executeDeferredDraw(void* data) {
+    DeferredDraw* draw = data;
+    draw->function(draw->display, draw->drawable, draw->gcId.dataPointer != NULL ? &draw->gc : NULL, draw->args);
+    free(draw);
+}
+
+/*
+ * Start queueing a drawing request with the given size of its arguments.
+ * Returns the buffer for the arguments, which must be passed to submitDeferredDraw
+ * once they are filled in. The function is called on the render thread with a copy of the
+ * graphic context and the arguments. Returns NULL if the request should be executed
+ * immediately instead, because the render thread is disabled or there is not enough memory.
+ */
+void* beginDeferredDraw(Display* display, Drawable drawable, GC gc, DeferredDrawFunction function,
+                        size_t argsSize) {
+    if (!enabled || isRenderThread()) {
+        return NULL;
+    }
+    DeferredDraw* draw = malloc(offsetof(DeferredDraw, args) + argsSize);
+    if (draw == NULL) {
+        LOG("Out of memory in %s, drawing synchronously\n", __func__);
+        syncRenderThread();
+        return NULL;
+    }
+    draw->function = function;
+    draw->display = display;
+    draw->drawable = drawable;
+    draw->gcId.dataPointer = NULL;
+    if (gc != NULL) {
+        draw->gcValues = *GET_GC(gc);
+        draw->gcId.type = GRAPHICS_CONTEXT;
+        draw->gcId.dataPointer = &draw->gcValues;
+        draw->gc.ext_data = NULL;
+        draw->gc.gid = (GContext) &draw->gcId;
+    }
+    return draw->args;
+}
+
+void submitDeferredDraw(void* args) {
+    enqueueRenderCommand(executeDeferredDraw, (char*) args - offsetof(DeferredDraw, args));
+}
@@ -0,0 +1,40 @@
+#ifndef _RENDER_THREAD_H_
+#define _RENDER_THREAD_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+
+/*
+ * Optional render thread. If enabled, the drawing requests of the client (fills, lines, copies,
+ * text and presents) are validated on the calling thread and then queued to the render thread,
+ * which executes them in order. Everything else that uses the renderers or changes the
+ * window hierarchy first waits for the queued requests with syncRenderThread.
+ * Events are still handled on the calling thread, errors of the queued requests are
+ * reported to the error handler on the calling thread by postRenderErrors.
+ * Hardware renderers are bound to the thread that created them, so all renderers are
+ * software renderers while the render thread is requested and it is off by default.
+ */
+
+/* Environment variable which enables the render thread if set to 1. */
+#define RENDER_THREAD_ENV "SDL2X11_RENDER_THREAD"
+/* The number of requests which can be queued before the client has to wait, must be a power of two. */
+#define RENDER_QUEUE_SIZE 1024
+
+typedef void (*RenderFunction)(void* data);
+typedef void (*DeferredDrawFunction)(Display* display, Drawable drawable, GC gc, void* args);
+
+Bool isRenderThreadRequested(void);
+void initRenderThread(SDL_Renderer* screenRenderer);
+void stopRenderThread(void);
+Bool isRenderThreadEnabled(void);
+Bool isRenderThread(void);
+Bool enqueueRenderCommand(RenderFunction function, void* data);
+Uint32 insertRenderFence(void);
+void waitForRenderFence(Uint32 fence);
+Bool isRenderFenceCompleted(Uint32 fence);
+void syncRenderThread(void);
+void* beginDeferredDraw(Display* display, Drawable drawable, GC gc, DeferredDrawFunction function,
+                        size_t argsSize);
+void submitDeferredDraw(void* args);
+
+#endif /* _RENDER_THREAD_H_ */
@@ -2,7 +2,9 @@
 #define _RESOURCE_TYPES_H_
 
 typedef enum {WINDOW = 1, DRAWABLE = 2, PIXMAP = 3,
-    GRAPHICS_CONTEXT = 4, FONT = 5, CURSOR = 6} XResourceType;
+    GRAPHICS_CONTEXT = 4, FONT = 5, CURSOR = 6, BACK_BUFFER = 7,
+    PICTURE = 8, GLYPH_SET = 9, SERVER_REGION = 10, DAMAGE = 11,
+    SYNC_COUNTER = 12, SHM_SEGMENT = 13} XResourceType;
 
 typedef struct {
     XResourceType type;
@@ -25,7 +27,7 @@ typedef struct {
 #define IS_TYPE(resource, typeID) (resource != None && (\
     GET_XID_TYPE(resource) == typeID || (\
         typeID == DRAWABLE && (\
-            GET_XID_TYPE(resource) == PIXMAP || (\
+            GET_XID_TYPE(resource) == PIXMAP || GET_XID_TYPE(resource) == BACK_BUFFER || (\
                 GET_XID_TYPE(resource) == WINDOW && !IS_INPUT_ONLY(resource)\
             )\
         )\
@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include <string.h>
+#include "scale.h"
+#include "util.h"
+
+float DEVICE_SCALE = 1.0f;
+
+void initDeviceScale(int displayIndex) {
+    char* scale = getenv(DEVICE_SCALE_ENV);
+    if (scale == NULL) return;
+    if (strcmp(scale, "auto") == 0) {
+        #if SDL_VERSION_ATLEAST(2, 0, 4)
+        float diagonalDpi;
+        if (SDL_GetDisplayDPI(displayIndex, &diagonalDpi, NULL, NULL) != 0) {
+            LOG("Failed to get the display DPI for the device scale: %s\n", SDL_GetError());
+            return;
+        }
+        // Round to quarters, so that common scales like 1.5 and 2 are exact.
+        DEVICE_SCALE = roundf(diagonalDpi / BASE_DPI * 4.0f) / 4.0f;
+        #endif
+    } else {
+        DEVICE_SCALE = strtof(scale, NULL);
+    }
+    if (!(DEVICE_SCALE >= 1.0f)) {
+        DEVICE_SCALE = 1.0f;
+    }
+    LOG("Using a device scale of %f\n", DEVICE_SCALE);
+}
+
+/*
+ * Scale the rectangle, e.g. to convert it from logical pixels to the pixels of a render target.
+ */
+void scaleRect(SDL_Rect* rect, float scale) {
+    if (scale == 1.0f) return;
+    int right = (int) ceilf((rect->x + rect->w) * scale);
+    int bottom = (int) ceilf((rect->y + rect->h) * scale);
+    rect->x = (int) floorf(rect->x * scale);
+    rect->y = (int) floorf(rect->y * scale);
+    rect->w = right - rect->x;
+    rect->h = bottom - rect->y;
+}
+
+/*
+ * Get the position of the mouse in the focused window in logical pixels.
+ */
+Uint32 getLogicalMouseState(int* x, int* y) {
+    int deviceX, deviceY;
+    Uint32 buttons = SDL_GetMouseState(&deviceX, &deviceY);
+    if (x != NULL) *x = TO_LOGICAL(deviceX);
+    if (y != NULL) *y = TO_LOGICAL(deviceY);
+    return buttons;
+}
+
+/*
+ * Convert a surface which was read back from a render target in device pixels to the given
+ * logical size, for everything that exposes pixels to the client. If the sizes already match,
+ * the surface is returned as is, otherwise it is freed and the scaled surface is returned.
+ */
+SDL_Surface* getLogicalSurface(SDL_Surface* deviceSurface, int width, int height) {
+    if (deviceSurface == NULL || (deviceSurface->w == width && deviceSurface->h == height)) {
+        return deviceSurface;
+    }
+    SDL_Surface* surface = SDL_CreateRGBSurface(0, width, height, deviceSurface->format->BitsPerPixel,
+                                                deviceSurface->format->Rmask, deviceSurface->format->Gmask,
+                                                deviceSurface->format->Bmask, deviceSurface->format->Amask);
+    if (surface == NULL) {
+        LOG("SDL_CreateRGBSurface failed in %s: %s\n", __func__, SDL_GetError());
+    } else {
+        SDL_SetSurfaceBlendMode(deviceSurface, SDL_BLENDMODE_NONE);
+        if (SDL_BlitScaled(deviceSurface, NULL, surface, NULL) != 0) {
+            LOG("SDL_BlitScaled failed in %s: %s\n", __func__, SDL_GetError());
+        }
+    }
+    SDL_FreeSurface(deviceSurface);
+    return surface;
+}
@@ -0,0 +1,33 @@
+#ifndef _SCALE_H_
+#define _SCALE_H_
+
+#include <math.h>
+#include <SDL2/SDL.h>
+
+/*
+ * All X coordinates and sizes are logical pixels. If a device scale factor is configured,
+ * windows and drawables are backed by DEVICE_SCALE times as many device pixels, the renderers
+ * scale the geometry while drawing and text is rasterized at the device resolution.
+ * SDL window coordinates (positions, sizes and input events) are device pixels.
+ */
+
+/* Environment variable with the device scale factor, or "auto" to derive it from the display DPI. */
+#define DEVICE_SCALE_ENV "SDL2X11_SCALE"
+#ifdef __ANDROID__
+#  define BASE_DPI 160.0f
+#else
+#  define BASE_DPI 96.0f
+#endif /* __ANDROID__ */
+
+extern float DEVICE_SCALE;
+
+#define IS_SCALED (DEVICE_SCALE != 1.0f)
+#define TO_DEVICE(value) ((int) lroundf((value) * DEVICE_SCALE))
+#define TO_LOGICAL(value) ((int) lroundf((value) / DEVICE_SCALE))
+
+void initDeviceScale(int displayIndex);
+void scaleRect(SDL_Rect* rect, float scale);
+Uint32 getLogicalMouseState(int* x, int* y);
+SDL_Surface* getLogicalSurface(SDL_Surface* deviceSurface, int width, int height);
+
+#endif /* _SCALE_H_ */
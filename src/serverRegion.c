@@ -0,0 +1,157 @@
+#include <stdlib.h>
+#include <pixman.h>
+#include "serverRegion.h"
+#include "extensions.h"
+#include "display.h"
+#include "errors.h"
+#include "util.h"
+
+static Bool setRegionRectangles(Region region, XRectangle* rectangles, int nrectangles) {
+    Region emptyRegion = XCreateRegion();
+    int i;
+    if (emptyRegion == NULL) {
+        return False;
+    }
+    XIntersectRegion(region, emptyRegion, region);
+    XDestroyRegion(emptyRegion);
+    for (i = 0; i < nrectangles; i++) {
+        if (!XUnionRectWithRegion(&rectangles[i], region, region)) {
+            return False;
+        }
+    }
+    return True;
+}
+
+Bool XFixesQueryExtension(Display* display, int* event_base_return, int* error_base_return) {
+    *event_base_return = XFIXES_FIRST_EVENT;
+    *error_base_return = XFIXES_FIRST_ERROR;
+    return True;
+}
+
+Status XFixesQueryVersion(Display* display, int* major_version_return, int* minor_version_return) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    *major_version_return = XFIXES_MAJOR;
+    *minor_version_return = XFIXES_MINOR;
+    return 1;
+}
+
+int XFixesVersion(void) {
+    return XFIXES_VERSION;
+}
+
+XserverRegion XFixesCreateRegion(Display* display, XRectangle* rectangles, int nrectangles) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    XserverRegion serverRegion = ALLOC_XID();
+    Region region = XCreateRegion();
+    if (serverRegion == None || region == NULL || !setRegionRectangles(region, rectangles, nrectangles)) {
+        if (serverRegion != None) FREE_XID(serverRegion);
+        if (region != NULL) XDestroyRegion(region);
+        handleOutOfMemory(0, display, 0, X_XFixesCreateRegion);
+        return None;
+    }
+    SET_XID_TYPE(serverRegion, SERVER_REGION);
+    SET_XID_VALUE(serverRegion, region);
+    return serverRegion;
+}
+
+void XFixesDestroyRegion(Display* display, XserverRegion region) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(region, SERVER_REGION, display);
+    XDestroyRegion(GET_SERVER_REGION(region));
+    FREE_XID(region);
+}
+
+void XFixesSetRegion(Display* display, XserverRegion region, XRectangle* rectangles, int nrectangles) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(region, SERVER_REGION, display);
+    if (!setRegionRectangles(GET_SERVER_REGION(region), rectangles, nrectangles)) {
+        handleOutOfMemory(0, display, 0, X_XFixesSetRegion);
+    }
+}
+
+void XFixesCopyRegion(Display* display, XserverRegion dst, XserverRegion src) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(dst, SERVER_REGION, display);
+    TYPE_CHECK(src, SERVER_REGION, display);
+    // The union with itself is a copy.
+    if (!XUnionRegion(GET_SERVER_REGION(src), GET_SERVER_REGION(src), GET_SERVER_REGION(dst))) {
+        handleOutOfMemory(0, display, 0, X_XFixesCopyRegion);
+    }
+}
+
+void XFixesUnionRegion(Display* display, XserverRegion dst, XserverRegion src1, XserverRegion src2) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(dst, SERVER_REGION, display);
+    TYPE_CHECK(src1, SERVER_REGION, display);
+    TYPE_CHECK(src2, SERVER_REGION, display);
+    if (!XUnionRegion(GET_SERVER_REGION(src1), GET_SERVER_REGION(src2), GET_SERVER_REGION(dst))) {
+        handleOutOfMemory(0, display, 0, X_XFixesUnionRegion);
+    }
+}
+
+void XFixesIntersectRegion(Display* display, XserverRegion dst, XserverRegion src1, XserverRegion src2) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(dst, SERVER_REGION, display);
+    TYPE_CHECK(src1, SERVER_REGION, display);
+    TYPE_CHECK(src2, SERVER_REGION, display);
+    if (!XIntersectRegion(GET_SERVER_REGION(src1), GET_SERVER_REGION(src2), GET_SERVER_REGION(dst))) {
+        handleOutOfMemory(0, display, 0, X_XFixesIntersectRegion);
+    }
+}
+
+void XFixesSubtractRegion(Display* display, XserverRegion dst, XserverRegion src1, XserverRegion src2) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(dst, SERVER_REGION, display);
+    TYPE_CHECK(src1, SERVER_REGION, display);
+    TYPE_CHECK(src2, SERVER_REGION, display);
+    if (!XSubtractRegion(GET_SERVER_REGION(src1), GET_SERVER_REGION(src2), GET_SERVER_REGION(dst))) {
+        handleOutOfMemory(0, display, 0, X_XFixesSubtractRegion);
+    }
+}
+
+void XFixesTranslateRegion(Display* display, XserverRegion region, int dx, int dy) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(region, SERVER_REGION, display);
+    XOffsetRegion(GET_SERVER_REGION(region), dx, dy);
+}
+
+void XFixesRegionExtents(Display* display, XserverRegion dst, XserverRegion src) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    TYPE_CHECK(dst, SERVER_REGION, display);
+    TYPE_CHECK(src, SERVER_REGION, display);
+    XRectangle extents;
+    XClipBox(GET_SERVER_REGION(src), &extents);
+    if (!setRegionRectangles(GET_SERVER_REGION(dst), &extents, extents.width > 0 && extents.height > 0)) {
+        handleOutOfMemory(0, display, 0, X_XFixesRegionExtents);
+    }
+}
+
+XRectangle* XFixesFetchRegionAndBounds(Display* display, XserverRegion region, int* nrectanglesRet,
+                                       XRectangle* bounds) {
+    SET_X_SERVER_REQUEST(display, XFIXES_MAJOR_OPCODE);
+    *nrectanglesRet = 0;
+    TYPE_CHECK(region, SERVER_REGION, display, NULL);
+    int numBoxes, i;
+    pixman_box16_t* boxes = pixman_region_rectangles((pixman_region16_t*) (void*) GET_SERVER_REGION(region),
+                                                     &numBoxes);
+    XRectangle* rectangles = malloc(sizeof(XRectangle) * MAX(numBoxes, 1));
+    if (rectangles == NULL) {
+        handleOutOfMemory(0, display, 0, X_XFixesFetchRegion);
+        return NULL;
+    }
+    for (i = 0; i < numBoxes; i++) {
+        rectangles[i].x = boxes[i].x1;
+        rectangles[i].y = boxes[i].y1;
+        rectangles[i].width = (unsigned short) (boxes[i].x2 - boxes[i].x1);
+        rectangles[i].height = (unsigned short) (boxes[i].y2 - boxes[i].y1);
+    }
+    if (bounds != NULL) {
+        XClipBox(GET_SERVER_REGION(region), bounds);
+    }
+    *nrectanglesRet = numBoxes;
+    return rectangles;
+}
+
+XRectangle* XFixesFetchRegion(Display* display, XserverRegion region, int* nrectanglesRet) {
+    return XFixesFetchRegionAndBounds(display, region, nrectanglesRet, NULL);
+}
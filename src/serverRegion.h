@@ -0,0 +1,14 @@
+#ifndef _SERVER_REGION_H_
+#define _SERVER_REGION_H_
+
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/extensions/Xfixes.h>
+
+/*
+ * The region requests of the XFIXES extension: A server region is a resource which holds an Xlib Region.
+ */
+
+#define GET_SERVER_REGION(region) ((Region) GET_XID_VALUE(region))
+
+#endif /* _SERVER_REGION_H_ */
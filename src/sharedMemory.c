@@ -0,0 +1,260 @@
+#include <stdlib.h>
+#include <sys/shm.h>
+#include "sharedMemory.h"
+#include "image.h"
+#include "extensions.h"
+#include "drawing.h"
+#include "events.h"
+#include "display.h"
+#include "errors.h"
+#include "renderThread.h"
+#include "util.h"
+
+typedef struct PendingCompletion PendingCompletion;
+struct PendingCompletion {
+    /* The event is posted once the render thread passed the fence. */
+    Uint32 fence;
+    XShmCompletionEvent* event;
+    PendingCompletion* next;
+};
+
+// The completion events which wait for their upload, in the order of the requests.
+static PendingCompletion* firstPendingCompletion = NULL;
+static PendingCompletion* lastPendingCompletion = NULL;
+
+typedef struct {
+    XImage image;
+    SDL_Rect srcRect;
+    int destX, destY;
+} ShmPutImageArgs;
+
+static void queueCompletionEvent(Display* display, Drawable drawable, ShmSeg segment, unsigned long offset) {
+    XShmCompletionEvent* event = malloc(sizeof(XShmCompletionEvent));
+    PendingCompletion* completion = NULL;
+    if (event == NULL) {
+        handleOutOfMemory(0, display, 0, X_ShmPutImage);
+        return;
+    }
+    event->type = SHM_FIRST_EVENT + ShmCompletion;
+    event->send_event = False;
+    event->display = display;
+    event->drawable = drawable;
+    event->major_code = SHM_MAJOR_OPCODE;
+    event->minor_code = X_ShmPutImage;
+    event->shmseg = segment;
+    event->offset = offset;
+    Uint32 fence = insertRenderFence();
+    if (fence != 0) {
+        completion = malloc(sizeof(PendingCompletion));
+        if (completion == NULL) {
+            // Don't lose the event, the client might wait for it.
+            waitForRenderFence(fence);
+        }
+    }
+    if (completion == NULL) {
+        enqueueEvent(display, drawable, event);
+        return;
+    }
+    completion->fence = fence;
+    completion->event = event;
+    completion->next = NULL;
+    if (lastPendingCompletion == NULL) {
+        firstPendingCompletion = completion;
+    } else {
+        lastPendingCompletion->next = completion;
+    }
+    lastPendingCompletion = completion;
+}
+
+/*
+ * Post the completion events of all uploads which were executed,
+ * or of all uploads if waitForDrawing is True.
+ */
+void postShmCompletions(Bool waitForDrawing) {
+    while (firstPendingCompletion != NULL) {
+        PendingCompletion* completion = firstPendingCompletion;
+        if (waitForDrawing) {
+            waitForRenderFence(completion->fence);
+        } else if (!isRenderFenceCompleted(completion->fence)) {
+            break;
+        }
+        firstPendingCompletion = completion->next;
+        if (firstPendingCompletion == NULL) {
+            lastPendingCompletion = NULL;
+        }
+        enqueueEvent(completion->event->display, completion->event->drawable, completion->event);
+        free(completion);
+    }
+}
+
+static int destroyShmImage(XImage* image) {
+    // The data belongs to the segment, which is released by the client.
+    free(image);
+    return 1;
+}
+
+static void putDeferredShmImage(Display* display, Drawable d, GC gc, void* args) {
+    ShmPutImageArgs* put = args;
+    putImage(display, d, gc, &put->image, &put->srcRect, put->destX, put->destY);
+}
+
+Bool XShmQueryExtension(Display* display) {
+    return True;
+}
+
+int XShmGetEventBase(Display* display) {
+    return SHM_FIRST_EVENT;
+}
+
+Bool XShmQueryVersion(Display* display, int* majorVersion, int* minorVersion, Bool* sharedPixmaps) {
+    SET_X_SERVER_REQUEST(display, SHM_MAJOR_OPCODE);
+    *majorVersion = SHM_MAJOR_VERSION;
+    *minorVersion = SHM_MINOR_VERSION;
+    *sharedPixmaps = False;
+    return True;
+}
+
+int XShmPixmapFormat(Display* display) {
+    // Shared pixmaps are not supported.
+    return 0;
+}
+
+Bool XShmAttach(Display* display, XShmSegmentInfo* shminfo) {
+    SET_X_SERVER_REQUEST(display, SHM_MAJOR_OPCODE);
+    char* address = shminfo->shmaddr;
+    Bool mapped = False;
+    if (address == NULL) {
+        address = shmat(shminfo->shmid, NULL, shminfo->readOnly ? SHM_RDONLY : 0);
+        if (address == (char*) -1) {
+            LOG("BadAccess: Failed to map the shared memory segment %d in %s!\n", shminfo->shmid, __func__);
+            handleError(0, display, None, 0, BadAccess, X_ShmAttach);
+            return False;
+        }
+        mapped = True;
+    }
+    ShmSeg segment = ALLOC_XID();
+    ShmSegmentStruct* segmentStruct = malloc(sizeof(ShmSegmentStruct));
+    if (segment == None || segmentStruct == NULL) {
+        if (segment != None) FREE_XID(segment);
+        free(segmentStruct);
+        if (mapped) shmdt(address);
+        handleOutOfMemory(0, display, 0, X_ShmAttach);
+        return False;
+    }
+    segmentStruct->address = address;
+    segmentStruct->readOnly = shminfo->readOnly;
+    segmentStruct->mapped = mapped;
+    SET_XID_TYPE(segment, SHM_SEGMENT);
+    SET_XID_VALUE(segment, segmentStruct);
+    shminfo->shmseg = segment;
+    return True;
+}
+
+Bool XShmDetach(Display* display, XShmSegmentInfo* shminfo) {
+    SET_X_SERVER_REQUEST(display, SHM_MAJOR_OPCODE);
+    ShmSeg segment = shminfo->shmseg;
+    TYPE_CHECK(segment, SHM_SEGMENT, display, False);
+    // Queued uploads might still read from the segment.
+    syncRenderThread();
+    ShmSegmentStruct* segmentStruct = GET_SHM_SEGMENT_STRUCT(segment);
+    if (segmentStruct->mapped) {
+        shmdt(segmentStruct->address);
+    }
+    free(segmentStruct);
+    FREE_XID(segment);
+    shminfo->shmseg = None;
+    return True;
+}
+
+XImage* XShmCreateImage(Display* display, Visual* visual, unsigned int depth, int format, char* data,
+                        XShmSegmentInfo* shminfo, unsigned int width, unsigned int height) {
+    XImage* image = XCreateImage(display, visual, depth, format, 0, data, width, height, 32, 0);
+    if (image == NULL) return NULL;
+    image->f.destroy_image = destroyShmImage;
+    image->obdata = (char*) shminfo;
+    return image;
+}
+
+static ShmSegmentStruct* getImageSegment(Display* display, XImage* image, ShmSeg* segmentReturn) {
+    XShmSegmentInfo* shminfo = (XShmSegmentInfo*) image->obdata;
+    ShmSeg segment = shminfo != NULL ? shminfo->shmseg : None;
+    if (!IS_TYPE(segment, SHM_SEGMENT)) {
+        LOG("BadShmSeg: Got an image without an attached segment!\n");
+        handleError(0, display, segment, 0, SHM_FIRST_ERROR + BadShmSeg, 0);
+        return NULL;
+    }
+    *segmentReturn = segment;
+    return GET_SHM_SEGMENT_STRUCT(segment);
+}
+
+Bool XShmPutImage(Display* display, Drawable d, GC gc, XImage* image, int src_x, int src_y,
+                  int dst_x, int dst_y, unsigned int src_width, unsigned int src_height, Bool send_event) {
+    SET_X_SERVER_REQUEST(display, SHM_MAJOR_OPCODE);
+    TYPE_CHECK(d, DRAWABLE, display, False);
+    ShmSeg segment;
+    ShmSegmentStruct* segmentStruct = getImageSegment(display, image, &segment);
+    if (segmentStruct == NULL) return False;
+    if (!canTransferImage(d, image)) {
+        LOG("BadMatch: Got an image with an unsupported format or depth %d in %s!\n", image->depth, __func__);
+        handleError(0, display, d, 0, BadMatch, X_ShmPutImage);
+        return False;
+    }
+    SDL_Rect srcRect = {src_x, src_y, (int) src_width, (int) src_height};
+    if (src_x < 0 || src_y < 0 || src_x + (int) src_width > image->width
+        || src_y + (int) src_height > image->height) {
+        LOG("BadValue: The source area is outside of the image in %s!\n", __func__);
+        handleError(0, display, None, 0, BadValue, X_ShmPutImage);
+        return False;
+    }
+    if (src_width != 0 && src_height != 0) {
+        ShmPutImageArgs* args = beginDeferredDraw(display, d, gc, putDeferredShmImage, sizeof(ShmPutImageArgs));
+        if (args != NULL) {
+            // The pixels are read from the segment when the request is executed.
+            args->image = *image;
+            args->srcRect = srcRect;
+            args->destX = dst_x;
+            args->destY = dst_y;
+            submitDeferredDraw(args);
+        } else {
+            putImage(display, d, gc, image, &srcRect, dst_x, dst_y);
+        }
+    }
+    if (send_event) {
+        queueCompletionEvent(display, d, segment, (unsigned long) (image->data - segmentStruct->address));
+    }
+    return True;
+}
+
+Bool XShmGetImage(Display* display, Drawable d, XImage* image, int x, int y, unsigned long plane_mask) {
+    SET_X_SERVER_REQUEST(display, SHM_MAJOR_OPCODE);
+    TYPE_CHECK(d, DRAWABLE, display, False);
+    ShmSeg segment;
+    ShmSegmentStruct* segmentStruct = getImageSegment(display, image, &segment);
+    if (segmentStruct == NULL) return False;
+    if (segmentStruct->readOnly) {
+        LOG("BadAccess: Can't read an image into the read only segment %lu!\n", segment);
+        handleError(0, display, segment, 0, BadAccess, X_ShmGetImage);
+        return False;
+    }
+    SDL_Rect area = {x, y, image->width, image->height};
+    if (!canTransferImage(d, image) || !isDrawableAreaReadable(d, &area)) {
+        LOG("BadMatch: Can't read the image from drawable %lu in %s!\n", d, __func__);
+        handleError(0, display, d, 0, BadMatch, X_ShmGetImage);
+        return False;
+    }
+    syncRenderThread();
+    if (!getImage(d, &area, image, plane_mask)) {
+        handleError(0, display, d, 0, BadMatch, X_ShmGetImage);
+        return False;
+    }
+    return True;
+}
+
+Pixmap XShmCreatePixmap(Display* display, Drawable d, char* data, XShmSegmentInfo* shminfo,
+                        unsigned int width, unsigned int height, unsigned int depth) {
+    SET_X_SERVER_REQUEST(display, SHM_MAJOR_OPCODE);
+    // XShmQueryVersion reports that shared pixmaps are not supported.
+    LOG("BadImplementation: Shared pixmaps are not supported!\n");
+    handleError(0, display, None, 0, BadImplementation, X_ShmCreatePixmap);
+    return None;
+}
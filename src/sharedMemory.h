@@ -0,0 +1,28 @@
+#ifndef _SHARED_MEMORY_H_
+#define _SHARED_MEMORY_H_
+
+#include <X11/Xlib.h>
+#include <X11/extensions/XShm.h>
+
+/*
+ * The MIT-SHM extension: Since the client runs in our process, a shared memory segment is used
+ * through the mapping of the client (or mapped here, if the client did not map it), so images in
+ * a segment are uploaded to and read back from the renderer without any intermediate copy.
+ * Completion events are posted once the upload was executed (see renderThread.h), so the client
+ * can reuse the memory of an image as soon as it got the event. Shared pixmaps are not supported,
+ * because the content of pixmaps lives in textures.
+ */
+
+typedef struct {
+    /* The address of the segment in our process. */
+    char* address;
+    Bool readOnly;
+    /* Whether we mapped the segment and have to unmap it again. */
+    Bool mapped;
+} ShmSegmentStruct;
+
+#define GET_SHM_SEGMENT_STRUCT(segment) ((ShmSegmentStruct*) GET_XID_VALUE(segment))
+
+void postShmCompletions(Bool waitForDrawing);
+
+#endif /* _SHARED_MEMORY_H_ */
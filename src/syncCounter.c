@@ -0,0 +1,362 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "syncCounter.h"
+#include "extensions.h"
+#include "window.h"
+#include "atoms.h"
+#include "events.h"
+#include "display.h"
+#include "errors.h"
+#include "util.h"
+
+// The ids of all counters.
+static Array counters = {NULL, 0, 0};
+// The top level windows which wait for the acknowledgement of a sync request.
+static Array waitingWindows = {NULL, 0, 0};
+
+static int64_t valueToInt64(XSyncValue value) {
+    return (int64_t) (((uint64_t) (unsigned int) value.hi << 32) | value.lo);
+}
+
+static XSyncValue int64ToValue(int64_t value) {
+    XSyncValue result;
+    _XSyncIntsToValue(&result, (unsigned int) ((uint64_t) value & 0xFFFFFFFF), (int) (value >> 32));
+    return result;
+}
+
+void XSyncIntToValue(XSyncValue* pv, int i) {
+    _XSyncIntToValue(pv, i);
+}
+
+void XSyncIntsToValue(XSyncValue* pv, unsigned int l, int h) {
+    _XSyncIntsToValue(pv, l, h);
+}
+
+Bool XSyncValueGreaterThan(XSyncValue a, XSyncValue b) {
+    return _XSyncValueGreaterThan(a, b);
+}
+
+Bool XSyncValueLessThan(XSyncValue a, XSyncValue b) {
+    return _XSyncValueLessThan(a, b);
+}
+
+Bool XSyncValueGreaterOrEqual(XSyncValue a, XSyncValue b) {
+    return _XSyncValueGreaterOrEqual(a, b);
+}
+
+Bool XSyncValueLessOrEqual(XSyncValue a, XSyncValue b) {
+    return _XSyncValueLessOrEqual(a, b);
+}
+
+Bool XSyncValueEqual(XSyncValue a, XSyncValue b) {
+    return _XSyncValueEqual(a, b);
+}
+
+Bool XSyncValueIsNegative(XSyncValue v) {
+    return _XSyncValueIsNegative(v);
+}
+
+Bool XSyncValueIsZero(XSyncValue a) {
+    return _XSyncValueIsZero(a);
+}
+
+Bool XSyncValueIsPositive(XSyncValue v) {
+    return _XSyncValueIsPositive(v);
+}
+
+unsigned int XSyncValueLow32(XSyncValue v) {
+    return _XSyncValueLow32(v);
+}
+
+int XSyncValueHigh32(XSyncValue v) {
+    return _XSyncValueHigh32(v);
+}
+
+void XSyncValueAdd(XSyncValue* presult, XSyncValue a, XSyncValue b, int* poverflow) {
+    int64_t first = valueToInt64(a), second = valueToInt64(b);
+    *poverflow = (second > 0 && first > INT64_MAX - second) || (second < 0 && first < INT64_MIN - second);
+    *presult = int64ToValue((int64_t) ((uint64_t) first + (uint64_t) second));
+}
+
+void XSyncValueSubtract(XSyncValue* presult, XSyncValue a, XSyncValue b, int* poverflow) {
+    int64_t first = valueToInt64(a), second = valueToInt64(b);
+    *poverflow = (second < 0 && first > INT64_MAX + second) || (second > 0 && first < INT64_MIN + second);
+    *presult = int64ToValue((int64_t) ((uint64_t) first - (uint64_t) second));
+}
+
+void XSyncMaxValue(XSyncValue* pv) {
+    _XSyncMaxValue(pv);
+}
+
+void XSyncMinValue(XSyncValue* pv) {
+    _XSyncMinValue(pv);
+}
+
+static XConfigureEvent* createConfigureEvent(Display* display, Window window) {
+    XConfigureEvent* event = malloc(sizeof(XConfigureEvent));
+    if (event == NULL) return NULL;
+    event->type = ConfigureNotify;
+    event->send_event = False;
+    event->display = display;
+    event->event = window;
+    event->window = window;
+    GET_WINDOW_POS(window, event->x, event->y);
+    GET_WINDOW_DIMS(window, event->width, event->height);
+    event->border_width = GET_WINDOW_STRUCT(window)->borderWidth;
+    event->above = None;
+    event->override_redirect = GET_WINDOW_STRUCT(window)->overrideRedirect;
+    return event;
+}
+
+static void stopWaiting(Window window) {
+    ssize_t index = findInArray(&waitingWindows, (void*) window);
+    if (index != -1) {
+        removeArray(&waitingWindows, (size_t) index, False);
+    }
+    GET_WINDOW_STRUCT(window)->resizeSync.waiting = False;
+}
+
+/*
+ * Stop waiting for the sync request of the window at the index in the waiting windows
+ * and deliver the size change which was withheld in the meantime, together with a new sync request.
+ */
+static void releaseResize(Display* display, Window window, size_t index) {
+    ResizeSync* resizeSync = &GET_WINDOW_STRUCT(window)->resizeSync;
+    removeArray(&waitingWindows, index, False);
+    resizeSync->waiting = False;
+    if (!resizeSync->configurePending) return;
+    resizeSync->configurePending = False;
+    XConfigureEvent* configureEvent = createConfigureEvent(display, window);
+    if (configureEvent == NULL) {
+        LOG("Out of memory: Failed to allocate the withheld ConfigureNotify of window %lu!\n", window);
+        return;
+    }
+    if ((unsigned int) configureEvent->width == resizeSync->width
+        && (unsigned int) configureEvent->height == resizeSync->height) {
+        // The window got back to the size the client already knows.
+        free(configureEvent);
+        return;
+    }
+    XSyncCounter counter = getSyncRequestCounter(window);
+    if (counter != None) {
+        XClientMessageEvent* syncRequest = malloc(sizeof(XClientMessageEvent));
+        if (syncRequest != NULL) {
+            startSyncRequest(display, counter, configureEvent, SDL_GetTicks(), syncRequest);
+            enqueueEvent(display, window, syncRequest);
+        }
+    }
+    enqueueEvent(display, window, configureEvent);
+}
+
+static void counterChanged(Display* display, XSyncCounter counter) {
+    size_t i = waitingWindows.length;
+    while (i-- > 0) {
+        Window window = (Window) waitingWindows.array[i];
+        ResizeSync* resizeSync = &GET_WINDOW_STRUCT(window)->resizeSync;
+        if (resizeSync->counter == counter && GET_SYNC_COUNTER_STRUCT(counter)->value >= resizeSync->waitValue) {
+            releaseResize(display, window, i);
+        }
+    }
+}
+
+XSyncCounter getSyncRequestCounter(Window window) {
+    static Atom WM_PROTOCOLS = None;
+    if (WM_PROTOCOLS == None) {
+        WM_PROTOCOLS = internalInternAtom("WM_PROTOCOLS");
+    }
+    if (window == None || !IS_TOP_LEVEL(window)) return None;
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    WindowProperty* protocols = findProperty(&windowStruct->properties, WM_PROTOCOLS, NULL);
+    if (protocols == NULL || protocols->type != XA_ATOM) return None;
+    size_t i;
+    for (i = 0; i < protocols->dataLength && ((Atom*) protocols->data)[i] != _NET_WM_SYNC_REQUEST; i++);
+    if (i == protocols->dataLength) return None;
+    WindowProperty* counterProperty = findProperty(&windowStruct->properties, _NET_WM_SYNC_REQUEST_COUNTER, NULL);
+    if (counterProperty == NULL || counterProperty->dataFormat != 32 || counterProperty->dataLength == 0) {
+        return None;
+    }
+    // The property may still name a counter which was destroyed.
+    XSyncCounter counter = (XSyncCounter) ((unsigned long*) counterProperty->data)[0];
+    return findInArray(&counters, (void*) counter) != -1 ? counter : None;
+}
+
+/*
+ * Check whether the ConfigureNotify for a new size of a window which supports
+ * the _NET_WM_SYNC_REQUEST protocol has to be withheld, because the client has
+ * not drawn the last size yet or because it already knows the size.
+ */
+Bool withholdResize(Window window, unsigned int width, unsigned int height) {
+    ResizeSync* resizeSync = &GET_WINDOW_STRUCT(window)->resizeSync;
+    if (resizeSync->waiting) {
+        if (!SDL_TICKS_PASSED(SDL_GetTicks(), resizeSync->requestTicks + SYNC_REQUEST_TIMEOUT)) {
+            resizeSync->configurePending = True;
+            return True;
+        }
+        LOG("Sync request of window %lu timed out\n", window);
+        stopWaiting(window);
+        resizeSync->configurePending = False;
+    }
+    // SDL reports a resize by the user twice, once as resized and once as size changed.
+    return width == resizeSync->width && height == resizeSync->height;
+}
+
+/*
+ * Fill in the sync request which has to be delivered right before the ConfigureNotify event
+ * and wait until the client acknowledges it by setting the counter to the requested value.
+ */
+void startSyncRequest(Display* display, XSyncCounter counter, const XConfigureEvent* configureEvent,
+                      Time time, XClientMessageEvent* event) {
+    static Atom WM_PROTOCOLS = None;
+    if (WM_PROTOCOLS == None) {
+        WM_PROTOCOLS = internalInternAtom("WM_PROTOCOLS");
+    }
+    Window window = configureEvent->window;
+    ResizeSync* resizeSync = &GET_WINDOW_STRUCT(window)->resizeSync;
+    int64_t waitValue = GET_SYNC_COUNTER_STRUCT(counter)->value + 1;
+    if (!resizeSync->waiting) {
+        // If the window can't be tracked, don't withhold anything for it.
+        resizeSync->waiting = insertArray(&waitingWindows, (void*) window);
+    }
+    resizeSync->counter = counter;
+    resizeSync->waitValue = waitValue;
+    resizeSync->requestTicks = SDL_GetTicks();
+    resizeSync->configurePending = False;
+    resizeSync->width = (unsigned int) configureEvent->width;
+    resizeSync->height = (unsigned int) configureEvent->height;
+    event->type = ClientMessage;
+    event->send_event = False;
+    event->display = display;
+    event->window = window;
+    event->message_type = WM_PROTOCOLS;
+    event->format = 32;
+    event->data.l[0] = _NET_WM_SYNC_REQUEST;
+    event->data.l[1] = time;
+    event->data.l[2] = (long) ((uint64_t) waitValue & 0xFFFFFFFF);
+    event->data.l[3] = (long) (waitValue >> 32);
+    event->data.l[4] = 0;
+}
+
+/*
+ * Deliver the withheld size changes of windows whose sync request timed out.
+ * Returns the time in milliseconds until the next sync request with a withheld
+ * size change times out, or -1 if there is none.
+ */
+Sint32 releaseTimedOutResizes(Display* display) {
+    Sint32 nextTimeout = -1;
+    Uint32 now = SDL_GetTicks();
+    size_t i = waitingWindows.length;
+    while (i-- > 0) {
+        Window window = (Window) waitingWindows.array[i];
+        ResizeSync* resizeSync = &GET_WINDOW_STRUCT(window)->resizeSync;
+        if (!resizeSync->configurePending) continue;
+        Uint32 deadline = resizeSync->requestTicks + SYNC_REQUEST_TIMEOUT;
+        if (SDL_TICKS_PASSED(now, deadline)) {
+            LOG("Sync request of window %lu timed out\n", window);
+            releaseResize(display, window, i);
+        } else if (nextTimeout == -1 || (Sint32) (deadline - now) < nextTimeout) {
+            nextTimeout = (Sint32) (deadline - now);
+        }
+    }
+    return nextTimeout;
+}
+
+void detachResizeSync(Window window) {
+    if (GET_WINDOW_STRUCT(window)->resizeSync.waiting) {
+        stopWaiting(window);
+    }
+}
+
+Status XSyncQueryExtension(Display* display, int* event_base_return, int* error_base_return) {
+    *event_base_return = SYNC_FIRST_EVENT;
+    *error_base_return = SYNC_FIRST_ERROR;
+    return True;
+}
+
+Status XSyncInitialize(Display* display, int* major_version_return, int* minor_version_return) {
+    SET_X_SERVER_REQUEST(display, SYNC_MAJOR_OPCODE);
+    *major_version_return = SYNC_MAJOR_VERSION;
+    *minor_version_return = SYNC_MINOR_VERSION;
+    return True;
+}
+
+XSyncSystemCounter* XSyncListSystemCounters(Display* display, int* n_counters_return) {
+    SET_X_SERVER_REQUEST(display, SYNC_MAJOR_OPCODE);
+    // There are no system counters.
+    *n_counters_return = 0;
+    return NULL;
+}
+
+void XSyncFreeSystemCounterList(XSyncSystemCounter* list) {
+    free(list);
+}
+
+XSyncCounter XSyncCreateCounter(Display* display, XSyncValue initial_value) {
+    SET_X_SERVER_REQUEST(display, SYNC_MAJOR_OPCODE);
+    XSyncCounter counter = ALLOC_XID();
+    SyncCounterStruct* counterStruct = malloc(sizeof(SyncCounterStruct));
+    if (counter == None || counterStruct == NULL || !insertArray(&counters, (void*) counter)) {
+        if (counter != None) FREE_XID(counter);
+        free(counterStruct);
+        handleOutOfMemory(0, display, 0, X_SyncCreateCounter);
+        return None;
+    }
+    counterStruct->value = valueToInt64(initial_value);
+    SET_XID_TYPE(counter, SYNC_COUNTER);
+    SET_XID_VALUE(counter, counterStruct);
+    return counter;
+}
+
+Status XSyncSetCounter(Display* display, XSyncCounter counter, XSyncValue value) {
+    SET_X_SERVER_REQUEST(display, SYNC_MAJOR_OPCODE);
+    TYPE_CHECK(counter, SYNC_COUNTER, display, False);
+    GET_SYNC_COUNTER_STRUCT(counter)->value = valueToInt64(value);
+    counterChanged(display, counter);
+    return True;
+}
+
+Status XSyncChangeCounter(Display* display, XSyncCounter counter, XSyncValue value) {
+    SET_X_SERVER_REQUEST(display, SYNC_MAJOR_OPCODE);
+    TYPE_CHECK(counter, SYNC_COUNTER, display, False);
+    SyncCounterStruct* counterStruct = GET_SYNC_COUNTER_STRUCT(counter);
+    XSyncValue result;
+    int overflow;
+    XSyncValueAdd(&result, int64ToValue(counterStruct->value), value, &overflow);
+    if (overflow) {
+        LOG("BadValue: Counter %lu would overflow in %s!\n", counter, __func__);
+        handleError(0, display, None, 0, BadValue, X_SyncChangeCounter);
+        return False;
+    }
+    counterStruct->value = valueToInt64(result);
+    counterChanged(display, counter);
+    return True;
+}
+
+Status XSyncQueryCounter(Display* display, XSyncCounter counter, XSyncValue* value_return) {
+    SET_X_SERVER_REQUEST(display, SYNC_MAJOR_OPCODE);
+    TYPE_CHECK(counter, SYNC_COUNTER, display, False);
+    *value_return = int64ToValue(GET_SYNC_COUNTER_STRUCT(counter)->value);
+    return True;
+}
+
+Status XSyncDestroyCounter(Display* display, XSyncCounter counter) {
+    SET_X_SERVER_REQUEST(display, SYNC_MAJOR_OPCODE);
+    TYPE_CHECK(counter, SYNC_COUNTER, display, False);
+    ssize_t index = findInArray(&counters, (void*) counter);
+    if (index != -1) {
+        removeArray(&counters, (size_t) index, False);
+    }
+    if (counters.length == 0) {
+        freeArray(&counters);
+    }
+    // Nobody can acknowledge sync requests on this counter anymore.
+    size_t i = waitingWindows.length;
+    while (i-- > 0) {
+        Window window = (Window) waitingWindows.array[i];
+        if (GET_WINDOW_STRUCT(window)->resizeSync.counter == counter) {
+            releaseResize(display, window, i);
+        }
+    }
+    free(GET_SYNC_COUNTER_STRUCT(counter));
+    FREE_XID(counter);
+    return True;
+}
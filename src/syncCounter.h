@@ -0,0 +1,55 @@
+#ifndef _SYNC_COUNTER_H_
+#define _SYNC_COUNTER_H_
+
+#include <SDL2/SDL.h>
+#include <X11/Xlib.h>
+#include <X11/extensions/sync.h>
+
+/*
+ * The counters of the SYNC extension and the _NET_WM_SYNC_REQUEST protocol: Before a top level
+ * window that supports the protocol gets a ConfigureNotify for a new size, it gets a sync request
+ * with the value its counter has to be set to once the new size was drawn. Until then, further size
+ * changes are withheld and only the last one is delivered with the next request, so a client that
+ * can't keep up with an interactive resize drops frames instead of queueing them.
+ */
+
+/* Minor opcodes of the SYNC requests. */
+#define X_SyncInitialize 0
+#define X_SyncListSystemCounters 1
+#define X_SyncCreateCounter 2
+#define X_SyncSetCounter 3
+#define X_SyncChangeCounter 4
+#define X_SyncQueryCounter 5
+#define X_SyncDestroyCounter 6
+
+/* Time in milliseconds after which a sync request counts as acknowledged, if the client does not answer. */
+#define SYNC_REQUEST_TIMEOUT 500
+
+typedef struct {
+    /* The value of this counter. */
+    int64_t value;
+} SyncCounterStruct;
+
+typedef struct {
+    /* Whether the window waits for the acknowledgement of a sync request. */
+    Bool waiting;
+    /* The counter and the value which acknowledge the sync request. */
+    XSyncCounter counter;
+    int64_t waitValue;
+    Uint32 requestTicks;
+    /* Whether a size change was withheld while waiting. */
+    Bool configurePending;
+    /* The size of the last ConfigureNotify which was sent with a sync request. */
+    unsigned int width, height;
+} ResizeSync;
+
+#define GET_SYNC_COUNTER_STRUCT(counter) ((SyncCounterStruct*) GET_XID_VALUE(counter))
+
+XSyncCounter getSyncRequestCounter(Window window);
+Bool withholdResize(Window window, unsigned int width, unsigned int height);
+void startSyncRequest(Display* display, XSyncCounter counter, const XConfigureEvent* configureEvent,
+                      Time time, XClientMessageEvent* event);
+Sint32 releaseTimedOutResizes(Display* display);
+void detachResizeSync(Window window);
+
+#endif /* _SYNC_COUNTER_H_ */
@@ -0,0 +1,221 @@
+#include <string.h>
+#include "texturePool.h"
+#include "bitmap.h"
+#include "glyphAtlas.h"
+#include "imageStream.h"
+#include "util.h"
+
+/* The smallest size class, smaller textures are not worth distinguishing. */
+#define MIN_SIZE_CLASS 32
+/* The number of size classes between two powers of two, limits the wasted area per dimension to 25%. */
+#define SIZE_CLASS_STEPS 4
+
+typedef struct {
+    SDL_Texture* texture;
+    SDL_Renderer* renderer;
+    Uint32 format;
+    int access;
+    int width, height;
+    size_t size;
+} PooledTexture;
+
+// Released textures, the least recently released first.
+static PooledTexture pool[TEXTURE_POOL_MAX_TEXTURES];
+static size_t poolLength = 0;
+static size_t poolBytes = 0;
+
+static int getSizeClass(int size) {
+    if (size <= MIN_SIZE_CLASS) return MIN_SIZE_CLASS;
+    int powerOfTwo = MIN_SIZE_CLASS;
+    while (powerOfTwo * 2 < size) {
+        powerOfTwo *= 2;
+    }
+    int step = powerOfTwo / SIZE_CLASS_STEPS;
+    return (size + step - 1) / step * step;
+}
+
+static size_t getTextureBytes(Uint32 format, int width, int height) {
+    int bytesPerPixel = SDL_ISPIXELFORMAT_FOURCC(format) ? 2 : SDL_BYTESPERPIXEL(format);
+    return (size_t) width * (size_t) height * (size_t) MAX(bytesPerPixel, 1);
+}
+
+static void removePooledTexture(size_t index, Bool destroy) {
+    if (destroy) {
+        SDL_DestroyTexture(pool[index].texture);
+    }
+    poolBytes -= pool[index].size;
+    poolLength--;
+    memmove(&pool[index], &pool[index + 1], (poolLength - index) * sizeof(PooledTexture));
+}
+
+/*
+ * Destroy the released textures of the renderer, but none of the textures that are in use.
+ */
+static void freePooledTextures(SDL_Renderer* renderer) {
+    size_t i;
+    for (i = poolLength; i-- > 0;) {
+        if (pool[i].renderer == renderer) {
+            removePooledTexture(i, True);
+        }
+    }
+}
+
+/*
+ * Reset the state of a recycled texture to the state of a new one.
+ */
+static void resetTexture(SDL_Texture* texture) {
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+    SDL_SetTextureColorMod(texture, 255, 255, 255);
+    SDL_SetTextureAlphaMod(texture, 255);
+}
+
+static void clearRenderTarget(SDL_Renderer* renderer, SDL_Texture* texture) {
+    Uint8 r, g, b, a;
+    SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+    SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+    SDL_SetRenderTarget(renderer, texture);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    SDL_SetRenderTarget(renderer, previousTarget);
+}
+
+/*
+ * Get a texture of at least the given size from the pool, or create a new one.
+ * Prefers a released texture of the same size class, but also hands out larger released textures
+ * if they waste less than the area of the requested size class. Returns NULL on failure.
+ */
+SDL_Texture* acquireTexture(SDL_Renderer* renderer, Uint32 format, int access, int width, int height) {
+    int classWidth = getSizeClass(width);
+    int classHeight = getSizeClass(height);
+    size_t classArea = (size_t) classWidth * (size_t) classHeight;
+    size_t i, bestArea = 0;
+    ssize_t best = -1;
+    for (i = poolLength; i-- > 0;) {
+        PooledTexture* entry = &pool[i];
+        if (entry->renderer != renderer || entry->format != format || entry->access != access
+            || entry->width < width || entry->height < height) {
+            continue;
+        }
+        size_t area = (size_t) entry->width * (size_t) entry->height;
+        if (area <= 2 * classArea && (best == -1 || area < bestArea)) {
+            best = (ssize_t) i;
+            bestArea = area;
+            if (entry->width == classWidth && entry->height == classHeight) break;
+        }
+    }
+    SDL_Texture* texture;
+    if (best != -1) {
+        texture = pool[best].texture;
+        removePooledTexture((size_t) best, False);
+        resetTexture(texture);
+    } else {
+        SDL_RendererInfo info;
+        if (SDL_GetRendererInfo(renderer, &info) == 0) {
+            // Near the maximum texture size the exact size must be used.
+            if (info.max_texture_width > 0 && classWidth > info.max_texture_width) classWidth = width;
+            if (info.max_texture_height > 0 && classHeight > info.max_texture_height) classHeight = height;
+        }
+        texture = SDL_CreateTexture(renderer, format, access, classWidth, classHeight);
+        if (texture == NULL) {
+            // Free the pooled textures of the renderer and try again with the exact size.
+            freePooledTextures(renderer);
+            texture = SDL_CreateTexture(renderer, format, access, width, height);
+            if (texture == NULL) {
+                LOG("SDL_CreateTexture failed in %s: %s\n", __func__, SDL_GetError());
+                return NULL;
+            }
+        }
+    }
+    if (access == SDL_TEXTUREACCESS_TARGET) {
+        clearRenderTarget(renderer, texture);
+    }
+    return texture;
+}
+
+/*
+ * Get a streaming texture from the pool with the content of the surface in its top left corner.
+ * The blend mode of the texture is set to SDL_BLENDMODE_BLEND. Returns NULL on failure.
+ */
+SDL_Texture* acquireSurfaceTexture(SDL_Renderer* renderer, SDL_Surface* surface) {
+    SDL_Surface* convertedSurface = NULL;
+    Uint32 format = surface->format->format;
+    if (SDL_ISPIXELFORMAT_INDEXED(format) || SDL_ISPIXELFORMAT_FOURCC(format)
+        || surface->format->BytesPerPixel != 4) {
+        // Colorkeys and palettes can't be uploaded, convert them to alpha.
+        convertedSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        if (convertedSurface == NULL) {
+            LOG("SDL_ConvertSurfaceFormat failed in %s: %s\n", __func__, SDL_GetError());
+            return NULL;
+        }
+        surface = convertedSurface;
+        format = SDL_PIXELFORMAT_ARGB8888;
+    }
+    SDL_Texture* texture = acquireTexture(renderer, format, SDL_TEXTUREACCESS_STREAMING, surface->w, surface->h);
+    if (texture != NULL) {
+        SDL_Rect rect = {0, 0, surface->w, surface->h};
+        Bool mustLock = SDL_MUSTLOCK(surface);
+        if (mustLock) SDL_LockSurface(surface);
+        if (SDL_UpdateTexture(texture, &rect, surface->pixels, surface->pitch) != 0) {
+            LOG("SDL_UpdateTexture failed in %s: %s\n", __func__, SDL_GetError());
+            releaseTexture(renderer, texture);
+            texture = NULL;
+        } else {
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        }
+        if (mustLock) SDL_UnlockSurface(surface);
+    }
+    if (convertedSurface != NULL) {
+        SDL_FreeSurface(convertedSurface);
+    }
+    return texture;
+}
+
+/*
+ * Return a texture of the renderer to the pool. If the pool is full,
+ * the least recently released textures are destroyed.
+ */
+void releaseTexture(SDL_Renderer* renderer, SDL_Texture* texture) {
+    if (texture == NULL) return;
+    PooledTexture entry;
+    entry.texture = texture;
+    entry.renderer = renderer;
+    if (renderer == NULL || SDL_QueryTexture(texture, &entry.format, &entry.access,
+                                             &entry.width, &entry.height) != 0) {
+        SDL_DestroyTexture(texture);
+        return;
+    }
+    entry.size = getTextureBytes(entry.format, entry.width, entry.height);
+    if (entry.size > TEXTURE_POOL_MAX_BYTES / 4) {
+        SDL_DestroyTexture(texture);
+        return;
+    }
+    while (poolLength > 0 && (poolLength == TEXTURE_POOL_MAX_TEXTURES
+                              || poolBytes + entry.size > TEXTURE_POOL_MAX_BYTES)) {
+        removePooledTexture(0, True);
+    }
+    pool[poolLength++] = entry;
+    poolBytes += entry.size;
+}
+
+/*
+ * Destroy all pooled textures, image streams, cached bitmap textures and glyph atlas pages
+ * of the renderer. Must be called before the renderer is destroyed.
+ */
+void freeTexturePool(SDL_Renderer* renderer) {
+    freeImageStreams(renderer);
+    freeGlyphAtlas(renderer);
+    freeBitmapTextures(renderer);
+    freePooledTextures(renderer);
+}
+
+/*
+ * Destroy all pooled textures, e.g. if the system is low on memory.
+ */
+void trimTexturePool() {
+    LOG("Trimming the texture pool, freeing %lu textures with %lu bytes\n",
+        (unsigned long) poolLength, (unsigned long) poolBytes);
+    while (poolLength > 0) {
+        removePooledTexture(poolLength - 1, True);
+    }
+}
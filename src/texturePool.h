@@ -0,0 +1,27 @@
+#ifndef _TEXTURE_POOL_H_
+#define _TEXTURE_POOL_H_
+
+#include <SDL2/SDL.h>
+
+/*
+ * Pool of released textures, keyed by their renderer, format, access and size class.
+ * Textures are allocated with their size rounded up to the next size class, so a texture
+ * handed out by the pool can be larger than requested: only the requested area starting at (0, 0)
+ * is defined, so everything that uses a pooled texture must pass an explicit source rectangle.
+ * Render targets are cleared to transparent black when they are handed out, and the blend mode,
+ * color and alpha modulation of every texture are reset to the defaults.
+ * The pool must only be used on the thread that renders (see renderThread.h).
+ */
+
+/* The maximum number of bytes of released textures kept in the pool. */
+#define TEXTURE_POOL_MAX_BYTES (64 * 1024 * 1024)
+/* The maximum number of released textures kept in the pool. */
+#define TEXTURE_POOL_MAX_TEXTURES 128
+
+SDL_Texture* acquireTexture(SDL_Renderer* renderer, Uint32 format, int access, int width, int height);
+SDL_Texture* acquireSurfaceTexture(SDL_Renderer* renderer, SDL_Surface* surface);
+void releaseTexture(SDL_Renderer* renderer, SDL_Texture* texture);
+void freeTexturePool(SDL_Renderer* renderer);
+void trimTexturePool(void);
+
+#endif /* _TEXTURE_POOL_H_ */
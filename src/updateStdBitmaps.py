@@ -0,0 +1,64 @@
+import os
+import re
+
+sourceDir = os.path.join('..', 'include', 'X11', 'bitmaps')
+destFile = 'stdBitmaps.h'
+destFileTemplate = '''#ifndef _STD_BITMAPS_H_
+#define _STD_BITMAPS_H_
+
+// Generated by updateStdBitmaps.py from the XBM files in include/X11/bitmaps.
+// The bits are stored in the XBM layout, the entries are sorted by name.
+
+typedef struct {
+    char* name;
+    unsigned int width, height;
+    int xHot, yHot;
+    /* The offset of the bits in STANDARD_BITMAP_BITS. */
+    unsigned int offset;
+} StdBitmapEntry;
+
+static const unsigned char STANDARD_BITMAP_BITS[] = {
+{bits}
+};
+
+static const StdBitmapEntry STANDARD_BITMAPS[] = {
+{bitmaps}
+};
+
+#define NUM_STANDARD_BITMAPS (sizeof(STANDARD_BITMAPS) / sizeof(STANDARD_BITMAPS[0]))
+
+#endif /* _STD_BITMAPS_H_ */
+'''
+
+def parseBitmap(text):
+    defines = dict((name, int(value, 0)) for name, value in
+                   re.findall(r'#define\s+\S*?_(width|height|x_hot|y_hot)\s+(\S+)', text))
+    values = [int(value, 16) for value in re.findall(r'0[xX]([0-9a-fA-F]+)', text[text.index('{'):])]
+    width, height = defines['width'], defines['height']
+    bytesPerLine = (width + 7) // 8
+    if re.search(r'\bshort\b', text[:text.index('{')]):
+        # X10 bitmaps consist of 16 bit units, drop the padding byte of odd rows.
+        units = (width + 15) // 16
+        data = []
+        for row in range(height):
+            rowData = []
+            for value in values[row * units:(row + 1) * units]:
+                rowData += [value & 0xFF, value >> 8]
+            data += rowData[:bytesPerLine]
+    else:
+        data = values[:bytesPerLine * height]
+    return width, height, defines.get('x_hot', -1), defines.get('y_hot', -1), data
+
+bitsText = ''
+bitmapText = ''
+offset = 0
+for name in sorted(os.listdir(sourceDir)):
+    with open(os.path.join(sourceDir, name)) as source:
+        width, height, xHot, yHot, data = parseBitmap(source.read())
+    bitsText += '    // ' + name + '\n'
+    for start in range(0, len(data), 12):
+        bitsText += '    ' + ' '.join('0x%02x,' % value for value in data[start:start + 12]) + '\n'
+    bitmapText += '    {"%s", %d, %d, %d, %d, %d},\n' % (name, width, height, xHot, yHot, offset)
+    offset += len(data)
+with open(destFile, 'w') as dest:
+    dest.write(destFileTemplate.replace('{bits}', bitsText[:-1]).replace('{bitmaps}', bitmapText[:-1]))
@@ -30,11 +30,11 @@ Bool insertArray(Array* a, void* element) {
 void* removeArray(Array* a, size_t index, Bool preserveOrder) {
     if (index >= a->length) abort();
     void* element = a->array[index];
-    if (index - 1 != a->length) {
+    if (index != a->length - 1) {
         if (preserveOrder) {
             memmove(&a->array[index], &a->array[index + 1], sizeof(void *) * (a->length - (index + 1)));
         } else {
-            a->array[index] = a->array[a->length];
+            a->array[index] = a->array[a->length - 1];
         }
     }
     a->length--;
@@ -128,6 +128,18 @@ Bool matchWildcard(const char* wildcard, const char* string) {
     return True;
 }
 
+/*
+ * Hash the bytes with FNV-1a.
+ */
+Uint64 hashData(const void* data, size_t length) {
+    const Uint8* bytes = data;
+    Uint64 hash = 0xcbf29ce484222325ULL;
+    size_t i;
+    for (i = 0; i < length; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+    }
+    return hash;
+}
 
 int XFree(void *data) {
     // https://tronche.com/gui/x/xlib/display/XFree.html
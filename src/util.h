@@ -27,6 +27,7 @@
 
 #define WARN_UNIMPLEMENTED LOG("Hit unimplemented function %s.\n", __func__)
 
+#include <SDL2/SDL.h>
 #include "X11/Xlib.h"
 
 typedef struct {
@@ -46,5 +47,6 @@ ssize_t findInArrayNCmp(Array *a, void *element, size_t startIndex,
 void swapArray(Array *a, size_t index1, size_t index2);
 void freeArray(Array* a);
 Bool matchWildcard(const char* wildcard, const char* string);
+Uint64 hashData(const void* data, size_t length);
 
 #endif /* UTIL_H */
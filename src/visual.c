@@ -4,14 +4,13 @@
 #include "util.h"
 #include <SDL2/SDL.h>
 #include "errors.h"
+#include "colors.h"
 
 Visual* VISUAL_LIST = NULL;
 size_t NUM_VISUALS = 0;
 
 
 Bool initVisuals() {
-    // TODO: Check with sdl for real screen values
-    // https://wiki.libsdl.org/SDL_PixelFormatEnum
     if (VISUAL_LIST != NULL) {
         LOG("Warn: Visual memory already allocated!\n");
         return True;
@@ -25,15 +24,23 @@ Bool initVisuals() {
     VISUAL_LIST->ext_data = NULL;
     VISUAL_LIST->visualid = 0;	/* visual id of this visual */
     VISUAL_LIST->CLASS_ATTRIBUTE = TrueColor;
-    VISUAL_LIST->red_mask = 0xFF000000;
-    VISUAL_LIST->green_mask = 0x00FF0000;
-    VISUAL_LIST->blue_mask = 0x0000FF00;
     VISUAL_LIST->bits_per_rgb = sizeof(SDL_Color);
     // TODO: Reconsider this
     VISUAL_LIST->map_entries = 16581375 /* (255 * 255 * 255) */ ;	/* color map entries */
+    updateVisualMasks();
     return True;
 }
 
+void updateVisualMasks() {
+    // The masks must match the texture format, so that pixel values can be uploaded unchanged.
+    size_t i;
+    for (i = 0; i < NUM_VISUALS; i++) {
+        VISUAL_LIST[i].red_mask = NATIVE_PIXEL_FORMAT.redMask;
+        VISUAL_LIST[i].green_mask = NATIVE_PIXEL_FORMAT.greenMask;
+        VISUAL_LIST[i].blue_mask = NATIVE_PIXEL_FORMAT.blueMask;
+    }
+}
+
 void freeVisuals() {
     size_t i = 0;
     for (i = 0; i < NUM_VISUALS; i++) {
@@ -17,6 +17,7 @@
 
 Bool initVisuals();
 void freeVisuals();
+void updateVisualMasks();
 Visual* getDefaultVisual(int screenIndex);
 
 #endif //VISUAL_H
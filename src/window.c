@@ -5,6 +5,10 @@
 #include "atoms.h"
 #include "events.h"
 #include "display.h"
+#include "windowClip.h"
+#include "present.h"
+#include "renderThread.h"
+#include "texturePool.h"
 
 // TODO: Cover cases where top-level window is re-parented and window is converted to top-level window
 
@@ -12,6 +16,7 @@ int XDestroyWindow(Display* display, Window window) {
     // https://tronche.com/gui/x/xlib/window/XDestroyWindow.html
     SET_X_SERVER_REQUEST(display, X_DestroyWindow);
     TYPE_CHECK(window, WINDOW, display, 0);
+    syncRenderThread();
     if (window == SCREEN_WINDOW) return 0;
     destroyWindow(display, window, True);
     return 1;
@@ -147,6 +152,7 @@ int XMapWindow(Display* display, Window window) {
 	// https://tronche.com/gui/x/xlib/window/XMapWindow.html
 	SET_X_SERVER_REQUEST(display, X_MapWindow);
 	TYPE_CHECK(window, WINDOW, display, 0);
+	syncRenderThread();
 	if (GET_WINDOW_STRUCT(window)->mapState == Mapped || GET_WINDOW_STRUCT(window)->mapState == MapRequested) { return 1; }
 	if (!GET_WINDOW_STRUCT(window)->overrideRedirect && HAS_EVENT_MASK(GET_PARENT(window), SubstructureRedirectMask)) {
 		postEvent(display, window, MapRequest);
@@ -160,9 +166,13 @@ int XMapWindow(Display* display, Window window) {
 		if (windowStruct->borderWidth == 0) {
 			flags |= SDL_WINDOW_BORDERLESS;
 		}
+		if (IS_SCALED) {
+			// Don't let the platform upscale the window, we render at the device resolution.
+			flags |= SDL_WINDOW_ALLOW_HIGHDPI;
+		}
 		SDL_Window* sdlWindow = SDL_CreateWindow(windowStruct->windowName,
-												 windowStruct->x, windowStruct->y,
-												 windowStruct->w, windowStruct->h, flags);
+												 TO_DEVICE(windowStruct->x), TO_DEVICE(windowStruct->y),
+												 TO_DEVICE(windowStruct->w), TO_DEVICE(windowStruct->h), flags);
 		if (sdlWindow == NULL) {
 			LOG("SDL_CreateWindow failed in XMapWindow: %s\n", SDL_GetError());
 			handleError(0, display, None, 0, BadMatch, 0);
@@ -171,14 +181,21 @@ int XMapWindow(Display* display, Window window) {
 		registerWindowMapping(window, SDL_GetWindowID(sdlWindow));
 		SDL_Texture* windowTexture = windowStruct->sdlTexture;
 		if (windowTexture != NULL) {
-			SDL_Renderer *newRenderer = SDL_CreateRenderer(sdlWindow, -1, SDL_RENDERER_SOFTWARE);
+			SDL_Renderer *newRenderer = SDL_CreateRenderer(sdlWindow, -1, getRendererFlags(SDL_RENDERER_SOFTWARE));
 			if (newRenderer != NULL) {
 				SDL_Renderer* oldWindowRenderer;
 				GET_RENDERER(window, oldWindowRenderer);
 				SDL_Surface* windowSurface = getRenderSurface(oldWindowRenderer);
-				SDL_Texture* oldWindowTexture = SDL_CreateTextureFromSurface(newRenderer, windowSurface);
-				SDL_FreeSurface(windowSurface);
-				if (SDL_RenderCopy(newRenderer, oldWindowTexture, NULL, NULL) != 0) {
+				SDL_Texture* oldWindowTexture = NULL;
+				SDL_Rect srcRect = {0, 0, 0, 0};
+				if (windowSurface != NULL) {
+					oldWindowTexture = acquireSurfaceTexture(newRenderer, windowSurface);
+					srcRect.w = windowSurface->w;
+					srcRect.h = windowSurface->h;
+					SDL_FreeSurface(windowSurface);
+				}
+				if (oldWindowTexture == NULL
+					|| SDL_RenderCopy(newRenderer, oldWindowTexture, &srcRect, NULL) != 0) {
 					LOG("Failed to copy window surface with renderer in XMapWindow: %s\n", SDL_GetError());
 					handleError(0, display, None, 0, BadMatch, 0);
 					SDL_DestroyWindow(sdlWindow);
@@ -186,14 +203,17 @@ int XMapWindow(Display* display, Window window) {
 					SDL_DestroyRenderer(newRenderer);
 					return 0;
 				}
-				SDL_DestroyTexture(windowTexture);
-				SDL_DestroyTexture(oldWindowTexture);
+				releaseTexture(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer, windowTexture);
+				releaseTexture(newRenderer, oldWindowTexture);
 				windowStruct->sdlRenderer = newRenderer;
 				windowStruct->sdlTexture  = NULL;
+				windowStruct->contentChanged = True;
 			}
 		}
 		windowStruct->sdlWindow = sdlWindow;
 		windowStruct->mapState = Mapped;
+		invalidateWindowClipAfterChange(window);
+		restoreBackingStore(display, window);
 		if (windowStruct->windowName != NULL) {
 			free(windowStruct->windowName);
 			windowStruct->windowName = NULL;
@@ -209,6 +229,8 @@ int XMapWindow(Display* display, Window window) {
 				return 0;
 			}
 			GET_WINDOW_STRUCT(window)->mapState = Mapped;
+			invalidateWindowClipAfterChange(window);
+			restoreBackingStore(display, window);
 		} else { /* Parent not mapped */
 			if (!mergeWindowDrawables(GET_PARENT(window), window)) {
 				LOG("Parent not mapped fail");
@@ -218,11 +240,13 @@ int XMapWindow(Display* display, Window window) {
 			// mapRequestedChildren will do all the work
 			// TODO: Have a look at this: https://tronche.com/gui/x/xlib/window/map.html
 			GET_WINDOW_STRUCT(window)->mapState = MapRequested;
+			invalidateWindowClipAfterChange(window);
 			return 0;
 		}
 	}
 	postEvent(display, window, MapNotify);
 	mapRequestedChildren(display, window);
+	updateWindowVisibility(display, GET_PARENT(window));
 	#ifdef DEBUG_WINDOWS
 	printWindowsHierarchy();
 	#endif
@@ -233,26 +257,36 @@ int XUnmapWindow(Display* display, Window window) {
     // https://tronche.com/gui/x/xlib/window/XUnmapWindow.html
 	SET_X_SERVER_REQUEST(display, X_UnmapWindow);
 	TYPE_CHECK(window, WINDOW, display, 0);
+	syncRenderThread();
 	if (window == SCREEN_WINDOW) {
 		handleError(0, display, window, 0, BadWindow, 0);
 		return 0;
 	}
 	WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
 	if (windowStruct->mapState == UnMapped) return 1;
+	// Windows with their own texture keep their content anyway,
+	// top level windows only have content once they were drawn into.
+	if (windowStruct->sdlTexture == NULL
+		&& (windowStruct->sdlWindow == NULL || windowStruct->sdlRenderer != NULL)) {
+		saveBackingStore(window);
+	}
 	windowStruct->mapState = UnMapped;
+	invalidateWindowClipAfterChange(window);
 	if (windowStruct->sdlWindow != NULL) {
 		SDL_Window* sdlWindow = windowStruct->sdlWindow;
 		windowStruct->sdlWindow = NULL;
 		SDL_DestroyWindow(sdlWindow);
 		if (windowStruct->sdlRenderer != NULL) {
+			freeDoubleBuffers(windowStruct->sdlRenderer);
+			freeTexturePool(windowStruct->sdlRenderer);
 			SDL_DestroyRenderer(windowStruct->sdlRenderer);
 			windowStruct->sdlRenderer = NULL;
 		}
 	} else if (GET_WINDOW_STRUCT(GET_PARENT(window))->mapState != UnMapped) {
 		postEvent(display, window, UnmapNotify, False);
-		SDL_Rect exposeRect = {windowStruct->x, windowStruct->y, windowStruct->w, windowStruct->h};
-		postExposeEvent(display, GET_PARENT(window), &exposeRect, 1);
 	}
+	// Exposes the parts of the parent and the siblings that were covered by the window.
+	updateWindowVisibility(display, GET_PARENT(window));
 	// TODO: Change subwindow state to MapRequested?
 	return 1;
 }
@@ -313,6 +347,7 @@ int XReparentWindow(Display* display, Window window, Window parent, int x, int y
     SET_X_SERVER_REQUEST(display, X_ReparentWindow);
     TYPE_CHECK(window, WINDOW, display, 0);
     TYPE_CHECK(parent, WINDOW, display, 0);
+    syncRenderThread();
     if (window == parent) {
         LOG("Invalid parameter: Can not add window to itself in XReparentWindow!\n");
         handleError(0, display, window, 0, BadMatch, 0);
@@ -335,6 +370,7 @@ int XReparentWindow(Display* display, Window window, Window parent, int x, int y
         LOG("Out of memory: Failed to reattach window in XReparentWindow!\n");
         return 0;
     }
+    invalidateWindowClip(window);
     XMoveWindow(display, window, x, y); // TODO: Do this without generating events
     postEvent(display, window, ReparentNotify, oldParent);
     if (mapState != UnMapped) {
@@ -549,23 +585,28 @@ int XChangeProperty(Display* display, Window window, Atom property, Atom type, i
     if (property == _NET_WM_ICON) {
         // Find the icon with the highest resolution
         unsigned long* pixelData = (unsigned long*) data;
-        unsigned long* icons[20];
-        int i = 0, bestIcon = 0;
-        unsigned long w;
-        unsigned long h;
-        do {
-            icons[i++] = pixelData;
-            w = pixelData[0];
-            h = pixelData[1];
-            if (w > icons[bestIcon][0] || h > icons[bestIcon][1]) {
-                bestIcon = i;
+        unsigned long* end = pixelData + numberOfElements;
+        unsigned long* bestIcon = NULL;
+        while (end - pixelData >= 2) {
+            unsigned long remaining = (unsigned long) (end - pixelData - 2);
+            if (pixelData[0] > 0 && pixelData[1] > remaining / pixelData[0]) break;
+            if (bestIcon == NULL || pixelData[0] * pixelData[1] > bestIcon[0] * bestIcon[1]) {
+                bestIcon = pixelData;
             }
-            pixelData += 2 + w * h;
-        } while (i < 20 && pixelData < ((unsigned long*) data) + numberOfElements);
-        w = icons[bestIcon][0];
-        h = icons[bestIcon][1];
-        SDL_Surface* icon = SDL_CreateRGBSurfaceFrom(&icons[bestIcon][2], (int) w, (int) h, 32, w * (32 / 8),
-                                                     0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
+            pixelData += 2 + pixelData[0] * pixelData[1];
+        }
+        SDL_Surface* icon = NULL;
+        if (bestIcon != NULL && bestIcon[0] * bestIcon[1] > 0) {
+            // The pixels are 32 bit ARGB values in longs, which have 64 bits on some platforms.
+            int w = (int) bestIcon[0], h = (int) bestIcon[1], x, y;
+            icon = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+            for (y = 0; icon != NULL && y < h; y++) {
+                Uint32* row = (Uint32*) ((Uint8*) icon->pixels + y * icon->pitch);
+                for (x = 0; x < w; x++) {
+                    row[x] = (Uint32) bestIcon[2 + y * w + x];
+                }
+            }
+        }
         if (windowStruct->icon != NULL) {
             SDL_FreeSurface(windowStruct->icon);
         }
@@ -664,10 +705,22 @@ int XRaiseWindow(Display* display, Window window) {
     // https://tronche.com/gui/x/xlib/window/XRaiseWindow.html
     SET_X_SERVER_REQUEST(display, X_ConfigureWindow);
     TYPE_CHECK(window, WINDOW, display, 0);
+    syncRenderThread();
     if (IS_MAPPED_TOP_LEVEL_WINDOW(window)) {
         SDL_RaiseWindow(GET_WINDOW_STRUCT(window)->sdlWindow);
     }
-    // TODO: Rearrange child in child list of parent.
+    Window parent = GET_PARENT(window);
+    if (parent != None) {
+        // The last child is the top most one.
+        Array* siblings = &GET_WINDOW_STRUCT(parent)->children;
+        ssize_t index = findInArray(siblings, (void*) window);
+        if (index != -1 && (size_t) index != siblings->length - 1) {
+            removeArray(siblings, (size_t) index, True);
+            insertArray(siblings, (void*) window);
+            invalidateWindowClipAfterChange(window);
+            updateWindowVisibility(display, parent);
+        }
+    }
     return 1;
 }
 
@@ -680,10 +733,8 @@ Status XGetWindowAttributes(Display* display, Window window,
     window_attributes_return->visual = GET_VISUAL(window);
     if (IS_MAPPED_TOP_LEVEL_WINDOW(window)) {
         SDL_Window* sdlWindow = GET_WINDOW_STRUCT(window)->sdlWindow;
-        SDL_GetWindowPosition(sdlWindow, &window_attributes_return->x,
-                              &window_attributes_return->y);
-        SDL_GetWindowSize(sdlWindow, &window_attributes_return->width,
-                          &window_attributes_return->height);
+        GET_WINDOW_POS(window, window_attributes_return->x, window_attributes_return->y);
+        GET_WINDOW_DIMS(window, window_attributes_return->width, window_attributes_return->height);
         Uint32 flags = SDL_GetWindowFlags(sdlWindow);
         if (HAS_VALUE(flags, SDL_WINDOW_MINIMIZED)) {
             window_attributes_return->map_state = IsUnviewable;
@@ -707,6 +758,7 @@ Status XGetWindowAttributes(Display* display, Window window,
     }
     window_attributes_return->depth = SDL_SURFACE_DEPTH;
     window_attributes_return->colormap = GET_WINDOW_STRUCT(window)->colormap;
+    window_attributes_return->backing_store = GET_WINDOW_STRUCT(window)->backingStore;
     return 1;
 }
 
@@ -792,6 +844,19 @@ int XChangeWindowAttributes(Display* display, Window window, unsigned long value
         if (HAS_VALUE(valueMask, CWColormap)) {
             XSetWindowColormap(display, window, attributes->colormap);
         }
+        if (HAS_VALUE(valueMask, CWBackingStore)) {
+            if (attributes->backing_store != NotUseful && attributes->backing_store != WhenMapped
+                && attributes->backing_store != Always) {
+                handleError(0, display, window, 0, BadValue, 0);
+                return 0;
+            }
+            // Drawing into obscured windows depends on the backing store.
+            syncRenderThread();
+            GET_WINDOW_STRUCT(window)->backingStore = attributes->backing_store;
+            if (attributes->backing_store == NotUseful) {
+                freeBackingStore(window);
+            }
+        }
         if (HAS_VALUE(valueMask, CWEventMask)) {
             LOG("Change window attributes event: %ld\n",
                 attributes->event_mask & SubstructureRedirectMask);
@@ -2,9 +2,14 @@
 #define _WINDOW_H_
 
 #include <SDL2/SDL.h>
+#include <pixman.h>
 
 #include "windowDebug.h"
+#include "backingStore.h"
+#include "doubleBuffer.h"
 #include "resourceTypes.h"
+#include "scale.h"
+#include "syncCounter.h"
 #include "util.h"
 
 typedef struct {
@@ -23,6 +28,8 @@ typedef struct {
     /* List of children */
     Array children;
 	SDL_Texture* sdlTexture;
+	/* The used area of sdlTexture in device pixels, the texture is pooled and may be larger. */
+	int textureWidth, textureHeight;
 	/*
      * This is the SDL Window handler to the real window of this window.
      * Only set if this window is a mapped top level window.
@@ -52,6 +59,27 @@ typedef struct {
     MapState mapState;
     long eventMask;
     Bool overrideRedirect;
+    /* Cached visible and clip region of this window, see windowClip.h. */
+    pixman_region16_t visibleRegion;
+    pixman_region16_t clipRegion;
+    Bool clipRegionValid;
+    /* The last visibility state reported to the client, see windowClip.h. */
+    int visibility;
+    Bool visibilityDirty;
+    /* The part of the clip region whose content the client has drawn or was sent Expose events for. */
+    pixman_region16_t exposedRegion;
+    /* The backing_store attribute and the saved content of this window, see backingStore.h. */
+    int backingStore;
+    BackingStore* savedContent;
+    /* The back buffer of this window and the front buffer if it is composited, see doubleBuffer.h. */
+    BackBuffer* backBuffer;
+    BufferTexture frontBuffer;
+    /* Present state of this window, only used if this window has a corresponding sdlWindow. */
+    Bool contentChanged;
+    Uint32 lastPresentTicks;
+    Uint32 presentInterval;
+    /* The _NET_WM_SYNC_REQUEST state of this window, see syncCounter.h. */
+    ResizeSync resizeSync;
     #ifdef DEBUG_WINDOWS
     /* Random id used for debugging. */
     unsigned long debugId;
@@ -72,8 +100,8 @@ extern Window SCREEN_WINDOW;
 #define GET_WINDOW_POS(window, out_x, out_y) if (IS_MAPPED_TOP_LEVEL_WINDOW(window)) {\
     int temp_x, temp_y;\
     SDL_GetWindowPosition(GET_WINDOW_STRUCT(window)->sdlWindow, &temp_x, &temp_y);\
-    GET_WINDOW_STRUCT(window)->x = (unsigned int) temp_x;\
-    GET_WINDOW_STRUCT(window)->y = (unsigned int) temp_y;\
+    GET_WINDOW_STRUCT(window)->x = TO_LOGICAL(temp_x);\
+    GET_WINDOW_STRUCT(window)->y = TO_LOGICAL(temp_y);\
 }\
 out_x = GET_WINDOW_STRUCT(window)->x;\
 out_y = GET_WINDOW_STRUCT(window)->y
@@ -81,8 +109,8 @@ out_y = GET_WINDOW_STRUCT(window)->y
 #define GET_WINDOW_DIMS(window, width, height) if (IS_MAPPED_TOP_LEVEL_WINDOW(window)) {\
     int temp_w, temp_h;\
     SDL_GetWindowSize(GET_WINDOW_STRUCT(window)->sdlWindow, &temp_w, &temp_h);\
-    GET_WINDOW_STRUCT(window)->w = (unsigned int) temp_w;\
-    GET_WINDOW_STRUCT(window)->h = (unsigned int) temp_h;\
+    GET_WINDOW_STRUCT(window)->w = (unsigned int) TO_LOGICAL(temp_w);\
+    GET_WINDOW_STRUCT(window)->h = (unsigned int) TO_LOGICAL(temp_h);\
 }\
 width = GET_WINDOW_STRUCT(window)->w;\
 height = GET_WINDOW_STRUCT(window)->h
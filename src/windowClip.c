@@ -0,0 +1,233 @@
+#include "windowClip.h"
+#include "window.h"
+#include "events.h"
+#include "backingStore.h"
+
+/* Mapped InputOutput windows are the only ones covering something. */
+#define IS_OBSCURING_WINDOW(window) (!IS_INPUT_ONLY(window) && GET_WINDOW_STRUCT(window)->mapState != UnMapped)
+
+/*
+ * Check if the window is drawn into its own render target instead of the one of its parent.
+ */
+static Bool hasOwnRenderTarget(Window window) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    return window == SCREEN_WINDOW || windowStruct->parent == None || windowStruct->sdlWindow != NULL
+           || windowStruct->mapState == UnMapped;
+}
+
+static void subtractWindowArea(pixman_region16_t* region, Window window) {
+    pixman_region16_t windowRegion;
+    int x, y;
+    unsigned int width, height;
+    GET_WINDOW_POS(window, x, y);
+    GET_WINDOW_DIMS(window, width, height);
+    pixman_region_init_rect(&windowRegion, x, y, width, height);
+    pixman_region_subtract(region, region, &windowRegion);
+    pixman_region_fini(&windowRegion);
+}
+
+static void updateWindowRegions(Window window) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    if (windowStruct->clipRegionValid) return;
+    pixman_box16_t bounds = {0, 0, 0, 0};
+    unsigned int width, height;
+    size_t i;
+    GET_WINDOW_DIMS(window, width, height);
+    bounds.x2 = (int16_t) MIN(width, INT16_MAX);
+    bounds.y2 = (int16_t) MIN(height, INT16_MAX);
+    pixman_region_reset(&windowStruct->visibleRegion, &bounds);
+    if (!hasOwnRenderTarget(window)) {
+        Window parent = GET_PARENT(window);
+        WindowStruct* parentStruct = GET_WINDOW_STRUCT(parent);
+        updateWindowRegions(parent);
+        pixman_region16_t parentRegion;
+        int x, y;
+        GET_WINDOW_POS(window, x, y);
+        pixman_region_init(&parentRegion);
+        pixman_region_copy(&parentRegion, &parentStruct->visibleRegion);
+        pixman_region_translate(&parentRegion, -x, -y);
+        pixman_region_intersect(&windowStruct->visibleRegion, &windowStruct->visibleRegion, &parentRegion);
+        pixman_region_fini(&parentRegion);
+        // Siblings later in the child list are stacked above this window.
+        Window* siblings = GET_CHILDREN(parent);
+        ssize_t index = findInArray(&parentStruct->children, (void*) window);
+        for (i = (size_t) (index + 1); index != -1 && i < parentStruct->children.length; i++) {
+            if (IS_OBSCURING_WINDOW(siblings[i])) {
+                pixman_region_translate(&windowStruct->visibleRegion, x, y);
+                subtractWindowArea(&windowStruct->visibleRegion, siblings[i]);
+                pixman_region_translate(&windowStruct->visibleRegion, -x, -y);
+            }
+        }
+    }
+    pixman_region_copy(&windowStruct->clipRegion, &windowStruct->visibleRegion);
+    Window* children = GET_CHILDREN(window);
+    for (i = 0; i < windowStruct->children.length; i++) {
+        if (IS_OBSCURING_WINDOW(children[i])) {
+            subtractWindowArea(&windowStruct->clipRegion, children[i]);
+        }
+    }
+    windowStruct->clipRegionValid = True;
+}
+
+/*
+ * Get the region of the window that drawing operations are clipped to, in window coordinates.
+ * If includeInferiors is True, the areas of the children are part of the region (IncludeInferiors),
+ * otherwise they are excluded (ClipByChildren). The region is owned by the window
+ * and only valid until the window hierarchy changes.
+ */
+pixman_region16_t* getWindowClipRegion(Window window, Bool includeInferiors) {
+    updateWindowRegions(window);
+    if (includeInferiors) {
+        return &GET_WINDOW_STRUCT(window)->visibleRegion;
+    }
+    return &GET_WINDOW_STRUCT(window)->clipRegion;
+}
+
+/*
+ * Invalidate the cached regions of the window and all of its descendants.
+ */
+void invalidateWindowClip(Window window) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    Window* children = GET_CHILDREN(window);
+    size_t i;
+    windowStruct->clipRegionValid = False;
+    windowStruct->visibilityDirty = True;
+    for (i = 0; i < windowStruct->children.length; i++) {
+        invalidateWindowClip(children[i]);
+    }
+}
+
+/*
+ * Invalidate all cached regions that depend on the window after it was mapped, unmapped,
+ * moved, resized or restacked: Its own subtree, the ones of its siblings and its parent.
+ * The ancestors above the parent and the rest of the window tree are unaffected.
+ * The parent is marked for the next visibility update as well, so it is exposed where the window
+ * uncovered it and its exposed region shrinks where the window now covers it.
+ */
+void invalidateWindowClipAfterChange(Window window) {
+    invalidateWindowClip(window);
+    Window parent = GET_PARENT(window);
+    if (parent == None) return;
+    WindowStruct* parentStruct = GET_WINDOW_STRUCT(parent);
+    Window* siblings = GET_CHILDREN(parent);
+    size_t i;
+    parentStruct->clipRegionValid = False;
+    parentStruct->visibilityDirty = True;
+    for (i = 0; i < parentStruct->children.length; i++) {
+        if (siblings[i] != window) {
+            invalidateWindowClip(siblings[i]);
+        }
+    }
+}
+
+int getWindowVisibility(Window window) {
+    Window ancestor;
+    for (ancestor = window; ancestor != SCREEN_WINDOW && ancestor != None; ancestor = GET_PARENT(ancestor)) {
+        WindowStruct* ancestorStruct = GET_WINDOW_STRUCT(ancestor);
+        if (ancestorStruct->mapState != Mapped) {
+            return VisibilityNotViewable;
+        }
+        if (ancestorStruct->sdlWindow != NULL) {
+            Uint32 flags = SDL_GetWindowFlags(ancestorStruct->sdlWindow);
+            if (HAS_VALUE(flags, SDL_WINDOW_MINIMIZED) || HAS_VALUE(flags, SDL_WINDOW_HIDDEN)) {
+                return VisibilityFullyObscured;
+            }
+            break;
+        }
+    }
+    pixman_region16_t* visibleRegion = getWindowClipRegion(window, True);
+    if (!pixman_region_not_empty(visibleRegion)) {
+        return VisibilityFullyObscured;
+    }
+    pixman_box16_t bounds = {0, 0, 0, 0};
+    unsigned int width, height;
+    GET_WINDOW_DIMS(window, width, height);
+    bounds.x2 = (int16_t) MIN(width, INT16_MAX);
+    bounds.y2 = (int16_t) MIN(height, INT16_MAX);
+    if (pixman_region_contains_rectangle(visibleRegion, &bounds) == PIXMAN_REGION_IN) {
+        return VisibilityUnobscured;
+    }
+    return VisibilityPartiallyObscured;
+}
+
+/*
+ * Update the exposed region of the window to the part of it that can currently be drawn into:
+ * Its clip region if it is viewable and drawing into it is not dropped (see nextDrawTarget).
+ * If display is not NULL, Expose events are sent for the parts that were not exposed before.
+ */
+static void updateExposedRegion(Display* display, Window window, int visibility) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    pixman_region16_t newRegion;
+    pixman_region_init(&newRegion);
+    if (window != SCREEN_WINDOW && visibility != VisibilityNotViewable
+        && (visibility != VisibilityFullyObscured || isContentPreserved(window))) {
+        pixman_region_copy(&newRegion, getWindowClipRegion(window, False));
+    }
+    if (display != NULL) {
+        pixman_region_subtract(&windowStruct->exposedRegion, &newRegion, &windowStruct->exposedRegion);
+        int numBoxes;
+        pixman_box16_t* boxes = pixman_region_rectangles(&windowStruct->exposedRegion, &numBoxes);
+        SDL_Rect exposedRect;
+        while (numBoxes-- > 0) {
+            exposedRect.x = boxes[numBoxes].x1;
+            exposedRect.y = boxes[numBoxes].y1;
+            exposedRect.w = boxes[numBoxes].x2 - boxes[numBoxes].x1;
+            exposedRect.h = boxes[numBoxes].y2 - boxes[numBoxes].y1;
+            postEvent(display, window, Expose, &exposedRect, (size_t) numBoxes);
+        }
+    }
+    pixman_region_copy(&windowStruct->exposedRegion, &newRegion);
+    pixman_region_fini(&newRegion);
+}
+
+/*
+ * Mark the visible parts of the window and its descendants as exposed, after their content
+ * was restored or Expose events were sent for all of it.
+ */
+void markWindowExposed(Window window) {
+    Window* children = GET_CHILDREN(window);
+    size_t i;
+    updateExposedRegion(NULL, window, IS_INPUT_ONLY(window) ? VisibilityNotViewable : getWindowVisibility(window));
+    for (i = 0; i < GET_WINDOW_STRUCT(window)->children.length; i++) {
+        markWindowExposed(children[i]);
+    }
+}
+
+/*
+ * Mark the content of the window and its descendants as lost, e.g. after it was moved,
+ * so the next visibility update sends Expose events for all of their visible parts.
+ */
+void forgetWindowExposure(Window window) {
+    Window* children = GET_CHILDREN(window);
+    size_t i;
+    pixman_region_clear(&GET_WINDOW_STRUCT(window)->exposedRegion);
+    for (i = 0; i < GET_WINDOW_STRUCT(window)->children.length; i++) {
+        forgetWindowExposure(children[i]);
+    }
+}
+
+/*
+ * Recalculate the visibility of all windows in the subtree of the window whose regions
+ * were invalidated and send a VisibilityNotify event to the ones whose visibility changed.
+ * Drawing into windows which are fully obscured is dropped and windows don't keep the content
+ * of their covered parts, so an Expose event is sent for every part of a window that became visible.
+ */
+void updateWindowVisibility(Display* display, Window window) {
+    WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    Window* children = GET_CHILDREN(window);
+    size_t i;
+    if (windowStruct->visibilityDirty) {
+        windowStruct->visibilityDirty = False;
+        int visibility = IS_INPUT_ONLY(window) ? VisibilityNotViewable : getWindowVisibility(window);
+        if (visibility != windowStruct->visibility) {
+            windowStruct->visibility = visibility;
+            if (visibility != VisibilityNotViewable) {
+                postEvent(display, window, VisibilityNotify, visibility);
+            }
+        }
+        updateExposedRegion(display, window, visibility);
+    }
+    for (i = 0; i < windowStruct->children.length; i++) {
+        updateWindowVisibility(display, children[i]);
+    }
+}
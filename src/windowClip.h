@@ -0,0 +1,38 @@
+#ifndef _WINDOW_CLIP_H_
+#define _WINDOW_CLIP_H_
+
+#include <pixman.h>
+#include <X11/Xlib.h>
+
+/*
+ * Every window caches two regions in its own coordinate system:
+ * The visible region is the part of the window which is not clipped by its ancestors
+ * or covered by mapped siblings stacked above it. The clip region is the visible region
+ * without the areas of the mapped children, which is where drawing with ClipByChildren ends up.
+ * Windows which have their own render target (top level windows, unmapped windows and the
+ * screen window) are not clipped by anything outside of them.
+ */
+
+/*
+ * The visibility of a window is one of VisibilityUnobscured, VisibilityPartiallyObscured and
+ * VisibilityFullyObscured, based on its visible region and the state of the SDL window it is
+ * shown in. Minimized or hidden windows are fully obscured, windows which are not viewable
+ * (they or one of their ancestors are not mapped) have no visibility.
+ */
+#define VisibilityNotViewable (-1)
+
+/*
+ * Every window also tracks the part of its clip region that was exposed to the client.
+ * updateWindowVisibility sends Expose events for the parts of the clip region that were not
+ * exposed before, e.g. after a covering sibling was raised above, unmapped or moved away.
+ */
+
+pixman_region16_t* getWindowClipRegion(Window window, Bool includeInferiors);
+void invalidateWindowClip(Window window);
+void invalidateWindowClipAfterChange(Window window);
+int getWindowVisibility(Window window);
+void updateWindowVisibility(Display* display, Window window);
+void markWindowExposed(Window window);
+void forgetWindowExposure(Window window);
+
+#endif /* _WINDOW_CLIP_H_ */
@@ -42,7 +42,8 @@ void printWindowHierarchyOfChild(Window window, char* prepend, int prependLen) {
 		}
 		if (GET_WINDOW_STRUCT(children[i])->sdlTexture != NULL) {
 			int w, h;
-			SDL_QueryTexture(GET_WINDOW_STRUCT(children[i])->sdlTexture, NULL, NULL, &w, &h);
+			w = GET_WINDOW_STRUCT(children[i])->textureWidth;
+			h = GET_WINDOW_STRUCT(children[i])->textureHeight;
 			printf(", sdlTexture = %p (%d x %d)", GET_WINDOW_STRUCT(children[i])->sdlTexture, w, h);
 		}
 		printf("\n");
@@ -5,6 +5,12 @@
 #include "drawing.h"
 #include "events.h"
 #include "display.h"
+#include "windowClip.h"
+#include "present.h"
+#include "renderThread.h"
+#include "texturePool.h"
+#include "damage.h"
+#include "syncCounter.h"
 
 Window SCREEN_WINDOW = None;
 
@@ -21,9 +27,14 @@ void initWindowStruct(WindowStruct* windowStruct, int x, int y, unsigned int wid
     windowStruct->colormap = colormap;
     windowStruct->visual = visual;
 	windowStruct->sdlTexture = NULL;
+	windowStruct->textureWidth = windowStruct->textureHeight = 0;
 	windowStruct->sdlRenderer = NULL;
     windowStruct->sdlWindow = NULL;
     windowStruct->backgroundColor = backgroundColor;
+    windowStruct->backingStore = NotUseful;
+    windowStruct->savedContent = NULL;
+    windowStruct->backBuffer = NULL;
+    memset(&windowStruct->frontBuffer, 0, sizeof(BufferTexture));
     windowStruct->background = backgroundPixmap;
     windowStruct->colormapWindowsCount = -1;
     windowStruct->colormapWindows = NULL;
@@ -35,6 +46,16 @@ void initWindowStruct(WindowStruct* windowStruct, int x, int y, unsigned int wid
     windowStruct->mapState = UnMapped;
     windowStruct->eventMask = NoEventMask;
     windowStruct->overrideRedirect = False;
+    pixman_region_init(&windowStruct->visibleRegion);
+    pixman_region_init(&windowStruct->clipRegion);
+    windowStruct->clipRegionValid = False;
+    windowStruct->visibility = VisibilityNotViewable;
+    windowStruct->visibilityDirty = False;
+    pixman_region_init(&windowStruct->exposedRegion);
+    windowStruct->contentChanged = False;
+    windowStruct->lastPresentTicks = 0;
+    windowStruct->presentInterval = getPresentInterval();
+    memset(&windowStruct->resizeSync, 0, sizeof(ResizeSync));
 #ifdef DEBUG_WINDOWS
     windowStruct->debugId = ((unsigned long) rand() << 16) | rand();
 #endif /* DEBUG_WINDOWS */
@@ -77,10 +98,15 @@ void destroyScreenWindow(Display* display) {
 			SDL_DestroyTexture(windowStruct->sdlTexture);
 			windowStruct->sdlTexture = NULL;
 		}
+		freeDoubleBuffers(windowStruct->sdlRenderer);
+		freeTexturePool(windowStruct->sdlRenderer);
 		SDL_DestroyRenderer(windowStruct->sdlRenderer);
 		windowStruct->sdlRenderer = NULL;
         SDL_DestroyWindow(windowStruct->sdlWindow);
         freeArray(&windowStruct->children);
+        pixman_region_fini(&windowStruct->visibleRegion);
+        pixman_region_fini(&windowStruct->clipRegion);
+        pixman_region_fini(&windowStruct->exposedRegion);
         free(windowStruct);
         FREE_XID(SCREEN_WINDOW);
         SCREEN_WINDOW = None;
@@ -164,6 +190,11 @@ void removeChildFromParent(Window child) {
 void destroyWindow(Display* display, Window window, Bool freeParentData) {
     size_t i;
     WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
+    freeBackingStore(window);
+    windowStruct->backingStore = NotUseful;
+    detachBackBuffer(window);
+    detachDamage(window);
+    detachResizeSync(window);
     if (windowStruct->mapState == Mapped) {
         XUnmapWindow(display, window);
     }
@@ -187,9 +218,11 @@ void destroyWindow(Display* display, Window window, Bool freeParentData) {
         SDL_FreeSurface(windowStruct->icon);
     }
 	if (windowStruct->sdlTexture != NULL) {
-		SDL_DestroyTexture(windowStruct->sdlTexture);
+		releaseTexture(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer, windowStruct->sdlTexture);
     }
 	if (windowStruct->sdlRenderer != NULL) {
+		freeDoubleBuffers(windowStruct->sdlRenderer);
+		freeTexturePool(windowStruct->sdlRenderer);
 		SDL_DestroyRenderer(windowStruct->sdlRenderer);
     }
     if (windowStruct->sdlWindow != NULL) {
@@ -198,8 +231,16 @@ void destroyWindow(Display* display, Window window, Bool freeParentData) {
     deleteWindowMapping(window);
     postEvent(display, window, DestroyNotify);
     if (freeParentData) {
+        Window parent = windowStruct->parent;
+        invalidateWindowClipAfterChange(window);
         removeChildFromParent(window);
+        if (parent != None) {
+            updateWindowVisibility(display, parent);
+        }
     }
+    pixman_region_fini(&windowStruct->visibleRegion);
+    pixman_region_fini(&windowStruct->clipRegion);
+    pixman_region_fini(&windowStruct->exposedRegion);
     free(windowStruct);
     FREE_XID(window);
 }
@@ -239,14 +280,23 @@ Bool resizeWindowSurface(Window window) {
 	WindowStruct* windowStruct = GET_WINDOW_STRUCT(window);
 	if (windowStruct->sdlTexture != NULL) {
 		SDL_Texture* oldTexture = windowStruct->sdlTexture;
+		int width = TO_DEVICE((int) windowStruct->w), height = TO_DEVICE((int) windowStruct->h);
+		if (width <= windowStruct->textureWidth && height <= windowStruct->textureHeight) {
+			// Shrinking keeps the texture, the content stays in place.
+			windowStruct->textureWidth = width;
+			windowStruct->textureHeight = height;
+			return True;
+		}
+		SDL_Rect srcRect = {0, 0, windowStruct->textureWidth, windowStruct->textureHeight};
 		SDL_Rect destRect;
 		destRect.x = 0;
 		destRect.y = 0;
-		SDL_QueryTexture(oldTexture, NULL, NULL, &destRect.w, &destRect.h);
+		destRect.w = TO_LOGICAL(srcRect.w);
+		destRect.h = TO_LOGICAL(srcRect.h);
 		windowStruct->sdlTexture = NULL;
-		SDL_Renderer* windowRenderer = getWindowRenderer(windowStruct);
-		SDL_RenderCopy(windowRenderer, oldTexture, NULL, &destRect);
-		SDL_DestroyTexture(oldTexture);
+		SDL_Renderer* windowRenderer = getWindowRenderer(window);
+		SDL_RenderCopy(windowRenderer, oldTexture, &srcRect, &destRect);
+		releaseTexture(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer, oldTexture);
 	}
 	return True;
 }
@@ -262,12 +312,15 @@ Bool mergeWindowDrawables(Window parent, Window child) {
 	SDL_Rect destRect;
 	GET_WINDOW_POS(child, destRect.x, destRect.y);
 	GET_WINDOW_DIMS(child, destRect.w, destRect.h);
-	if (SDL_RenderCopy(parentRenderer, childWindowStruct->sdlTexture, NULL, &destRect) != 0) {
+	SDL_Rect srcRect = {0, 0, childWindowStruct->textureWidth, childWindowStruct->textureHeight};
+	if (SDL_RenderCopy(parentRenderer, childWindowStruct->sdlTexture, &srcRect, &destRect) != 0) {
 		return False;
 	}
-	SDL_DestroyTexture(childWindowStruct->sdlTexture);
+	releaseTexture(GET_WINDOW_STRUCT(SCREEN_WINDOW)->sdlRenderer, childWindowStruct->sdlTexture);
 	childWindowStruct->sdlTexture = NULL;
 	if (childWindowStruct->sdlRenderer != NULL) {
+		freeDoubleBuffers(childWindowStruct->sdlRenderer);
+		freeTexturePool(childWindowStruct->sdlRenderer);
 		SDL_DestroyRenderer(childWindowStruct->sdlRenderer);
 		childWindowStruct->sdlRenderer = NULL;
 	}
@@ -284,6 +337,7 @@ void mapRequestedChildren(Display* display, Window window) {
                 return;
             }
             GET_WINDOW_STRUCT(children[i])->mapState = Mapped;
+            invalidateWindowClipAfterChange(children[i]);
             postEvent(display, children[i], MapNotify);
             mapRequestedChildren(display, children[i]);
         }
@@ -297,10 +351,20 @@ Bool configureWindow(Display* display, Window window, unsigned long value_mask,
     if (!windowStruct->overrideRedirect && HAS_EVENT_MASK(GET_PARENT(window), SubstructureRedirectMask)) {
         return postEvent(display, window, ConfigureRequest, value_mask, values);
     }
+    syncRenderThread();
     Bool isMappedTopLevelWindow = IS_MAPPED_TOP_LEVEL_WINDOW(window);
     int oldX, oldY, oldWidth, oldHeight;
     GET_WINDOW_POS(window, oldX, oldY);
     GET_WINDOW_DIMS(window, oldWidth, oldHeight);
+    Bool moves = (HAS_VALUE(value_mask, CWX) && values->x != oldX)
+                 || (HAS_VALUE(value_mask, CWY) && values->y != oldY);
+    Bool resizes = (HAS_VALUE(value_mask, CWWidth) && values->width != oldWidth)
+                   || (HAS_VALUE(value_mask, CWHeight) && values->height != oldHeight);
+    // Top level windows keep their content when they are moved, and windows with their own texture always do.
+    if (windowStruct->mapState == Mapped && windowStruct->sdlTexture == NULL
+        && (resizes || (moves && !isMappedTopLevelWindow))) {
+        saveBackingStore(window);
+    }
     if (HAS_VALUE(value_mask, CWX) || HAS_VALUE(value_mask, CWY)) { 
         int x = oldX, y = oldY;
         if (HAS_VALUE(value_mask, CWX)) {
@@ -310,8 +374,8 @@ Bool configureWindow(Display* display, Window window, unsigned long value_mask,
             y = values->y;
         }
         if (isMappedTopLevelWindow) {
-            SDL_SetWindowPosition(windowStruct->sdlWindow, x, y);
-            SDL_GetWindowPosition(windowStruct->sdlWindow, &windowStruct->x, &windowStruct->y);
+            SDL_SetWindowPosition(windowStruct->sdlWindow, TO_DEVICE(x), TO_DEVICE(y));
+            GET_WINDOW_POS(window, windowStruct->x, windowStruct->y);
         } else {
             windowStruct->x = x;
             windowStruct->y = y;
@@ -325,6 +389,7 @@ Bool configureWindow(Display* display, Window window, unsigned long value_mask,
         if (HAS_VALUE(value_mask, CWWidth)) {
             width = values->width;
             if (width <= 0) {
+                freeBackingStore(window);
                 handleError(0, display, None, 0, BadValue, 0);
                 return False;
             }
@@ -332,6 +397,7 @@ Bool configureWindow(Display* display, Window window, unsigned long value_mask,
         if (HAS_VALUE(value_mask, CWHeight)) {
             height = values->height;
             if (height <= 0) {
+                freeBackingStore(window);
                 handleError(0, display, None, 0, BadValue, 0);
                 return False;
             }
@@ -339,11 +405,11 @@ Bool configureWindow(Display* display, Window window, unsigned long value_mask,
         printWindowsHierarchy();
         LOG("Resizing window %lu to (%ux%u)\n", window, width, height);
         if (isMappedTopLevelWindow) {
-            SDL_SetWindowSize(windowStruct->sdlWindow, width, height);
+            SDL_SetWindowSize(windowStruct->sdlWindow, TO_DEVICE(width), TO_DEVICE(height));
             int wOut, hOut;
             SDL_GetWindowSize(windowStruct->sdlWindow, &wOut, &hOut);
-            windowStruct->w = (unsigned int) wOut;
-            windowStruct->h = (unsigned int) hOut;
+            windowStruct->w = (unsigned int) TO_LOGICAL(wOut);
+            windowStruct->h = (unsigned int) TO_LOGICAL(hOut);
         } else {
             windowStruct->w = (unsigned int) width;
             windowStruct->h = (unsigned int) height;
@@ -353,26 +419,26 @@ Bool configureWindow(Display* display, Window window, unsigned long value_mask,
             hasChanged = True;
         }
     }
-    if (!hasChanged) return True;
+    if (!hasChanged) {
+        freeBackingStore(window);
+        return True;
+    }
+    invalidateWindowClipAfterChange(window);
     if (!postEvent(display, window, ConfigureNotify)) {
+        freeBackingStore(window);
         return False;
     }
     if (windowStruct->mapState != UnMapped && (oldX != windowStruct->x || oldY != windowStruct->y
         || oldWidth != windowStruct->w || oldHeight != windowStruct->h)) {
-        SDL_Rect exposedRect;  // TODO: Handle whe window shrinks or moves, update parent
-        if (oldX != windowStruct->x || oldY != windowStruct->y) {
-            exposedRect.x = 0;
-            exposedRect.y = 0;
-            exposedRect.w = windowStruct->w;
-            exposedRect.h = windowStruct->h;
+        if (windowStruct->savedContent != NULL) {
+            // Only the parts which were not visible before the change are exposed.
+            restoreBackingStore(display, window);
         } else {
-            exposedRect.x = 0;
-            exposedRect.y = 0;
-            exposedRect.w = windowStruct->w;
-            exposedRect.h = windowStruct->h;// TODO Calculate exposed rect
+            // The content is not moved or resized with the window, all of it is exposed.
+            forgetWindowExposure(window);
         }
-        postExposeEvent(display, window, &exposedRect, 1);
     }
+    updateWindowVisibility(display, GET_PARENT(window));
     return True;
     // TODO: Implement re-stacking: https://tronche.com/gui/x/xlib/window/configure.html#XWindowChanges
 }